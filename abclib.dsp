@@ -647,6 +647,10 @@ SOURCE=.\src\base\io\ioReadVerilog.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\io\ioSession.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\io\ioUtil.c
 # End Source File
 # Begin Source File
@@ -2071,6 +2075,10 @@ SOURCE=.\src\sat\bmc\bmcBmcS.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcBmcT.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcCexCare.c
 # End Source File
 # Begin Source File
@@ -4618,6 +4626,10 @@ SOURCE=.\src\map\amap\amapParse.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\amap\amapPart.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\amap\amapPerm.c
 # End Source File
 # Begin Source File
@@ -5046,6 +5058,10 @@ SOURCE=.\src\misc\vec\vecMem.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\vec\vecMemMt.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\vec\vecPtr.h
 # End Source File
 # Begin Source File
@@ -6102,6 +6118,10 @@ SOURCE=.\src\aig\gia\giaHash.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaHashMt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaIf.c
 # End Source File
 # Begin Source File
@@ -6318,6 +6338,14 @@ SOURCE=.\src\aig\gia\giaSimBase.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSimInc.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\aig\gia\giaSoa.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSort.c
 # End Source File
 # Begin Source File
@@ -7082,6 +7110,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrMt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -94,6 +94,7 @@ struct Gia_Obj_t_
 
 // new AIG manager
 typedef struct Gia_Man_t_ Gia_Man_t;
+typedef struct Gia_HashMt_t_ Gia_HashMt_t;
 struct Gia_Man_t_
 {
     char *         pName;         // name of the AIG
@@ -333,6 +334,30 @@ struct Gia_ManSim_t_
     unsigned *     pDataSimCos;  // simulation data for COs
 };
 
+// structure-of-arrays view of the AIG
+typedef struct Gia_Soa_t_ Gia_Soa_t;
+struct Gia_Soa_t_
+{
+    Gia_Man_t *    pGia;         // the AIG manager
+    int            nObjs;        // the number of objects
+    int            nAnds;        // the number of AND gates
+    int *          pFan0;        // the first fanin literals (-1 for the constant and CIs)
+    int *          pFan1;        // the second fanin literals (-1 for non-ANDs)
+    int *          pAnds;        // the AND gates in the topological order
+    unsigned char* pMarks;       // fMark0 (bit 0), fMark1 (bit 1), and fPhase (bit 2)
+    unsigned *     pValues;      // the values
+};
+
+static inline int          Gia_SoaIsAnd( Gia_Soa_t * p, int i )              { return p->pFan1[i] >= 0;                         }
+static inline int          Gia_SoaIsCo( Gia_Soa_t * p, int i )               { return p->pFan0[i] >= 0 && p->pFan1[i] < 0;      }
+static inline int          Gia_SoaIsBuf( Gia_Soa_t * p, int i )              { return (p->pFan0[i] >> 1) == (p->pFan1[i] >> 1); }
+static inline int          Gia_SoaIsXor( Gia_Soa_t * p, int i )              { return (p->pFan0[i] >> 1) > (p->pFan1[i] >> 1);  }
+static inline int          Gia_SoaMark0( Gia_Soa_t * p, int i )              { return p->pMarks[i] & 1;                         }
+static inline int          Gia_SoaMark1( Gia_Soa_t * p, int i )              { return (p->pMarks[i] >> 1) & 1;                  }
+static inline int          Gia_SoaPhase( Gia_Soa_t * p, int i )              { return (p->pMarks[i] >> 2) & 1;                  }
+static inline void         Gia_SoaSetMark0( Gia_Soa_t * p, int i )           { p->pMarks[i] |= 1;                               }
+static inline void         Gia_SoaSetMark1( Gia_Soa_t * p, int i )           { p->pMarks[i] |= 2;                               }
+
 typedef struct Jf_Par_t_ Jf_Par_t; 
 struct Jf_Par_t_
 {
@@ -1241,6 +1266,10 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
     for ( i = 0; (i < Vec_IntSize(p->vCos)) && ((pObj) = Gia_ManCo(p, i)); i++ )
 #define Gia_ManForEachCoVec( vVec, p, pObj, i )                         \
     for ( i = 0; (i < Vec_IntSize(vVec)) && ((pObj) = Gia_ManCo(p, Vec_IntEntry(vVec,i))); i++ )
+#define Gia_SoaForEachAnd( p, i, k )                                    \
+    for ( k = 0; (k < (p)->nAnds) && (((i) = (p)->pAnds[k]), 1); k++ )
+#define Gia_SoaForEachAndStartStop( p, i, k, Start, Stop )              \
+    for ( k = Start; (k < Stop) && (((i) = (p)->pAnds[k]), 1); k++ )
 #define Gia_ManForEachCoId( p, Id, i )                                  \
     for ( i = 0; (i < Vec_IntSize(p->vCos)) && ((Id) = Gia_ObjId(p, Gia_ManCo(p, i))); i++ )
 #define Gia_ManForEachCoReverse( p, pObj, i )                           \
@@ -1277,9 +1306,14 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
+extern int                 Gia_FileIsGz( char * pFileName );
+extern char *              Gia_FileReadGz( char * pFileName, int * pnFileSize );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemoryMt( char * pContents, ABC_INT64_T nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadMt( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
+extern int                 Gia_AigerWriteFile( Gia_Man_t * p, FILE * pFile, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment );
 extern void                Gia_AigerWriteS( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
@@ -1522,6 +1556,11 @@ extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashAndMulti2( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashDualMiter( Gia_Man_t * p, Vec_Int_t * vOuts );
+/*=== giaHashMt.c ===========================================================*/
+extern Gia_HashMt_t *      Gia_ManHashMtStart( Gia_Man_t * p, int nObjsMax );
+extern void                Gia_ManHashMtStop( Gia_HashMt_t * p );
+extern int                 Gia_ManHashMtAnd( Gia_HashMt_t * p, int iLit0, int iLit1 );
+extern Gia_Man_t *         Gia_ManRehashMt( Gia_Man_t * p, int nThreads );
 /*=== giaIf.c ===========================================================*/
 extern void                Gia_ManPrintOutputLutStats( Gia_Man_t * p );
 extern void                Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile );
@@ -1559,6 +1598,13 @@ extern Gia_Man_t *         Gia_ManPerformLfMapping( Gia_Man_t * p, Jf_Par_t * pP
 extern void                Gia_ManTestDistance( Gia_Man_t * p );
 extern void                Gia_ManSolveProblem( Gia_Man_t * pGia, Emb_Par_t * pPars );
  /*=== giaMan.c ===========================================================*/
+extern void *              Gia_ManRecycleAlloc( size_t nBytes, int fClean );
+extern void                Gia_ManRecycleFree( void * pArray, size_t nBytes );
+extern void                Gia_ManRecycleIntErase( Vec_Int_t * p );
+extern void                Gia_ManRecycleIntGrow( Vec_Int_t * p, int nCapMin );
+extern int                 Gia_ManRecycleReuseNum();
+extern size_t              Gia_ManRecycleByteNum();
+extern void                Gia_ManRecycleStop();
 extern Gia_Man_t *         Gia_ManStart( int nObjsMax ); 
 extern void                Gia_ManStop( Gia_Man_t * p );  
 extern void                Gia_ManStopP( Gia_Man_t ** p );  
@@ -1593,6 +1639,7 @@ extern int                 Gia_MmStepReadMemUsage( Gia_MmStep_t * p );
 /*=== giaMf.c ===========================================================*/
 extern void                Mf_ManSetDefaultPars( Jf_Par_t * pPars );
 extern Gia_Man_t *         Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
+extern Gia_Man_t *         Mf_ManPerformMappingEco( Gia_Man_t * pOld, Gia_Man_t * pGia, Jf_Par_t * pPars );
 extern void *              Mf_ManGenerateCnf( Gia_Man_t * pGia, int nLutSize, int fCnfObjIds, int fAddOrCla, int fMapping, int fVerbose );
 /*=== giaMini.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManReadMiniAig( char * pFileName, int fGiaSimple );
@@ -1629,6 +1676,13 @@ extern Gia_Man_t *         Gia_ManMapShrink6( Gia_Man_t * p, int nFanoutMax, int
 extern Gia_Man_t *         Gia_ManExtractWindow( Gia_Man_t * p, int LevelMax, int nTimeWindow, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformSopBalanceWin( Gia_Man_t * p, int LevelMax, int nTimeWindow, int nCutNum, int nRelaxRatio, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformDsdBalanceWin( Gia_Man_t * p, int LevelMax, int nTimeWindow, int nLutSize, int nCutNum, int nRelaxRatio, int fVerbose );
+/*=== giaSoa.c ============================================================*/
+extern Gia_Soa_t *         Gia_SoaStart( Gia_Man_t * pGia );
+extern void                Gia_SoaStop( Gia_Soa_t * p );
+extern void                Gia_SoaLoadMarks( Gia_Soa_t * p );
+extern void                Gia_SoaSaveMarks( Gia_Soa_t * p );
+extern int                 Gia_SoaLevelNum( Gia_Soa_t * p );
+extern void                Gia_SoaCreateRefs( Gia_Soa_t * p );
 /*=== giaSort.c ============================================================*/
 extern int *               Gia_SortFloats( float * pArray, int * pPerm, int nSize );
 /*=== giaSim.c ============================================================*/
@@ -1653,7 +1707,10 @@ extern int                 Gia_ManIncrSimCheckOver( Gia_Man_t * p, int iLit0, in
 extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, int iLit1 );
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
+extern void                Gia_ManSimPatAssignInputs( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsIn );
 extern Vec_Wrd_t *         Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts );
+extern Vec_Wrd_t *         Gia_ManSimPatSimMt( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int nThreads );
+extern Vec_Wrd_t *         Gia_SoaSimPatSim( Gia_Soa_t * p, Vec_Wrd_t * vSimsPi, int nThreads );
 extern void                Gia_ManSim2ArrayOne( Vec_Wrd_t * vSimsPi, Vec_Int_t * vRes );
 extern Vec_Wec_t *         Gia_ManSim2Array( Vec_Ptr_t * vSims );
 extern Vec_Wrd_t *         Gia_ManArray2SimOne( Vec_Int_t * vRes );
@@ -1661,6 +1718,18 @@ extern Vec_Ptr_t *         Gia_ManArray2Sim( Vec_Wec_t * vRes );
 extern void                Gia_ManPtrWrdDumpBin( char * pFileName, Vec_Ptr_t * p, int fVerbose );
 extern Vec_Ptr_t *         Gia_ManPtrWrdReadBin( char * pFileName, int fVerbose );
 extern Vec_Str_t *         Gia_ManComputeRange( Gia_Man_t * p );
+/*=== giaSimInc.c ============================================================*/
+typedef struct Gia_SimInc_t_ Gia_SimInc_t;
+extern Gia_SimInc_t *      Gia_SimIncStart( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi );
+extern Gia_SimInc_t *      Gia_SimIncStartSims( Gia_Man_t * pGia, Vec_Wrd_t * vSims, int nWords );
+extern void                Gia_SimIncStop( Gia_SimInc_t * p );
+extern Vec_Wrd_t *         Gia_SimIncSims( Gia_SimInc_t * p );
+extern int                 Gia_SimIncWordNum( Gia_SimInc_t * p );
+extern int                 Gia_SimIncUpdateNum( Gia_SimInc_t * p );
+extern void                Gia_SimIncSetCiWord( Gia_SimInc_t * p, int iCi, int iWord, word Value );
+extern void                Gia_SimIncFlipCiBit( Gia_SimInc_t * p, int iCi, int iPat );
+extern int                 Gia_SimIncPropagate( Gia_SimInc_t * p, Vec_Int_t * vSplit );
+extern void                Gia_SimIncAppend( Gia_SimInc_t * p, Vec_Wrd_t * vSimsPiNew, Vec_Int_t * vSplit );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
@@ -23,6 +23,13 @@
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
 #include "map/if/if.h"
+#include "misc/zlib/zlib.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -77,6 +84,36 @@ int Gia_FileSize( char * pFileName )
     fclose( pFile );
     return nFileSize;
 }
+int Gia_FileIsGz( char * pFileName )
+{
+    int nLength = strlen(pFileName);
+    return nLength > 3 && !strcmp(pFileName + nLength - 3, ".gz");
+}
+char * Gia_FileReadGz( char * pFileName, int * pnFileSize )
+{
+    int nCap = 1 << 20, nSize = 0, nRead;
+    char * pContents;
+    gzFile pFile = gzopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    pContents = ABC_ALLOC( char, nCap );
+    while ( (nRead = gzread( pFile, pContents + nSize, (unsigned)(nCap - nSize) )) > 0 )
+    {
+        nSize += nRead;
+        if ( nSize < nCap )
+            continue;
+        nCap *= 2;
+        pContents = ABC_REALLOC( char, pContents, nCap );
+    }
+    gzclose( pFile );
+    if ( nRead < 0 || nSize == 0 )
+    {
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    *pnFileSize = nSize;
+    return pContents;
+}
 void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
 {
     unsigned char Buffer[5];
@@ -163,6 +200,151 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Decodes the binary AND section using several threads.]
+
+  Description [Each AND gate is stored as two delta-encoded unsigned
+  numbers relative to the gate's own literal, so any position in the
+  section where a number starts can be decoded independently. The bytes
+  following the header are divided into ranges, and the tasks of the 
+  thread pool count the bytes terminating the numbers (those with the 
+  high bit equal to 0) in each range. The prefix sums of these counts
+  tell in which range each chunk of ANDs starts, so the decoding task
+  of the chunk finds its first byte by scanning only one range. Returns 
+  the array of 2*nAnds fanin literals (in the numbering of the file) and 
+  moves the current pointer to the end of the section.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_AigerRange_t_ Gia_AigerRange_t;
+struct Gia_AigerRange_t_
+{
+    unsigned char * pStart;    // the first byte of the range
+    unsigned char * pStop;     // the byte following the range
+    int             nTerms;    // the number of terminating bytes in the range
+};
+typedef struct Gia_AigerChunk_t_ Gia_AigerChunk_t;
+struct Gia_AigerChunk_t_
+{
+    unsigned char * pStart;    // the first byte of the range where the chunk starts
+    int             nSkip;     // the number of terminating bytes to skip in the range
+    unsigned char * pStop;     // the byte following the chunk (computed)
+    unsigned *      pLits;     // the fanin literals of the ANDs in the chunk
+    int             iFirst;    // the first AND in the chunk
+    int             nAnds;     // the number of ANDs in the chunk
+    int             nCis;      // the number of CIs in the AIG
+};
+static int Gia_AigerCountRange( void * pArg )
+{
+    Gia_AigerRange_t * p = (Gia_AigerRange_t *)pArg;
+    unsigned char * pCur;
+    int nTerms = 0;
+    for ( pCur = p->pStart; pCur < p->pStop; pCur++ )
+        nTerms += !(*pCur & 0x80);
+    p->nTerms = nTerms;
+    return 1;
+}
+static int Gia_AigerReadChunk( void * pArg )
+{
+    Gia_AigerChunk_t * p = (Gia_AigerChunk_t *)pArg;
+    unsigned char * pCur = p->pStart;
+    unsigned * pLits = p->pLits;
+    unsigned uLit, uLit1;
+    int i;
+    for ( i = 0; i < p->nSkip; i++ )
+        while ( *pCur++ & 0x80 );
+    for ( i = 0; i < p->nAnds; i++ )
+    {
+        uLit  = ((p->iFirst + i + 1 + p->nCis) << 1);
+        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+        *pLits++ = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        *pLits++ = uLit1;
+    }
+    p->pStop = pCur;
+    return 1;
+}
+unsigned * Gia_AigerReadAnds( unsigned char ** ppCur, unsigned char * pEnd, int nAnds, int nCis, int nThreads )
+{
+    Util_PoolGroup_t * pGroup;
+    Gia_AigerRange_t * pRanges;
+    Gia_AigerChunk_t * pChunks;
+    unsigned * pLits = ABC_ALLOC( unsigned, 2 * (size_t)Abc_MaxInt(nAnds, 1) );
+    unsigned char * pCur = *ppCur;
+    ABC_INT64_T nTermsAll = 0, iTerm;
+    size_t nBytes, nRangeSize;
+    int i, r, nChunkSize, nChunks, nRanges;
+    nThreads   = Abc_MaxInt( 1, nThreads );
+    nChunkSize = Abc_MaxInt( 1, (nAnds + nThreads - 1) / nThreads );
+    nChunks    = (nAnds + nChunkSize - 1) / nChunkSize;
+    pChunks    = ABC_CALLOC( Gia_AigerChunk_t, Abc_MaxInt(nChunks, 1) );
+    for ( i = 0; i < nChunks; i++ )
+    {
+        pChunks[i].pStart = pCur;
+        pChunks[i].pLits  = pLits + 2 * (size_t)i * nChunkSize;
+        pChunks[i].iFirst = i * nChunkSize;
+        pChunks[i].nAnds  = Abc_MinInt( nChunkSize, nAnds - i * nChunkSize );
+        pChunks[i].nCis   = nCis;
+    }
+    if ( nChunks < 2 )
+    {
+        if ( nChunks == 1 )
+            Gia_AigerReadChunk( pChunks );
+        *ppCur = nChunks ? pChunks[0].pStop : pCur;
+        ABC_FREE( pChunks );
+        return pLits;
+    }
+    // each number takes at most 5 bytes
+    if ( pEnd > pCur + 10 * (size_t)nAnds )
+        pEnd = pCur + 10 * (size_t)nAnds;
+    // count the terminating bytes in the ranges
+    nBytes     = (size_t)(pEnd - pCur);
+    nRanges    = 4 * nThreads;
+    nRangeSize = (nBytes + nRanges - 1) / nRanges;
+    pRanges    = ABC_CALLOC( Gia_AigerRange_t, nRanges );
+    pGroup     = Util_PoolGroupStart( nThreads, 0 );
+    for ( r = 0; r < nRanges; r++ )
+    {
+        pRanges[r].pStart = pCur + Abc_MinWord( (word)r * nRangeSize, (word)nBytes );
+        pRanges[r].pStop  = pCur + Abc_MinWord( (word)(r+1) * nRangeSize, (word)nBytes );
+        Util_PoolGroupAdd( pGroup, Gia_AigerCountRange, pRanges + r );
+    }
+    Util_PoolGroupWait( pGroup );
+    for ( r = 0; r < nRanges; r++ )
+        nTermsAll += pRanges[r].nTerms;
+    if ( nTermsAll < 2 * (ABC_INT64_T)nAnds )
+    {
+        // the section is truncated; let the serial decoder fail as before
+        pChunks[0].nAnds = nAnds;
+        Gia_AigerReadChunk( pChunks );
+        *ppCur = pChunks[0].pStop;
+        Util_PoolGroupStop( pGroup );
+        ABC_FREE( pRanges );
+        ABC_FREE( pChunks );
+        return pLits;
+    }
+    // the chunk starting with number N starts after the N-th terminating byte
+    for ( i = 1, r = 0, iTerm = 0; i < nChunks; i++ )
+    {
+        ABC_INT64_T nTerms = 2 * (ABC_INT64_T)pChunks[i].iFirst;
+        while ( iTerm + pRanges[r].nTerms < nTerms )
+            iTerm += pRanges[r++].nTerms;
+        pChunks[i].pStart = pRanges[r].pStart;
+        pChunks[i].nSkip  = (int)(nTerms - iTerm);
+    }
+    for ( i = 0; i < nChunks; i++ )
+        Util_PoolGroupAdd( pGroup, Gia_AigerReadChunk, pChunks + i );
+    Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
+    *ppCur = pChunks[nChunks-1].pStop;
+    ABC_FREE( pRanges );
+    ABC_FREE( pChunks );
+    return pLits;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -175,6 +357,10 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryMt( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+Gia_Man_t * Gia_AigerReadFromMemoryMt( char * pContents, ABC_INT64_T nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
@@ -184,7 +370,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
     unsigned char * pDrivers, * pSymbols, * pCur;
-    unsigned uLit0, uLit1, uLit;
+    unsigned uLit0, uLit1, uLit, * pAndLits = NULL;
 
     // read the parameters (M I L O A + B C J F)
     pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
@@ -284,14 +470,26 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
 
+    // decode the AND gates in parallel
+    if ( nThreads > 1 )
+        pAndLits = Gia_AigerReadAnds( &pCur, (unsigned char *)pContents + nFileSize, nAnds, nInputs + nLatches, nThreads );
+
     // create the AND gates
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
     for ( i = 0; i < nAnds; i++ )
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( pAndLits )
+        {
+            uLit0 = pAndLits[2*i];
+            uLit1 = pAndLits[2*i+1];
+        }
+        else
+        {
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
 //        assert( uLit1 > uLit0 );
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
@@ -308,6 +506,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
+    ABC_FREE( pAndLits );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -1193,27 +1392,57 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadMt( pFileName, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+Gia_Man_t * Gia_AigerReadMt( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    ABC_INT64_T nFileSize;
+    int nBufferSize, RetValue;
 
-    // read the file into the buffer
+    // map the file into memory if possible; otherwise, read it into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    if ( Gia_FileIsGz(pFileName) )
+    {
+        pContents = Gia_FileReadGz( pFileName, &nBufferSize );
+        if ( pContents == NULL )
+        {
+            printf( "Gia_AigerRead(): Cannot read the compressed file \"%s\".\n", pFileName );
+            return NULL;
+        }
+        pNew = Gia_AigerReadFromMemoryMt( pContents, nBufferSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+        ABC_FREE( pContents );
+    }
+    else if ( (pContents = Abc_FileMap( pFileName, &nFileSize )) != NULL )
+    {
+        pNew = Gia_AigerReadFromMemoryMt( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+        Abc_FileUnmap( pContents, nFileSize );
+    }
+    else
+    {
+        nBufferSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        pContents = ABC_ALLOC( char, nBufferSize );
+        RetValue = fread( pContents, nBufferSize, 1, pFile );
+        fclose( pFile );
+        pNew = Gia_AigerReadFromMemoryMt( pContents, nBufferSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
         pName = Gia_FileNameGeneric( pFileName );
+        if ( Gia_FileIsGz(pFileName) )
+        {
+            char * pTemp = pName;
+            pName = Gia_FileNameGeneric( pTemp );
+            ABC_FREE( pTemp );
+        }
         pNew->pName = Abc_UtilStrsav( pName );
         ABC_FREE( pName );
 
@@ -1384,41 +1613,133 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
     return vBuffer;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Output stream with a fixed-size buffer.]
+
+  Description [The AIGER writer encodes everything into a buffer of
+  GIA_AIGER_OUT_SIZE bytes, which is flushed into the file (or into the 
+  compressed file) when it is full. The memory used by the writer does 
+  not depend on the size of the AIG.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_AIGER_OUT_SIZE (1<<20)
+
+typedef struct Gia_AigerOut_t_ Gia_AigerOut_t;
+struct Gia_AigerOut_t_
+{
+    FILE *          pFile;      // output file
+    gzFile          pGzFile;    // compressed output file
+    unsigned char * pBuffer;    // output buffer
+    int             nBuffer;    // the number of bytes in the buffer
+    int             fError;     // writing has failed
+};
+
+static Gia_AigerOut_t * Gia_AigerOutStart( FILE * pFile, gzFile pGzFile )
+{
+    Gia_AigerOut_t * p = ABC_CALLOC( Gia_AigerOut_t, 1 );
+    p->pFile   = pFile;
+    p->pGzFile = pGzFile;
+    p->pBuffer = ABC_ALLOC( unsigned char, GIA_AIGER_OUT_SIZE );
+    return p;
+}
+static void Gia_AigerOutFlush( Gia_AigerOut_t * p )
+{
+    if ( p->nBuffer == 0 )
+        return;
+    if ( p->pGzFile )
+    {
+        if ( gzwrite( p->pGzFile, p->pBuffer, (unsigned)p->nBuffer ) != p->nBuffer )
+            p->fError = 1;
+    }
+    else if ( fwrite( p->pBuffer, 1, (size_t)p->nBuffer, p->pFile ) != (size_t)p->nBuffer )
+        p->fError = 1;
+    p->nBuffer = 0;
+}
+static int Gia_AigerOutStop( Gia_AigerOut_t * p )
+{
+    int RetValue;
+    Gia_AigerOutFlush( p );
+    RetValue = !p->fError;
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+    return RetValue;
+}
+static void Gia_AigerOutWrite( Gia_AigerOut_t * p, void * pData, size_t nBytes )
+{
+    unsigned char * pChars = (unsigned char *)pData;
+    while ( nBytes > 0 )
+    {
+        size_t nCopy = (size_t)Abc_MinWord( (word)nBytes, (word)(GIA_AIGER_OUT_SIZE - p->nBuffer) );
+        memcpy( p->pBuffer + p->nBuffer, pChars, nCopy );
+        p->nBuffer += (int)nCopy;
+        pChars += nCopy;
+        nBytes -= nCopy;
+        if ( p->nBuffer == GIA_AIGER_OUT_SIZE )
+            Gia_AigerOutFlush( p );
+    }
+}
+static void Gia_AigerOutPrintf( Gia_AigerOut_t * p, const char * pFormat, ... )
+{
+    char Buffer[1000], * pStr = Buffer;
+    int nChars;
+    va_list args;
+    va_start( args, pFormat );
+    nChars = vsnprintf( Buffer, sizeof(Buffer), pFormat, args );
+    va_end( args );
+    if ( nChars >= (int)sizeof(Buffer) )
+    {
+        pStr = ABC_ALLOC( char, nChars + 1 );
+        va_start( args, pFormat );
+        vsnprintf( pStr, nChars + 1, pFormat, args );
+        va_end( args );
+    }
+    Gia_AigerOutWrite( p, pStr, (size_t)nChars );
+    if ( pStr != Buffer )
+        ABC_FREE( pStr );
+}
+static void Gia_AigerOutWriteInt( Gia_AigerOut_t * p, int Value )
+{
+    unsigned char Buffer[5];
+    Gia_AigerWriteInt( Buffer, Value );
+    Gia_AigerOutWrite( p, Buffer, 4 );
+}
+static inline void Gia_AigerOutWriteUnsigned( Gia_AigerOut_t * p, unsigned x )
+{
+    if ( p->nBuffer > GIA_AIGER_OUT_SIZE - 8 )
+        Gia_AigerOutFlush( p );
+    p->nBuffer = Gia_AigerWriteUnsignedBuffer( p->pBuffer, p->nBuffer, x );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
 
-  Description []
+  Description [Writes into the stream. Returns 1 on success.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
+static int Gia_AigerWriteOut( Gia_Man_t * pInit, Gia_AigerOut_t * pOut, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
 {
     int fVerbose = XAIG_VERBOSE;
-    FILE * pFile;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
-    unsigned char * pBuffer;
+    int i;
     unsigned uLit0, uLit1, uLit;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
 
     if ( Gia_ManCoNum(pInit) == 0 )
     {
         printf( "AIG cannot be written because it has no POs.\n" );
-        return;
-    }
-
-    // start the output stream
-    pFile = fopen( pFileName, "wb" );
-    if ( pFile == NULL )
-    {
-        fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
-        return;
+        return 0;
     }
 
     // create normalized AIG
@@ -1435,7 +1756,7 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u", 
+    Gia_AigerOutPrintf( pOut, "aig%s %u %u %u %u %u", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1444,55 +1765,39 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         Gia_ManAndNum(p) );
     // write the extended header "B C J F"
     if ( Gia_ManConstrNum(p) )
-        fprintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
-    fprintf( pFile, "\n" ); 
+        Gia_AigerOutPrintf( pOut, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
+    Gia_AigerOutPrintf( pOut, "\n" ); 
 
     Gia_ManInvertConstraints( p );
     if ( !fCompact ) 
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pOut, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pOut, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
         Vec_Int_t * vLits = Gia_AigerCollectLiterals( p );
         Vec_Str_t * vBinary = Gia_AigerWriteLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+    // write the nodes into the stream
     Gia_ManForEachAnd( p, pObj, i )
     {
         uLit  = Abc_Var2Lit( i, 0 );
         uLit0 = Gia_ObjFaninLit0( pObj, i );
         uLit1 = Gia_ObjFaninLit1( pObj, i );
         assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
-        }
+        Gia_AigerOutWriteUnsigned( pOut, uLit  - uLit1 );
+        Gia_AigerOutWriteUnsigned( pOut, uLit1 - uLit0 );
     }
-    assert( Pos < nBufferSize );
-
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1501,13 +1806,13 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigerOutPrintf( pOut, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigerOutPrintf( pOut, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigerOutPrintf( pOut, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
     }
     if ( p->vNamesNode && Vec_PtrSize(p->vNamesNode) != Gia_ManObjNum(p) )
         Abc_Print( 0, "The size of the node name array does not match the number of objects. Names are not written.\n" );
@@ -1515,38 +1820,38 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     {
         Gia_ManForEachAnd( p, pObj, i )
             if ( Vec_PtrEntry(p->vNamesNode, i) )
-                fprintf( pFile, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
+                Gia_AigerOutPrintf( pOut, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
     }
 
     // write the comment
     if ( fWriteNewLine ) 
-        fprintf( pFile, "c\n" );
+        Gia_AigerOutPrintf( pOut, "c\n" );
     else
-        fprintf( pFile, "c" );
+        Gia_AigerOutPrintf( pOut, "c" );
 
     // write additional AIG
     if ( p->pAigExtra )
     {
-        fprintf( pFile, "a" );
+        Gia_AigerOutPrintf( pOut, "a" );
         vStrExt = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"a\".\n" );
     }
     // write constraints
     if ( p->nConstrs )
     {
-        fprintf( pFile, "c" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nConstrs );
+        Gia_AigerOutPrintf( pOut, "c" );
+        Gia_AigerOutWriteInt( pOut, 4 );
+        Gia_AigerOutWriteInt( pOut, p->nConstrs );
     }
     // write timing information
     if ( p->nAnd2Delay )
     {
-        fprintf( pFile, "d" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nAnd2Delay );
+        Gia_AigerOutPrintf( pOut, "d" );
+        Gia_AigerOutWriteInt( pOut, 4 );
+        Gia_AigerOutWriteInt( pOut, p->nAnd2Delay );
     }
     if ( p->pManTime )
     {
@@ -1556,9 +1861,9 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         {
             int nPis = Tim_ManPiNum((Tim_Man_t *)p->pManTime);
             int nFlops = Gia_ManRegNum(p);
-            fprintf( pFile, "i" );
-            Gia_FileWriteBufferSize( pFile, 4*(nPis + nFlops) );
-            fwrite( pTimes, 1, 4*(nPis + nFlops), pFile );
+            Gia_AigerOutPrintf( pOut, "i" );
+            Gia_AigerOutWriteInt( pOut, 4*(nPis + nFlops) );
+            Gia_AigerOutWrite( pOut, pTimes, 4*(nPis + nFlops) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"i\" (PIs+Flops).\n" );
         }
@@ -1574,9 +1879,9 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
                     if ( pTimes[i] >= TIM_ETERNITY )
                         pTimes[i] = -1.0;
             }
-            fprintf( pFile, "o" );
-            Gia_FileWriteBufferSize( pFile, 4*(nPos + nFlops) );
-            fwrite( pTimes, 1, 4*(nPos + nFlops), pFile );
+            Gia_AigerOutPrintf( pOut, "o" );
+            Gia_AigerOutWriteInt( pOut, 4*(nPos + nFlops) );
+            Gia_AigerOutWrite( pOut, pTimes, 4*(nPos + nFlops) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"o\" (POs+Flops).\n" );
         }
@@ -1585,38 +1890,38 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     //if ( p->pReprs && p->pNexts )
     //{
     //    extern Vec_Str_t * Gia_WriteEquivClasses( Gia_Man_t * p );
-    //    fprintf( pFile, "e" );
+    //    Gia_AigerOutPrintf( pOut, "e" );
     //    vStrExt = Gia_WriteEquivClasses( p );
-    //    Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-    //    fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+    //    Gia_AigerOutWriteInt( pOut, Vec_StrSize(vStrExt) );
+    //    Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
     //    Vec_StrFree( vStrExt );
     //}
     // write flop classes
     if ( p->vFlopClasses )
     {
         int i;
-        fprintf( pFile, "f" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vFlopClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vFlopClasses) );
+        Gia_AigerOutPrintf( pOut, "f" );
+        Gia_AigerOutWriteInt( pOut, 4*(Vec_IntSize(p->vFlopClasses)+1) );
+        Gia_AigerOutWriteInt( pOut, Vec_IntSize(p->vFlopClasses) );
         for ( i = 0; i < Vec_IntSize(p->vFlopClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vFlopClasses, i) );
+            Gia_AigerOutWriteInt( pOut, Vec_IntEntry(p->vFlopClasses, i) );
         if ( fVerbose ) printf( "Finished writing extension \"f\".\n" );
     }
     // write gate classes
     if ( p->vGateClasses )
     {
-        fprintf( pFile, "g" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "g" );
+        Gia_AigerOutWriteInt( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vGateClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vGateClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vGateClasses), 4*Gia_ManObjNum(p) );
     }
     // write hierarchy info
     if ( p->pManTime )
     {
-        fprintf( pFile, "h" );
+        Gia_AigerOutPrintf( pOut, "h" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"h\".\n" );
     }
@@ -1624,10 +1929,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( p->vPacking )
     {
         extern Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking );
-        fprintf( pFile, "k" );
+        Gia_AigerOutPrintf( pOut, "k" );
         vStrExt = Gia_WritePacking( p->vPacking );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"k\".\n" );
     }
@@ -1636,11 +1941,11 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     {
         Vec_Int_t * vPairs = Gia_ManEdgeToArray( p );
         int i;
-        fprintf( pFile, "w" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(vPairs)/2 );
+        Gia_AigerOutPrintf( pOut, "w" );
+        Gia_AigerOutWriteInt( pOut, 4*(Vec_IntSize(vPairs)+1) );
+        Gia_AigerOutWriteInt( pOut, Vec_IntSize(vPairs)/2 );
         for ( i = 0; i < Vec_IntSize(vPairs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(vPairs, i) );
+            Gia_AigerOutWriteInt( pOut, Vec_IntEntry(vPairs, i) );
         Vec_IntFree( vPairs );
     }
     // write mapping
@@ -1649,10 +1954,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         extern Vec_Str_t * Gia_AigerWriteMapping( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingSimple( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "m" );
+        Gia_AigerOutPrintf( pOut, "m" );
         vStrExt = Gia_AigerWriteMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"m\".\n" );
     }
@@ -1660,10 +1965,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( Gia_ManHasCellMapping(p) )
     {
         extern Vec_Str_t * Gia_AigerWriteCellMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "M" );
+        Gia_AigerOutPrintf( pOut, "M" );
         vStrExt = Gia_AigerWriteCellMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"M\".\n" );
 
@@ -1671,41 +1976,41 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     // write placement
     if ( p->pPlacement )
     {
-        fprintf( pFile, "p" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
-        fwrite( p->pPlacement, 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pOut, "p" );
+        Gia_AigerOutWriteInt( pOut, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pOut, p->pPlacement, 4*Gia_ManObjNum(p) );
     }
     // write register classes
     if ( p->vRegClasses )
     {
         int i;
-        fprintf( pFile, "r" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
+        Gia_AigerOutPrintf( pOut, "r" );
+        Gia_AigerOutWriteInt( pOut, 4*(Vec_IntSize(p->vRegClasses)+1) );
+        Gia_AigerOutWriteInt( pOut, Vec_IntSize(p->vRegClasses) );
         for ( i = 0; i < Vec_IntSize(p->vRegClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
+            Gia_AigerOutWriteInt( pOut, Vec_IntEntry(p->vRegClasses, i) );
         if ( fVerbose ) printf( "Finished writing extension \"r\".\n" );
     }
     // write register inits
     if ( p->vRegInits )
     {
         int i;
-        fprintf( pFile, "s" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegInits) );
+        Gia_AigerOutPrintf( pOut, "s" );
+        Gia_AigerOutWriteInt( pOut, 4*(Vec_IntSize(p->vRegInits)+1) );
+        Gia_AigerOutWriteInt( pOut, Vec_IntSize(p->vRegInits) );
         for ( i = 0; i < Vec_IntSize(p->vRegInits); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegInits, i) );
+            Gia_AigerOutWriteInt( pOut, Vec_IntEntry(p->vRegInits, i) );
     }
     // write configuration data
     if ( p->vConfigs )
     {
-        fprintf( pFile, "b" );
+        Gia_AigerOutPrintf( pOut, "b" );
         assert( p->pCellStr != NULL );
-        Gia_FileWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
-        fwrite( p->pCellStr, 1, strlen(p->pCellStr) + 1, pFile );
-//        fwrite( Vec_IntArray(p->vConfigs), 1, 4*Vec_IntSize(p->vConfigs), pFile );
+        Gia_AigerOutWriteInt( pOut, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
+        Gia_AigerOutWrite( pOut, p->pCellStr, strlen(p->pCellStr) + 1 );
+//        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vConfigs), 4*Vec_IntSize(p->vConfigs) );
         for ( i = 0; i < Vec_IntSize(p->vConfigs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vConfigs, i) );
+            Gia_AigerOutWriteInt( pOut, Vec_IntEntry(p->vConfigs, i) );
     }
     // write configuration data for extension "j"
     if ( p->vConfigs2 )
@@ -1748,7 +2053,7 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
                 assert( 0 ); // Unknown cell type
             nInstances++;
         }
-        fprintf( pFile, "j" );
+        Gia_AigerOutPrintf( pOut, "j" );
         // Calculate total size
         nTotalSize = 4;  // Reserved value
         nTotalSize += 4; // Number of cell types
@@ -1767,102 +2072,168 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         // Instance data
         nTotalSize += 4; // Total instances count
         nTotalSize += Vec_StrSize(p->vConfigs2); // Actual instance data
-        Gia_FileWriteBufferSize( pFile, nTotalSize );
+        Gia_AigerOutWriteInt( pOut, nTotalSize );
         // Write reserved value
-        Gia_FileWriteBufferSize( pFile, 0 );
+        Gia_AigerOutWriteInt( pOut, 0 );
         // Write number of cell types
-        Gia_FileWriteBufferSize( pFile, 3 );
+        Gia_AigerOutWriteInt( pOut, 3 );
         // Write cell type 0 (LUT4)
-        Gia_FileWriteBufferSize( pFile, 0 ); // CellId
-        fwrite( pCell0, 1, strlen(pCell0) + 1, pFile );
-        Gia_FileWriteBufferSize( pFile, 7 ); // 1 byte CellId + 4 bytes mapping + 2 bytes truth table
+        Gia_AigerOutWriteInt( pOut, 0 ); // CellId
+        Gia_AigerOutWrite( pOut, pCell0, strlen(pCell0) + 1 );
+        Gia_AigerOutWriteInt( pOut, 7 ); // 1 byte CellId + 4 bytes mapping + 2 bytes truth table
         // Write cell type 1 (S44)
-        Gia_FileWriteBufferSize( pFile, 1 ); // CellId
-        fwrite( pCell1, 1, strlen(pCell1) + 1, pFile );
-        Gia_FileWriteBufferSize( pFile, 12 ); // 1 byte CellId + 7 bytes mapping + 4 bytes truth tables
+        Gia_AigerOutWriteInt( pOut, 1 ); // CellId
+        Gia_AigerOutWrite( pOut, pCell1, strlen(pCell1) + 1 );
+        Gia_AigerOutWriteInt( pOut, 12 ); // 1 byte CellId + 7 bytes mapping + 4 bytes truth tables
         // Write cell type 2 (9-input)
-        Gia_FileWriteBufferSize( pFile, 2 ); // CellId
-        fwrite( pCell2, 1, strlen(pCell2) + 1, pFile );
-        Gia_FileWriteBufferSize( pFile, 14 ); // 1 byte CellId + 9 bytes mapping + 4 bytes truth tables
+        Gia_AigerOutWriteInt( pOut, 2 ); // CellId
+        Gia_AigerOutWrite( pOut, pCell2, strlen(pCell2) + 1 );
+        Gia_AigerOutWriteInt( pOut, 14 ); // 1 byte CellId + 9 bytes mapping + 4 bytes truth tables
         // Write total instances
-        Gia_FileWriteBufferSize( pFile, nInstances );
+        Gia_AigerOutWriteInt( pOut, nInstances );
         // Write instance data as raw bytes
-        fwrite( Vec_StrArray(p->vConfigs2), 1, Vec_StrSize(p->vConfigs2), pFile );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(p->vConfigs2), Vec_StrSize(p->vConfigs2) );
     }
     // write choices
     if ( Gia_ManHasChoices(p) )
     {
         int i, nPairs = 0;
-        fprintf( pFile, "q" );
+        Gia_AigerOutPrintf( pOut, "q" );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             nPairs += (Gia_ObjSibl(p, i) > 0);
-        Gia_FileWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
-        Gia_FileWriteBufferSize( pFile, nPairs );
+        Gia_AigerOutWriteInt( pOut, 4*(nPairs * 2 + 1) );
+        Gia_AigerOutWriteInt( pOut, nPairs );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             if ( Gia_ObjSibl(p, i) )
             {
                 assert( i > Gia_ObjSibl(p, i) );
-                Gia_FileWriteBufferSize( pFile, i );
-                Gia_FileWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
+                Gia_AigerOutWriteInt( pOut, i );
+                Gia_AigerOutWriteInt( pOut, Gia_ObjSibl(p, i) );
             }
         if ( fVerbose ) printf( "Finished writing extension \"q\".\n" );
     }
     // write switching activity
     if ( p->pSwitching )
     {
-        fprintf( pFile, "u" );
-        Gia_FileWriteBufferSize( pFile, Gia_ManObjNum(p) );
-        fwrite( p->pSwitching, 1, Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pOut, "u" );
+        Gia_AigerOutWriteInt( pOut, Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pOut, p->pSwitching, Gia_ManObjNum(p) );
     }
 /*
     // write timing information
     if ( p->pManTime )
     {
-        fprintf( pFile, "t" );
+        Gia_AigerOutPrintf( pOut, "t" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
 */
     // write object classes
     if ( p->vObjClasses )
     {
-        fprintf( pFile, "v" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "v" );
+        Gia_AigerOutWriteInt( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vObjClasses), 4*Gia_ManObjNum(p) );
     }
     // write object classes
     if ( p->vEquLitIds )
     {
-        fprintf( pFile, "y" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "y" );
+        Gia_AigerOutWriteInt( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vEquLitIds) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vEquLitIds), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vEquLitIds), 4*Gia_ManObjNum(p) );
         if ( fVerbose ) printf( "Finished writing extension \"y\".\n" );
     }
     // write name
     if ( p->pName )
     {
-        fprintf( pFile, "n" );
-        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
-        fwrite( p->pName, 1, strlen(p->pName), pFile );
-        fprintf( pFile, "%c", '\0' );
+        Gia_AigerOutPrintf( pOut, "n" );
+        Gia_AigerOutWriteInt( pOut, strlen(p->pName)+1 );
+        Gia_AigerOutWrite( pOut, p->pName, strlen(p->pName) );
+        Gia_AigerOutPrintf( pOut, "%c", '\0' );
     }
     // write comments
     if ( fWriteNewLine )
-        fprintf( pFile, "c\n" );
+        Gia_AigerOutPrintf( pOut, "c\n" );
     if ( !fSkipComment ) {
-        fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-        fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+        Gia_AigerOutPrintf( pOut, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+        Gia_AigerOutPrintf( pOut, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
     }
-    fclose( pFile );
     if ( p != pInit )
     {
         Gia_ManTransferTiming( pInit, p );
         Gia_ManStop( p );
     }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG in the binary AIGER format.]
+
+  Description [Writes into the file opened by the caller, which makes it
+  possible to embed the AIG into a larger container. Returns 1 on success.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_AigerWriteFile( Gia_Man_t * pInit, FILE * pFile, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
+{
+    Gia_AigerOut_t * pOut = Gia_AigerOutStart( pFile, NULL );
+    int RetValue = Gia_AigerWriteOut( pInit, pOut, fWriteSymbols, fCompact, fWriteNewLine, fSkipComment );
+    if ( !Gia_AigerOutStop( pOut ) && RetValue )
+    {
+        printf( "Gia_AigerWrite(): I/O error writing the output file.\n" );
+        RetValue = 0;
+    }
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG in the binary AIGER format.]
+
+  Description [If the file name ends in ".gz", the file is compressed.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
+{
+    Gia_AigerOut_t * pOut;
+    FILE * pFile = NULL;
+    gzFile pGzFile = NULL;
+    int RetValue;
+    if ( Gia_ManCoNum(pInit) == 0 )
+    {
+        printf( "AIG cannot be written because it has no POs.\n" );
+        return;
+    }
+    // start the output stream
+    if ( Gia_FileIsGz(pFileName) )
+        pGzFile = gzopen( pFileName, "wb" );
+    else
+        pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL && pGzFile == NULL )
+    {
+        fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
+        return;
+    }
+    pOut = Gia_AigerOutStart( pFile, pGzFile );
+    RetValue = Gia_AigerWriteOut( pInit, pOut, fWriteSymbols, fCompact, fWriteNewLine, fSkipComment );
+    if ( !Gia_AigerOutStop( pOut ) && RetValue )
+        fprintf( stdout, "Gia_AigerWrite(): I/O error writing the output file \"%s\".\n", pFileName );
+    if ( pGzFile )
+        gzclose( pGzFile );
+    else
+        fclose( pFile );
 }
 
 /**Function*************************************************************
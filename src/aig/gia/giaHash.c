@@ -104,9 +104,11 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 ***********************************************************************/
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
+    int nSize = Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc );
     assert( Vec_IntSize(&p->vHTable) == 0 );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
-    Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
+    Gia_ManRecycleIntGrow( &p->vHTable, nSize );
+    Vec_IntFill( &p->vHTable, nSize, 0 );
+    Gia_ManRecycleIntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
     Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
 //printf( "Alloced table with %d entries.\n", Vec_IntSize(&p->vHTable) );
 }
@@ -148,8 +150,8 @@ void Gia_ManHashStart( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashStop( Gia_Man_t * p )  
 {
-    Vec_IntErase( &p->vHTable );
-    Vec_IntErase( &p->vHash );
+    Gia_ManRecycleIntErase( &p->vHTable );
+    Gia_ManRecycleIntErase( &p->vHash );
 }
 
 /**Function*************************************************************
@@ -0,0 +1,311 @@
+/**CFile****************************************************************
+
+  FileName    [giaHashMt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Concurrent structural hashing.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: giaHashMt.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the concurrent mode is only available with the compilers providing atomic builtins
+#if defined(ABC_USE_PTHREADS) && (defined(__GNUC__) || defined(__clang__))
+#define GIA_HASH_MT_ATOMIC
+#endif
+
+#ifdef GIA_HASH_MT_ATOMIC
+#define Gia_HashMtLoad( pVar )                  __atomic_load_n( pVar, __ATOMIC_ACQUIRE )
+#define Gia_HashMtStore( pVar, Value )          __atomic_store_n( pVar, Value, __ATOMIC_RELEASE )
+#define Gia_HashMtCas( pVar, pOld, New )        __atomic_compare_exchange_n( pVar, pOld, New, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+#define Gia_HashMtFetchAdd( pVar, Value )       __atomic_fetch_add( pVar, Value, __ATOMIC_RELAXED )
+#else
+#define Gia_HashMtLoad( pVar )                  (*(pVar))
+#define Gia_HashMtStore( pVar, Value )          (*(pVar) = (Value))
+#define Gia_HashMtCas( pVar, pOld, New )        (*(pVar) == *(pOld) ? (*(pVar) = (New), 1) : (*(pOld) = *(pVar), 0))
+#define Gia_HashMtFetchAdd( pVar, Value )       ((*(pVar) += (Value)) - (Value))
+#endif
+
+struct Gia_HashMt_t_
+{
+    Gia_Man_t *    pGia;       // the manager
+    word *         pKeys;      // the pairs of fanin literals (0 if the slot is empty)
+    int *          pVals;      // the object IDs (0 if the object is being created)
+    word           Mask;       // the table size minus one
+    int            nObjsMax;   // the largest number of objects
+};
+
+static inline word Gia_HashMtKey( int iLit0, int iLit1 )       { return ((word)iLit0 << 32) | (word)(unsigned)iLit1;    }
+static inline word Gia_HashMtSlot( Gia_HashMt_t * p, word Key ) { return ((Key * ABC_CONST(0x9E3779B97F4A7C15)) >> 17) & p->Mask; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the concurrent hash table.]
+
+  Description [Reserves the object storage for up to nObjsMax objects, so
+  that the objects can be allocated by several threads without moving
+  the array, and hashes the AND gates already present in the manager.
+  While the table is in use, the manager should not be modified by other
+  means; the regular hash table (Gia_ManHashAlloc) should not be started.
+  Only plain AIGs are supported (no MUXes/XORs, fanouts, built-in
+  simulation, etc).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_HashMt_t * Gia_ManHashMtStart( Gia_Man_t * pGia, int nObjsMax )
+{
+    Gia_HashMt_t * p;
+    Gia_Obj_t * pObj;
+    word nSize = 1;
+    int i;
+    assert( Vec_IntSize(&pGia->vHTable) == 0 );
+    assert( pGia->pMuxes == NULL && pGia->pFanData == NULL && !pGia->fSweeper && !pGia->fBuiltInSim && pGia->vSuppWords == NULL );
+    nObjsMax = Abc_MaxInt( nObjsMax, Gia_ManObjNum(pGia) );
+    if ( pGia->nObjsAlloc < nObjsMax )
+    {
+        pGia->pObjs = ABC_REALLOC( Gia_Obj_t, pGia->pObjs, nObjsMax );
+        memset( pGia->pObjs + pGia->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjsMax - pGia->nObjsAlloc) );
+        pGia->nObjsAlloc = nObjsMax;
+    }
+    while ( nSize < 2 * (word)nObjsMax )
+        nSize <<= 1;
+    p = ABC_CALLOC( Gia_HashMt_t, 1 );
+    p->pGia     = pGia;
+    p->pKeys    = ABC_CALLOC( word, nSize );
+    p->pVals    = ABC_CALLOC( int, nSize );
+    p->Mask     = nSize - 1;
+    p->nObjsMax = nObjsMax;
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        word Key = Gia_HashMtKey( Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i) );
+        word s = Gia_HashMtSlot( p, Key );
+        while ( p->pKeys[s] && p->pKeys[s] != Key )
+            s = (s + 1) & p->Mask;
+        if ( p->pKeys[s] == 0 )
+            p->pKeys[s] = Key, p->pVals[s] = i;
+    }
+    return p;
+}
+void Gia_ManHashMtStop( Gia_HashMt_t * p )
+{
+    ABC_FREE( p->pKeys );
+    ABC_FREE( p->pVals );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the AND gate or returns the existing one.]
+
+  Description [Can be called by several threads at the same time. The
+  slot is claimed by a compare-and-swap on the key; the thread that wins
+  allocates the object by atomically incrementing the object counter and
+  publishes its ID, while other threads looking for the same gate wait
+  until the ID becomes available. Because the fanins of a new gate have
+  been allocated before the gate, the objects remain topologically sorted.
+  Returns -1 if the reserved storage is exhausted; in this case, the
+  manager should be discarded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManHashMtAnd( Gia_HashMt_t * p, int iLit0, int iLit1 )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Gia_Obj_t * pObj;
+    word Key, KeyOld, s;
+    int iObj;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = Gia_HashMtKey( iLit0, iLit1 );
+    for ( s = Gia_HashMtSlot( p, Key ); ; s = (s + 1) & p->Mask )
+    {
+        KeyOld = Gia_HashMtLoad( p->pKeys + s );
+        if ( KeyOld == 0 && Gia_HashMtCas( p->pKeys + s, &KeyOld, Key ) )
+            break;
+        if ( KeyOld != Key )
+            continue;
+        // the gate exists or is being created by another thread
+        while ( (iObj = Gia_HashMtLoad( p->pVals + s )) == 0 );
+        return iObj < 0 ? -1 : Abc_Var2Lit( iObj, 0 );
+    }
+    // the slot is claimed by this thread
+    iObj = Gia_HashMtFetchAdd( &pGia->nObjs, 1 );
+    if ( iObj >= p->nObjsMax )
+    {
+        Gia_HashMtStore( p->pVals + s, -1 );
+        return -1;
+    }
+    pObj = Gia_ManObj( pGia, iObj );
+    pObj->iDiff0  = (unsigned)(iObj - Abc_Lit2Var(iLit0));
+    pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
+    pObj->iDiff1  = (unsigned)(iObj - Abc_Lit2Var(iLit1));
+    pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+    Gia_HashMtStore( p->pVals + s, iObj );
+    return Abc_Var2Lit( iObj, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes the AIG using several threads.]
+
+  Description [The AND gates are processed level by level; the gates of
+  one level are distributed among the tasks of the thread pool, which
+  strash them into the shared manager through the concurrent hash table.
+  The same task group is used for all levels, so the worker threads are
+  started only once. The result is reordered in the DFS order, so it does 
+  not depend on the number of threads or on their timing. If the reserved
+  object storage is exhausted, which should not happen because rehashing
+  does not add gates, the AIG is rehashed sequentially.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_HashMtThData_t_ Gia_HashMtThData_t;
+struct Gia_HashMtThData_t_
+{
+    Gia_Man_t *    p;          // the old manager
+    Gia_HashMt_t * pHash;      // the concurrent table of the new manager
+    Vec_Int_t *    vLevel;     // the gates of the current level
+    int            iThread;    // the thread number
+    int            nThreads;   // the number of threads
+    int            fOverflow;  // the object storage is exhausted
+};
+static int Gia_ManRehashMtLevel( void * pArg )
+{
+    Gia_HashMtThData_t * pThData = (Gia_HashMtThData_t *)pArg;
+    Gia_Obj_t * pObj;
+    int nSize  = Vec_IntSize( pThData->vLevel );
+    int iStart = (int)((word)nSize * pThData->iThread / pThData->nThreads);
+    int iStop  = (int)((word)nSize * (pThData->iThread + 1) / pThData->nThreads);
+    int i;
+    for ( i = iStart; i < iStop; i++ )
+    {
+        pObj = Gia_ManObj( pThData->p, Vec_IntEntry(pThData->vLevel, i) );
+        pObj->Value = Gia_ManHashMtAnd( pThData->pHash, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        if ( (int)pObj->Value == -1 )
+        {
+            pThData->fOverflow = 1;
+            break;
+        }
+    }
+    return 1;
+}
+Gia_Man_t * Gia_ManRehashMt( Gia_Man_t * p, int nThreads )
+{
+    Gia_HashMtThData_t * ThData;
+    Util_PoolGroup_t * pGroup = NULL;
+    Gia_Man_t * pNew, * pTemp;
+    Gia_HashMt_t * pHash;
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    Gia_Obj_t * pObj;
+    int i, k, fOverflow = 0;
+    assert( p->pMuxes == NULL && Gia_ManBufNum(p) == 0 );
+    nThreads = Abc_MaxInt( nThreads, 1 );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    // group the gates by level
+    vLevels = Vec_WecStart( Gia_ManLevelNum(p) + 1 );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_WecPush( vLevels, Gia_ObjLevelId(p, i), i );
+    // strash the levels
+    pHash = Gia_ManHashMtStart( pNew, Gia_ManObjNum(p) );
+    ThData = ABC_CALLOC( Gia_HashMtThData_t, nThreads );
+    for ( k = 0; k < nThreads; k++ )
+    {
+        ThData[k].p        = p;
+        ThData[k].pHash    = pHash;
+        ThData[k].iThread  = k;
+        ThData[k].nThreads = nThreads;
+    }
+#ifdef GIA_HASH_MT_ATOMIC
+    if ( nThreads > 1 )
+        pGroup = Util_PoolGroupStart( nThreads, 0 );
+#endif
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        for ( k = 0; k < nThreads; k++ )
+            ThData[k].vLevel = vLevel;
+        if ( pGroup && Vec_IntSize(vLevel) >= 64 * nThreads )
+        {
+            for ( k = 0; k < nThreads; k++ )
+                Util_PoolGroupAdd( pGroup, Gia_ManRehashMtLevel, (void *)(ThData + k) );
+            Util_PoolGroupWait( pGroup );
+        }
+        else
+        {
+            for ( k = 0; k < nThreads; k++ )
+                Gia_ManRehashMtLevel( (void *)(ThData + k) );
+        }
+        for ( k = 0; k < nThreads; k++ )
+            fOverflow |= ThData[k].fOverflow;
+        if ( fOverflow )
+            break;
+    }
+    if ( pGroup )
+        Util_PoolGroupStop( pGroup );
+    Gia_ManHashMtStop( pHash );
+    Vec_WecFree( vLevels );
+    ABC_FREE( ThData );
+    if ( fOverflow )
+    {
+        Abc_Print( 1, "Gia_ManRehashMt(): The object storage is exhausted. Rehashing sequentially.\n" );
+        Gia_ManStop( pNew );
+        return Gia_ManRehash( p, 0 );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    pNew = Gia_ManDupDfs( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
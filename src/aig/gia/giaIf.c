@@ -69,6 +69,7 @@ void Gia_ManSetIfParsDefault( void * pp )
     p->nCutsMax    =  8;
     p->nFlowIters  =  1;
     p->nAreaIters  =  2;
+    p->nProcs      =  1;
     p->DelayTarget = -1;
     p->Epsilon     =  (float)0.005;
     p->fPreprocess =  1;
@@ -79,6 +80,7 @@ void Gia_ManSetIfParsDefault( void * pp )
     p->fEdge       =  1;
     p->fPower      =  0;
     p->fCutMin     =  0;
+    p->fTtShared   =  1;
     p->fVerbose    =  0;
     p->pLutStruct  =  NULL;
     // internal parameters
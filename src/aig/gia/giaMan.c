@@ -30,6 +30,14 @@
 #include <windows.h>
 #endif
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -39,10 +47,139 @@ ABC_NAMESPACE_IMPL_START
 
 extern void Gia_ManDfsSlacksPrint( Gia_Man_t * p );
 
+// the arrays freed by the AIG managers, which are reused by the next managers
+#define GIA_RECYCLE_MAX   8          // the largest number of arrays kept
+#define GIA_RECYCLE_MIN   (1 << 16)  // the smallest array kept (in bytes)
+#define GIA_RECYCLE_LIM   (1 << 28)  // the largest total size of arrays kept (in bytes)
+typedef struct Gia_Recycle_t_ Gia_Recycle_t;
+struct Gia_Recycle_t_
+{
+    void *         pArrays[GIA_RECYCLE_MAX]; // the arrays
+    size_t         nBytes[GIA_RECYCLE_MAX];  // the array sizes
+    int            nArrays;                  // the number of arrays
+    size_t         nBytesAll;                // the total size of the arrays
+    int            nReused;                  // the number of arrays reused
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;                   // protects the arrays
+#endif
+};
+#ifdef ABC_USE_PTHREADS
+static Gia_Recycle_t s_GiaRecycle = { {NULL}, {0}, 0, 0, 0, PTHREAD_MUTEX_INITIALIZER };
+#define GIA_RECYCLE_LOCK()    pthread_mutex_lock( &s_GiaRecycle.Mutex )
+#define GIA_RECYCLE_UNLOCK()  pthread_mutex_unlock( &s_GiaRecycle.Mutex )
+#else
+static Gia_Recycle_t s_GiaRecycle = { {NULL}, {0}, 0, 0, 0 };
+#define GIA_RECYCLE_LOCK()
+#define GIA_RECYCLE_UNLOCK()
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Recycles the large arrays of the AIG managers.]
+
+  Description [Scripts performing many consecutive duplications free an
+  AIG and immediately allocate another one of a similar size. Instead of
+  returning the object arrays and the hash tables to the system, the
+  managers leave them here, and the next manager takes an array that
+  is not smaller than requested and not more than twice larger. The
+  memory returned by Gia_ManRecycleAlloc() is zeroed only if fClean is
+  set. At most GIA_RECYCLE_MAX arrays of GIA_RECYCLE_LIM bytes in total
+  are kept, and the arrays freed beyond this limit are returned to the
+  system. The arrays are released by Gia_ManRecycleStop().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_ManRecycleAlloc( size_t nBytes, int fClean )
+{
+    void * pArray = NULL;
+    int i, iBest = -1;
+    if ( nBytes >= GIA_RECYCLE_MIN )
+    {
+        GIA_RECYCLE_LOCK();
+        for ( i = 0; i < s_GiaRecycle.nArrays; i++ )
+            if ( s_GiaRecycle.nBytes[i] >= nBytes && s_GiaRecycle.nBytes[i] <= 2 * nBytes &&
+                 (iBest == -1 || s_GiaRecycle.nBytes[i] < s_GiaRecycle.nBytes[iBest]) )
+                iBest = i;
+        if ( iBest >= 0 )
+        {
+            pArray = s_GiaRecycle.pArrays[iBest];
+            s_GiaRecycle.nBytesAll -= s_GiaRecycle.nBytes[iBest];
+            s_GiaRecycle.nArrays--;
+            s_GiaRecycle.pArrays[iBest] = s_GiaRecycle.pArrays[s_GiaRecycle.nArrays];
+            s_GiaRecycle.nBytes[iBest]  = s_GiaRecycle.nBytes[s_GiaRecycle.nArrays];
+            s_GiaRecycle.nReused++;
+        }
+        GIA_RECYCLE_UNLOCK();
+    }
+    if ( pArray == NULL )
+        return fClean ? ABC_CALLOC( char, nBytes ) : ABC_ALLOC( char, nBytes );
+    if ( fClean )
+        memset( pArray, 0, nBytes );
+    return pArray;
+}
+void Gia_ManRecycleFree( void * pArray, size_t nBytes )
+{
+    if ( pArray == NULL )
+        return;
+    if ( nBytes < GIA_RECYCLE_MIN )
+    {
+        ABC_FREE( pArray );
+        return;
+    }
+    GIA_RECYCLE_LOCK();
+    if ( s_GiaRecycle.nArrays < GIA_RECYCLE_MAX && s_GiaRecycle.nBytesAll + nBytes <= GIA_RECYCLE_LIM )
+    {
+        s_GiaRecycle.pArrays[s_GiaRecycle.nArrays] = pArray;
+        s_GiaRecycle.nBytes[s_GiaRecycle.nArrays++] = nBytes;
+        s_GiaRecycle.nBytesAll += nBytes;
+        pArray = NULL;
+    }
+    GIA_RECYCLE_UNLOCK();
+    ABC_FREE( pArray );
+}
+void Gia_ManRecycleIntErase( Vec_Int_t * p )
+{
+    Gia_ManRecycleFree( p->pArray, sizeof(int) * (size_t)p->nCap );
+    p->pArray = NULL;
+    p->nSize  = 0;
+    p->nCap   = 0;
+}
+void Gia_ManRecycleIntGrow( Vec_Int_t * p, int nCapMin )
+{
+    if ( p->pArray == NULL && nCapMin > 0 )
+    {
+        p->pArray = (int *)Gia_ManRecycleAlloc( sizeof(int) * (size_t)nCapMin, 0 );
+        p->nCap   = nCapMin;
+    }
+    else
+        Vec_IntGrow( p, nCapMin );
+}
+int Gia_ManRecycleReuseNum()
+{
+    return s_GiaRecycle.nReused;
+}
+size_t Gia_ManRecycleByteNum()
+{
+    return s_GiaRecycle.nBytesAll;
+}
+void Gia_ManRecycleStop()
+{
+    int i;
+    GIA_RECYCLE_LOCK();
+    for ( i = 0; i < s_GiaRecycle.nArrays; i++ )
+        ABC_FREE( s_GiaRecycle.pArrays[i] );
+    s_GiaRecycle.nArrays = 0;
+    s_GiaRecycle.nBytesAll = 0;
+    GIA_RECYCLE_UNLOCK();
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates AIG.]
@@ -60,7 +197,7 @@ Gia_Man_t * Gia_ManStart( int nObjsMax )
     assert( nObjsMax > 0 );
     p = ABC_CALLOC( Gia_Man_t, 1 );
     p->nObjsAlloc = nObjsMax;
-    p->pObjs = ABC_CALLOC( Gia_Obj_t, nObjsMax );
+    p->pObjs = (Gia_Obj_t *)Gia_ManRecycleAlloc( sizeof(Gia_Obj_t) * (size_t)nObjsMax, 1 );
     p->pObjs->iDiff0 = p->pObjs->iDiff1 = GIA_NONE;
     p->nObjs = 1;
     p->vCis  = Vec_IntAlloc( nObjsMax / 20 );
@@ -155,8 +292,8 @@ void Gia_ManStop( Gia_Man_t * p )
     Gia_ManStopP( &p->pAigExtra );
     Vec_IntFree( p->vCis );
     Vec_IntFree( p->vCos );
-    Vec_IntErase( &p->vHash );
-    Vec_IntErase( &p->vHTable );
+    Gia_ManRecycleIntErase( &p->vHash );
+    Gia_ManRecycleIntErase( &p->vHTable );
     Vec_IntErase( &p->vRefs );
     Vec_StrFreeP( &p->vStopsF );
     Vec_StrFreeP( &p->vStopsB );    
@@ -176,7 +313,7 @@ void Gia_ManStop( Gia_Man_t * p )
     ABC_FREE( p->pRefs );
     ABC_FREE( p->pLutRefs );
     ABC_FREE( p->pMuxes );
-    ABC_FREE( p->pObjs );
+    Gia_ManRecycleFree( p->pObjs, sizeof(Gia_Obj_t) * (size_t)p->nObjsAlloc );
     ABC_FREE( p->pSpec );
     ABC_FREE( p->pName );
     ABC_FREE( p );
@@ -558,6 +695,8 @@ void Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars )
     if ( pPars && pPars->fCut )
         Abc_Print( 1, "  cut = %d(%d)", Gia_ManCrossCut(p, 0), Gia_ManCrossCut(p, 1) );
     Abc_Print( 1, "  mem =%5.2f MB", Gia_ManMemory(p)/(1<<20) );
+    if ( Gia_ManRecycleReuseNum() )
+        Abc_Print( 1, "  reuse = %d", Gia_ManRecycleReuseNum() );
     if ( Gia_ManHasChoices(p) )
         Abc_Print( 1, "  ch =%5d", Gia_ManChoiceNum(p) );
     if ( p->pManTime )
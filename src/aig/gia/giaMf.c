@@ -20,6 +20,8 @@
 
 #include "gia.h"
 #include "misc/vec/vecMem.h"
+#include "misc/vec/vecMemMt.h"
+#include "misc/vec/vecHsh.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
 #include "sat/cnf/cnf.h"
@@ -70,6 +72,7 @@ struct Mf_Man_t_
     Mf_Obj_t *      pLfObjs;        // best cuts
     Vec_Ptr_t       vPages;         // cut memory
     Vec_Mem_t *     vTtMem;         // truth tables
+    Vec_MemMt_t *   vTtMemMt;       // shared truth tables (vTtMem points to its memory)
     Vec_Int_t       vCnfSizes;      // handles to CNF
     Vec_Int_t       vCnfMem;        // memory for CNF
     Vec_Int_t       vTemp;          // temporary array
@@ -96,10 +99,13 @@ static inline int        Mf_CutFunc( int * pCut )                    { return ((
 static inline int        Mf_CutSetBoth( int n, int f )               { return n | (f << 5);                                            }
 static inline int        Mf_CutIsTriv( int * pCut, int i )           { return Mf_CutSize(pCut) == 1 && pCut[1] == i;                   } 
 
+static inline int        Mf_ManTtInsert( Mf_Man_t * p, word * pTruth ) { return p->vTtMemMt ? Vec_MemMtInsert(p->vTtMemMt, pTruth) : Vec_MemHashInsert(p->vTtMem, pTruth); }
+
 #define Mf_SetForEachCut( pList, pCut, i )      for ( i = 0, pCut = pList + 1; i < pList[0]; i++, pCut += Mf_CutSize(pCut) + 1 )
 #define Mf_ObjForEachCut( pCuts, i, nCuts )     for ( i = 0, i < nCuts; i++ )
 
 extern int Kit_TruthToGia( Gia_Man_t * pMan, unsigned * pTruth, int nVars, Vec_Int_t * vMemory, Vec_Int_t * vLeaves, int fHash );
+extern void * Abc_FrameReadTtStore( int nVars );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -556,7 +562,7 @@ static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t
     if ( !p->pPars->fCnfObjIds )
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Mf_ManTtInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt6CnfSize(t, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)&t, pCutR->nLeaves, &p->vCnfMem) );
@@ -587,7 +593,7 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Mf_ManTtInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)uTruth, pCutR->nLeaves, &p->vCnfMem) );
@@ -611,7 +617,7 @@ static inline int Mf_CutComputeTruthMux6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Mf_ManTtInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt6CnfSize(t, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)&t, pCutR->nLeaves, &p->vCnfMem) );
@@ -641,7 +647,7 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
     if ( fCompl ) Abc_TtNot( uTruth, nWords );
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Mf_ManTtInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)uTruth, pCutR->nLeaves, &p->vCnfMem) );
@@ -1393,7 +1399,13 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->clkStart  = Abc_Clock();
     p->pGia      = pGia;
     p->pPars     = pPars;
-    p->vTtMem    = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
+    // without CNF generation, the truth tables are shared with other mapping runs
+    if ( pPars->fCutMin && !pPars->fGenCnf && !pPars->fGenLit )
+        p->vTtMemMt = (Vec_MemMt_t *)Abc_FrameReadTtStore( Abc_MaxInt(6, pPars->nLutSize) );
+    if ( p->vTtMemMt )
+        p->vTtMem = Vec_MemMtMem( p->vTtMemMt );
+    else
+        p->vTtMem = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
     p->pLfObjs   = ABC_CALLOC( Mf_Obj_t, Gia_ManObjNum(pGia) );
     p->iCur      = 2;
     Vec_PtrGrow( &p->vPages, 256 );
@@ -1414,9 +1426,9 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
 void Mf_ManFree( Mf_Man_t * p )
 {
     assert( !p->pPars->fGenCnf || !p->pPars->fGenLit || Vec_IntSize(&p->vCnfSizes) == Vec_MemEntryNum(p->vTtMem) );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && p->vTtMemMt == NULL )
         Vec_MemHashFree( p->vTtMem );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && p->vTtMemMt == NULL )
         Vec_MemFree( p->vTtMem );
     Vec_PtrFreeData( &p->vPages );
     ABC_FREE( p->vCnfSizes.pArray );
@@ -1819,10 +1831,11 @@ void Mf_ManComputeMapping( Mf_Man_t * p )
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
-Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
+static Gia_Man_t * Mf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars, Vec_Int_t * vCiArrs )
 {
     Mf_Man_t * p;
     Gia_Man_t * pNew, * pCls;
+    int i, Id;
     if ( pPars->fGenCnf || pPars->fGenLit )
         pPars->fCutMin = 1;
     if ( Gia_ManHasChoices(pGia) )
@@ -1830,6 +1843,9 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
     pCls = pPars->fCoarsen ? Gia_ManDupMuxes(pGia, pPars->nCoarseLimit) : pGia;
     p = Mf_ManAlloc( pCls, pPars );
     p->pGia0 = pGia;
+    if ( vCiArrs )
+        Gia_ManForEachCiId( pCls, Id, i )
+            Mf_ManObj(p, Id)->Delay = Vec_IntEntry( vCiArrs, i );
     if ( pPars->fVerbose && pPars->fCoarsen )
     {
         printf( "Initial " );  Gia_ManPrintMuxStats( pGia );  printf( "\n" );
@@ -1862,6 +1878,364 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
         Gia_ManStop( pCls );
     return pNew;
 }
+Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
+{
+    return Mf_ManPerformMappingInt( pGia, pPars, NULL );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Incremental mapping after a small change of the design.]
+
+  Description [Matches the nodes of the new AIG (pGia) structurally 
+  against the nodes of the old mapped AIG (pOld); XORs and MUXes are also
+  matched by their control and data inputs, because coarsening changes 
+  their decomposition into AND gates. The LUTs of the old 
+  mapping, whose roots are matched and used in the new design, are reused 
+  as they are. The remaining nodes form the window, which is extracted 
+  into a separate AIG and mapped from scratch. The inputs of the window
+  are the roots of the reused LUTs and the CIs; their arrival times are 
+  the LUT levels of the corresponding nodes in the old mapping. Returns
+  the new AIG with the combined mapping.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Mf_ManEcoMapLit( Vec_Int_t * vMap, int iLit )
+{
+    int iLitOld = vMap ? Vec_IntEntry(vMap, Abc_Lit2Var(iLit)) : Abc_LitRegular(iLit);
+    return iLitOld == -1 ? -1 : Abc_LitNotCond( iLitOld, Abc_LitIsCompl(iLit) );
+}
+static int Mf_ManEcoNodeKey( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vMap, int fMux, int * pKey )
+{
+    int iLitC, iLitT, iLitE, fPhase = 0;
+    if ( !fMux )
+    {
+        int iLit0 = Mf_ManEcoMapLit( vMap, Gia_ObjFaninLit0p(p, pObj) );
+        int iLit1 = Mf_ManEcoMapLit( vMap, Gia_ObjFaninLit1p(p, pObj) );
+        if ( iLit0 == -1 || iLit1 == -1 )
+            return -1;
+        pKey[0] = 0;
+        pKey[1] = Abc_MinInt( iLit0, iLit1 );
+        pKey[2] = Abc_MaxInt( iLit0, iLit1 );
+        pKey[3] = 0;
+        return 0;
+    }
+    // the MUX is normalized to have the positive control and the positive else-input
+    iLitC = Mf_ManEcoMapLit( vMap, Gia_ObjRecognizeMuxLits(p, pObj, &iLitT, &iLitE) );
+    iLitT = Mf_ManEcoMapLit( vMap, iLitT );
+    iLitE = Mf_ManEcoMapLit( vMap, iLitE );
+    if ( iLitC == -1 || iLitT == -1 || iLitE == -1 )
+        return -1;
+    if ( Abc_LitIsCompl(iLitC) )
+    {
+        iLitC = Abc_LitNot(iLitC);
+        ABC_SWAP( int, iLitT, iLitE );
+    }
+    if ( iLitT == Abc_LitNot(iLitE) ) // XOR is symmetric in the inputs
+    {
+        fPhase = Abc_LitIsCompl(iLitE);
+        iLitE  = Abc_LitRegular(iLitE);
+        if ( iLitC > iLitE )
+            ABC_SWAP( int, iLitC, iLitE );
+        iLitT  = Abc_LitNot(iLitE);
+    }
+    else if ( Abc_LitIsCompl(iLitE) )
+        iLitT = Abc_LitNot(iLitT), iLitE = Abc_LitNot(iLitE), fPhase = 1;
+    pKey[0] = 1;
+    pKey[1] = iLitC;
+    pKey[2] = iLitT;
+    pKey[3] = iLitE;
+    return fPhase;
+}
+static int Mf_ManEcoCopyShared_rec( Gia_Man_t * pNew, Gia_Man_t * p, int iObj, Vec_Int_t * vLits )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    int iLit0, iLit1;
+    if ( Vec_IntEntry(vLits, iObj) >= 0 )
+        return Vec_IntEntry(vLits, iObj);
+    assert( Gia_ObjIsAnd(pObj) );
+    iLit0 = Mf_ManEcoCopyShared_rec( pNew, p, Gia_ObjFaninId0(pObj, iObj), vLits );
+    iLit1 = Mf_ManEcoCopyShared_rec( pNew, p, Gia_ObjFaninId1(pObj, iObj), vLits );
+    iLit0 = Gia_ManAppendAnd( pNew, Abc_LitNotCond(iLit0, Gia_ObjFaninC0(pObj)), Abc_LitNotCond(iLit1, Gia_ObjFaninC1(pObj)) );
+    Vec_IntWriteEntry( vLits, iObj, iLit0 );
+    return iLit0;
+}
+static int Mf_ManEcoCheckCone_rec( Gia_Man_t * p, Gia_Obj_t * pObj )
+{
+    if ( Gia_ObjIsTravIdCurrent(p, pObj) )
+        return 1;
+    Gia_ObjSetTravIdCurrent( p, pObj );
+    if ( !Gia_ObjIsAnd(pObj) )
+        return 0;
+    return Mf_ManEcoCheckCone_rec( p, Gia_ObjFanin0(pObj) ) && Mf_ManEcoCheckCone_rec( p, Gia_ObjFanin1(pObj) );
+}
+static int Mf_ManEcoCheckCut( Gia_Man_t * p, int iObj, Gia_Man_t * pOld, int iOld, Vec_Int_t * vOld2New )
+{
+    int k, iFan;
+    Gia_ManIncrementTravId( p );
+    Gia_ObjSetTravIdCurrentId( p, 0 );
+    Gia_LutForEachFanin( pOld, iOld, iFan, k )
+    {
+        if ( Vec_IntEntry(vOld2New, iFan) == -1 )
+            return 0;
+        Gia_ObjSetTravIdCurrentId( p, Vec_IntEntry(vOld2New, iFan) );
+    }
+    return Mf_ManEcoCheckCone_rec( p, Gia_ManObj(p, iObj) );
+}
+static int Mf_ManEcoCopyCone_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
+{
+    if ( Gia_ObjIsTravIdCurrent(p, pObj) )
+        return pObj->Value;
+    Gia_ObjSetTravIdCurrent( p, pObj );
+    assert( Gia_ObjIsAnd(pObj) );
+    Mf_ManEcoCopyCone_rec( pNew, p, Gia_ObjFanin0(pObj) );
+    Mf_ManEcoCopyCone_rec( pNew, p, Gia_ObjFanin1(pObj) );
+    return pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+}
+Gia_Man_t * Mf_ManPerformMappingEco( Gia_Man_t * pOld, Gia_Man_t * pGia, Jf_Par_t * pPars )
+{
+    Gia_Man_t * pNew, * pWin, * pMapped = NULL;
+    Gia_Obj_t * pObj, * pTemp;
+    Hsh_IntMan_t * pHash;
+    Vec_Int_t * vKeys, * vOldIds, * vNew2Old, * vOld2New, * vLits, * vWinIos, * vLutStarts, * vLuts, * vCiArrs;
+    Vec_Str_t * vStatus; // 1 = needed, 2 = reused LUT root, 4 = window node, 8 = window output
+    int * pLevels = NULL, * pFanins;
+    int i, k, iOld, iFan, iLit, fPhase, nLeaves, nMatched = 0, nReused = 0, nWindow = 0;
+    abctime clk = Abc_Clock();
+    if ( !Gia_ManHasMapping(pOld) || pOld->pMuxes || pGia->pMuxes || Gia_ManHasChoices(pGia) || 
+          Gia_ManCiNum(pOld) != Gia_ManCiNum(pGia) || Gia_ManCoNum(pOld) != Gia_ManCoNum(pGia) || 
+          Gia_ManRegNum(pOld) != Gia_ManRegNum(pGia) || Gia_ManLutSizeMax(pOld) > pPars->nLutSize ||
+          pPars->fGenCnf || pPars->fGenLit )
+    {
+        printf( "The previous mapping cannot be reused. Performing complete mapping.\n" );
+        return Mf_ManPerformMapping( pGia, pPars );
+    }
+    // hash the nodes of the old AIG by their fanins (XORs and MUXes are hashed twice)
+    vKeys   = Vec_IntAlloc( 8 * Gia_ManAndNum(pOld) + 4 );
+    vOldIds = Vec_IntAlloc( 2 * Gia_ManAndNum(pOld) );
+    pHash   = Hsh_IntManStart( vKeys, 4, 2 * Gia_ManAndNum(pOld) + 1 );
+    Gia_ManForEachAnd( pOld, pObj, i )
+        for ( k = 0; k <= Gia_ObjIsMuxType(pObj); k++ )
+        {
+            Vec_IntFillExtra( vKeys, Vec_IntSize(vKeys) + 4, 0 );
+            fPhase = Mf_ManEcoNodeKey( pOld, pObj, NULL, k, Vec_IntLimit(vKeys) - 4 );
+            Vec_IntPush( vOldIds, Abc_Var2Lit(i, fPhase) );
+            if ( Hsh_IntManAdd(pHash, Vec_IntSize(vOldIds)-1) < Vec_IntSize(vOldIds)-1 ) // duplicate
+                Vec_IntShrink( vKeys, Vec_IntSize(vKeys) - 4 ), Vec_IntPop( vOldIds );
+        }
+    // match the nodes of the new AIG in the topological order
+    vNew2Old = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    vOld2New = Vec_IntStartFull( Gia_ManObjNum(pOld) );
+    Vec_IntWriteEntry( vNew2Old, 0, 0 );
+    Vec_IntWriteEntry( vOld2New, 0, 0 );
+    Gia_ManForEachCi( pGia, pObj, i )
+    {
+        Vec_IntWriteEntry( vNew2Old, Gia_ObjId(pGia, pObj), Abc_Var2Lit(Gia_ObjId(pOld, Gia_ManCi(pOld, i)), 0) );
+        Vec_IntWriteEntry( vOld2New, Gia_ObjId(pOld, Gia_ManCi(pOld, i)), Gia_ObjId(pGia, pObj) );
+    }
+    Gia_ManForEachAnd( pGia, pObj, i )
+        for ( k = 0; k <= Gia_ObjIsMuxType(pObj); k++ )
+        {
+            int * pKey, * pPlace, iLitOld = -1;
+            Vec_IntFillExtra( vKeys, Vec_IntSize(vKeys) + 4, 0 );
+            pKey   = Vec_IntLimit(vKeys) - 4;
+            fPhase = Mf_ManEcoNodeKey( pGia, pObj, vNew2Old, k, pKey );
+            if ( fPhase >= 0 && k && pKey[2] == pKey[3] ) // redundant MUX with equal data inputs
+                iLitOld = Abc_LitNotCond( pKey[3], fPhase );
+            else if ( fPhase >= 0 && *(pPlace = Hsh_IntManLookup(pHash, (unsigned *)pKey)) != -1 )
+                iLitOld = Abc_LitNotCond( Vec_IntEntry(vOldIds, Hsh_IntObj(pHash, *pPlace)->iData), fPhase );
+            Vec_IntShrink( vKeys, Vec_IntSize(vKeys) - 4 );
+            if ( iLitOld == -1 )
+                continue;
+            // several new nodes may be matched to the same old node
+            Vec_IntWriteEntry( vNew2Old, i, iLitOld );
+            if ( Vec_IntEntry(vOld2New, Abc_Lit2Var(iLitOld)) == -1 )
+                Vec_IntWriteEntry( vOld2New, Abc_Lit2Var(iLitOld), i );
+            nMatched++;
+            break;
+        }
+    Hsh_IntManStop( pHash );
+    Vec_IntFree( vKeys );
+    Vec_IntFree( vOldIds );
+    // in the reverse topological order, reuse the old LUTs or add the nodes to the window
+    vStatus    = Vec_StrStart( Gia_ManObjNum(pGia) );
+    vLutStarts = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    vLuts      = Vec_IntAlloc( 1000 );
+    Gia_ManForEachCo( pGia, pObj, i )
+        Vec_StrWriteEntry( vStatus, Gia_ObjFaninId0p(pGia, pObj), (char)(1 | 8) );
+    Gia_ManForEachAndReverse( pGia, pObj, i )
+    {
+        if ( !Vec_StrEntry(vStatus, i) )
+            continue;
+        iOld = Vec_IntEntry(vNew2Old, i) == -1 ? -1 : Abc_Lit2Var( Vec_IntEntry(vNew2Old, i) );
+        if ( iOld > 0 && Gia_ObjIsLut(pOld, iOld) && !Gia_ObjLutIsMux(pOld, iOld) && Mf_ManEcoCheckCut(pGia, i, pOld, iOld, vOld2New) )
+        {
+            Vec_StrWriteEntry( vStatus, i, (char)(Vec_StrEntry(vStatus, i) | 2) );
+            Vec_IntWriteEntry( vLutStarts, i, Vec_IntSize(vLuts) );
+            Vec_IntPush( vLuts, i );
+            Vec_IntPush( vLuts, Gia_ObjLutSize(pOld, iOld) );
+            Gia_LutForEachFanin( pOld, iOld, iFan, k )
+            {
+                iFan = Vec_IntEntry( vOld2New, iFan );
+                assert( iFan >= 0 && iFan < i );
+                Vec_StrWriteEntry( vStatus, iFan, (char)(Vec_StrEntry(vStatus, iFan) | 1 | 8) );
+                Vec_IntPush( vLuts, iFan );
+            }
+            nReused++;
+            continue;
+        }
+        Vec_StrWriteEntry( vStatus, i, (char)(Vec_StrEntry(vStatus, i) | 4) );
+        Vec_StrWriteEntry( vStatus, Gia_ObjFaninId0(pObj, i), (char)(Vec_StrEntry(vStatus, Gia_ObjFaninId0(pObj, i)) | 1) );
+        Vec_StrWriteEntry( vStatus, Gia_ObjFaninId1(pObj, i), (char)(Vec_StrEntry(vStatus, Gia_ObjFaninId1(pObj, i)) | 1) );
+        nWindow++;
+    }
+    // extract the window: CIs are the boundary nodes, COs are the nodes used outside
+    Gia_ManLutLevel( pOld, &pLevels );
+    vWinIos = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    pWin = Gia_ManStart( 3 * nWindow + 100 );
+    pWin->pName = Abc_UtilStrsav( pGia->pName );
+    vCiArrs = Vec_IntAlloc( 100 );
+    Gia_ManConst0(pGia)->Value = 0;
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        if ( !(Vec_StrEntry(vStatus, i) & 4) )
+            continue;
+        for ( k = 0; k < 2; k++ )
+        {
+            pTemp = k ? Gia_ObjFanin1(pObj) : Gia_ObjFanin0(pObj);
+            iFan  = Gia_ObjId( pGia, pTemp );
+            if ( iFan == 0 || (Vec_StrEntry(vStatus, iFan) & (4 | 16)) )
+                continue;
+            Vec_StrWriteEntry( vStatus, iFan, (char)(Vec_StrEntry(vStatus, iFan) | 16) );
+            Vec_IntWriteEntry( vWinIos, iFan, Gia_ManCiNum(pWin) );
+            pTemp->Value = Gia_ManAppendCi( pWin );
+            Vec_IntPush( vCiArrs, Gia_ObjIsCi(pTemp) ? 0 : pLevels[Abc_Lit2Var(Vec_IntEntry(vNew2Old, iFan))] );
+        }
+    }
+    Gia_ManForEachAnd( pGia, pObj, i )
+        if ( Vec_StrEntry(vStatus, i) & 4 )
+            pObj->Value = Gia_ManAppendAnd( pWin, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachAnd( pGia, pObj, i )
+        if ( (Vec_StrEntry(vStatus, i) & (4 | 8)) == (4 | 8) )
+        {
+            Vec_IntWriteEntry( vWinIos, i, Gia_ManCoNum(pWin) );
+            Gia_ManAppendCo( pWin, pObj->Value );
+        }
+    ABC_FREE( pLevels );
+    // map the window
+    if ( Gia_ManCoNum(pWin) > 0 )
+    {
+        int fVerbose = pPars->fVerbose;
+        pPars->fVerbose = 0;
+        pMapped = Mf_ManPerformMappingInt( pWin, pPars, vCiArrs );
+        pPars->fVerbose = fVerbose;
+    }
+    Vec_IntFree( vCiArrs );
+    // create the new AIG in the topological order of the original one
+    pNew = Gia_ManStart( Gia_ManObjNum(pGia) + (pMapped ? Gia_ManObjNum(pMapped) : 0) );
+    pNew->pName = Abc_UtilStrsav( pGia->pName );
+    pNew->pSpec = Abc_UtilStrsav( pGia->pSpec );
+    vLits = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    Vec_IntWriteEntry( vLits, 0, 0 );
+    Gia_ManForEachCi( pGia, pObj, i )
+        Vec_IntWriteEntry( vLits, Gia_ObjId(pGia, pObj), Gia_ManAppendCi(pNew) );
+    if ( pMapped )
+    {
+        Gia_ManIncrementTravId( pMapped );
+        Gia_ObjSetTravIdCurrent( pMapped, Gia_ManConst0(pMapped) );
+        Gia_ManConst0(pMapped)->Value = 0;
+    }
+    for ( i = 0; i < Gia_ManObjNum(pGia); i++ )
+    {
+        if ( Vec_StrEntry(vStatus, i) & 2 ) // reused LUT
+        {
+            k = Vec_IntEntry( vLutStarts, i );
+            assert( Vec_IntEntry(vLuts, k) == i );
+            nLeaves = Vec_IntEntry( vLuts, k+1 );
+            pFanins = Vec_IntEntryP( vLuts, k+2 );
+            // try sharing the logic with other LUTs
+            iLit = Mf_ManEcoCopyShared_rec( pNew, pGia, i, vLits );
+            Gia_ManIncrementTravId( pNew );
+            Gia_ObjSetTravIdCurrentId( pNew, 0 );
+            for ( iFan = 0; iFan < nLeaves; iFan++ )
+                Gia_ObjSetTravIdCurrentId( pNew, Abc_Lit2Var(Vec_IntEntry(vLits, pFanins[iFan])) );
+            if ( !Mf_ManEcoCheckCone_rec(pNew, Gia_ManObj(pNew, Abc_Lit2Var(iLit))) )
+            {
+                // the shared logic crosses the leaves; create a private copy of the cone
+                Gia_ManIncrementTravId( pGia );
+                Gia_ObjSetTravIdCurrent( pGia, Gia_ManConst0(pGia) );
+                for ( iFan = 0; iFan < nLeaves; iFan++ )
+                {
+                    pTemp = Gia_ManObj( pGia, pFanins[iFan] );
+                    Gia_ObjSetTravIdCurrent( pGia, pTemp );
+                    pTemp->Value = Vec_IntEntry( vLits, pFanins[iFan] );
+                    assert( pTemp->Value != ~0 );
+                }
+                Vec_IntWriteEntry( vLits, i, Mf_ManEcoCopyCone_rec(pNew, pGia, Gia_ManObj(pGia, i)) );
+            }
+        }
+        else if ( (Vec_StrEntry(vStatus, i) & (4 | 8)) == (4 | 8) ) // window output
+        {
+            pObj = Gia_ManCo( pMapped, Vec_IntEntry(vWinIos, i) );
+            Vec_IntWriteEntry( vLits, i, Abc_LitNotCond(Mf_ManEcoCopyCone_rec(pNew, pMapped, Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj)) );
+        }
+        if ( pMapped && (Vec_StrEntry(vStatus, i) & 16) ) // window input
+        {
+            pObj = Gia_ManCi( pMapped, Vec_IntEntry(vWinIos, i) );
+            Gia_ObjSetTravIdCurrent( pMapped, pObj );
+            pObj->Value = Vec_IntEntry( vLits, i );
+        }
+    }
+    Gia_ManForEachCo( pGia, pObj, i )
+        Gia_ManAppendCo( pNew, Abc_LitNotCond(Vec_IntEntry(vLits, Gia_ObjFaninId0p(pGia, pObj)), Gia_ObjFaninC0(pObj)) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(pGia) );
+    // create the mapping
+    pNew->vMapping = Vec_IntStart( Gia_ManObjNum(pNew) );
+    for ( k = 0; k < Vec_IntSize(vLuts); k += nLeaves + 2 )
+    {
+        nLeaves = Vec_IntEntry( vLuts, k+1 );
+        Vec_IntWriteEntry( pNew->vMapping, Abc_Lit2Var(Vec_IntEntry(vLits, Vec_IntEntry(vLuts, k))), Vec_IntSize(pNew->vMapping) );
+        Vec_IntPush( pNew->vMapping, nLeaves );
+        for ( iFan = 0; iFan < nLeaves; iFan++ )
+            Vec_IntPush( pNew->vMapping, Abc_Lit2Var(Vec_IntEntry(vLits, Vec_IntEntry(vLuts, k+2+iFan))) );
+        Vec_IntPush( pNew->vMapping, Abc_Lit2Var(Vec_IntEntry(vLits, Vec_IntEntry(vLuts, k))) );
+    }
+    if ( pMapped )
+    {
+        Gia_ManForEachLut( pMapped, i )
+        {
+            if ( !Gia_ObjIsTravIdCurrentId(pMapped, i) )
+                continue;
+            iLit = Gia_ManObj(pMapped, i)->Value;
+            Vec_IntWriteEntry( pNew->vMapping, Abc_Lit2Var(iLit), Vec_IntSize(pNew->vMapping) );
+            Vec_IntPush( pNew->vMapping, Gia_ObjLutSize(pMapped, i) );
+            Gia_LutForEachFanin( pMapped, i, iFan, k )
+                Vec_IntPush( pNew->vMapping, Abc_Lit2Var(Gia_ManObj(pMapped, iFan)->Value) );
+            Vec_IntPush( pNew->vMapping, Abc_Lit2Var(iLit) );
+        }
+    }
+    Gia_ManMappingVerify( pNew );
+    if ( pPars->fVerbose )
+    {
+        printf( "Matched nodes = %d (%.2f %%).  ", nMatched, 100.0 * nMatched / Abc_MaxInt(1, Gia_ManAndNum(pGia)) );
+        printf( "Reused LUTs = %d.  Window nodes = %d.  Window LUTs = %d.  ", nReused, nWindow, pMapped ? Gia_ManLutNum(pMapped) : 0 );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    if ( pMapped && pMapped != pWin )
+        Gia_ManStop( pMapped );
+    Gia_ManStop( pWin );
+    Vec_IntFree( vNew2Old );
+    Vec_IntFree( vOld2New );
+    Vec_IntFree( vLits );
+    Vec_IntFree( vWinIos );
+    Vec_IntFree( vLutStarts );
+    Vec_IntFree( vLuts );
+    Vec_StrFree( vStatus );
+    return pNew;
+}
 
 /**Function*************************************************************
 
@@ -21,9 +21,13 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
-//#include <immintrin.h>
 #include "aig/miniaig/miniaig.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GIA_SIM_USE_AVX
+#include <immintrin.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -31,6 +35,10 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the smallest number of words for which the single-threaded simulation
+// on the structure-of-arrays view pays for deriving the view
+#define GIA_SIM_SOA_WORDS 64
+
 
 typedef struct Gia_SimRsbMan_t_ Gia_SimRsbMan_t;
 struct Gia_SimRsbMan_t_
@@ -126,7 +134,10 @@ Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
 {
     Gia_Obj_t * pObj;
     int i, nWords = Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia);
-    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
+    Vec_Wrd_t * vSims;
+    if ( pGia->pMuxes == NULL && nWords >= GIA_SIM_SOA_WORDS )
+        return Gia_ManSimPatSimMt( pGia, pGia->vSimsPi, 1 );
+    vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
     assert( Vec_WrdSize(pGia->vSimsPi) % Gia_ManCiNum(pGia) == 0 );
     Gia_ManSimPatAssignInputs( pGia, nWords, vSims, pGia->vSimsPi );
     Gia_ManForEachAnd( pGia, pObj, i ) 
@@ -140,13 +151,19 @@ Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOut
     Gia_Obj_t * pObj;
     int i, nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pGia);
     Vec_Wrd_t * vSimsCo = fOuts ? Vec_WrdStart( Gia_ManCoNum(pGia) * nWords ) : NULL;
-    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
-    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
-    Gia_ManSimPatAssignInputs( pGia, nWords, vSims, vSimsPi );
-    Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
-    Gia_ManForEachCo( pGia, pObj, i )
-        Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+    Vec_Wrd_t * vSims;
+    if ( pGia->pMuxes == NULL && nWords >= GIA_SIM_SOA_WORDS )
+        vSims = Gia_ManSimPatSimMt( pGia, vSimsPi, 1 );
+    else
+    {
+        vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
+        assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
+        Gia_ManSimPatAssignInputs( pGia, nWords, vSims, vSimsPi );
+        Gia_ManForEachAnd( pGia, pObj, i ) 
+            Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
+        Gia_ManForEachCo( pGia, pObj, i )
+            Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+    }
     if ( !fOuts )
         return vSims;
     Gia_ManForEachCo( pGia, pObj, i )
@@ -154,6 +171,203 @@ Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOut
     Vec_WrdFree( vSims );
     return vSimsCo;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Simulation engine working on the slices of pattern words.]
+
+  Description [Computes the same simulation info as Gia_ManSimPatSimOut()
+  with fOuts equal to 0. The pattern words are divided into slices, which
+  are simulated by the tasks of the thread pool, while the AND nodes are
+  simulated using the widest vector instructions supported by the CPU.
+  As in Gia_ObjIsXor(), the XOR nodes are the AND nodes whose first fanin
+  has the larger ID. Only AIGs without MUXes are supported. The callers
+  simulating the same AIG many times can derive the view once and call
+  Gia_SoaSimPatSim() directly.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef void (*Gia_SimAndsFunc_t)( Gia_Soa_t * p, word * pSims, int nWords, int wStart, int wStop );
+typedef struct Gia_SimSlice_t_ Gia_SimSlice_t;
+struct Gia_SimSlice_t_
+{
+    Gia_Soa_t *    pSoa;       // the AIG structure
+    Gia_SimAndsFunc_t pFunc;   // the kernel for the AND nodes
+    word *         pSims;      // simulation info of the objects
+    word *         pSimsPi;    // simulation info of the inputs
+    int            nWords;     // the number of words
+    int            wStart;     // the first word of the slice
+    int            wStop;      // the word following the last word
+};
+static void Gia_ManSimPatSimAnds( Gia_Soa_t * p, word * pSims, int nWords, int wStart, int wStop )
+{
+    int * pFan0 = p->pFan0, * pFan1 = p->pFan1;
+    word * pSims0, * pSims1, * pSims2, Diff0, Diff1;
+    int i, k, w;
+    Gia_SoaForEachAnd( p, i, k )
+    {
+        pSims0 = pSims + nWords * (pFan0[i] >> 1);
+        pSims1 = pSims + nWords * (pFan1[i] >> 1);
+        pSims2 = pSims + nWords * i;
+        Diff0  = (word)0 - (word)(pFan0[i] & 1);
+        Diff1  = (word)0 - (word)(pFan1[i] & 1);
+        if ( Gia_SoaIsXor(p, i) )
+            for ( w = wStart; w < wStop; w++ )
+                pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
+        else
+            for ( w = wStart; w < wStop; w++ )
+                pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+    }
+}
+#ifdef GIA_SIM_USE_AVX
+__attribute__((target("avx2")))
+static void Gia_ManSimPatSimAndsAvx2( Gia_Soa_t * p, word * pSims, int nWords, int wStart, int wStop )
+{
+    int * pFan0 = p->pFan0, * pFan1 = p->pFan1;
+    word * pSims0, * pSims1, * pSims2;
+    __m256i Diff0, Diff1, Sim0, Sim1;
+    int i, k, w;
+    Gia_SoaForEachAnd( p, i, k )
+    {
+        pSims0 = pSims + nWords * (pFan0[i] >> 1);
+        pSims1 = pSims + nWords * (pFan1[i] >> 1);
+        pSims2 = pSims + nWords * i;
+        Diff0  = _mm256_set1_epi64x( -(long long)(pFan0[i] & 1) );
+        Diff1  = _mm256_set1_epi64x( -(long long)(pFan1[i] & 1) );
+        if ( Gia_SoaIsXor(p, i) )
+        {
+            for ( w = wStart; w + 4 <= wStop; w += 4 )
+            {
+                Sim0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pSims0 + w)), Diff0 );
+                Sim1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pSims1 + w)), Diff1 );
+                _mm256_storeu_si256( (__m256i *)(pSims2 + w), _mm256_xor_si256(Sim0, Sim1) );
+            }
+            for ( ; w < wStop; w++ )
+                pSims2[w] = (pSims0[w] ^ ((word)0 - (word)(pFan0[i] & 1))) ^ (pSims1[w] ^ ((word)0 - (word)(pFan1[i] & 1)));
+            continue;
+        }
+        for ( w = wStart; w + 4 <= wStop; w += 4 )
+        {
+            Sim0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pSims0 + w)), Diff0 );
+            Sim1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pSims1 + w)), Diff1 );
+            _mm256_storeu_si256( (__m256i *)(pSims2 + w), _mm256_and_si256(Sim0, Sim1) );
+        }
+        for ( ; w < wStop; w++ )
+            pSims2[w] = (pSims0[w] ^ ((word)0 - (word)(pFan0[i] & 1))) & (pSims1[w] ^ ((word)0 - (word)(pFan1[i] & 1)));
+    }
+}
+__attribute__((target("avx512f")))
+static void Gia_ManSimPatSimAndsAvx512( Gia_Soa_t * p, word * pSims, int nWords, int wStart, int wStop )
+{
+    int * pFan0 = p->pFan0, * pFan1 = p->pFan1;
+    word * pSims0, * pSims1, * pSims2;
+    __m512i Diff0, Diff1, Sim0, Sim1;
+    int i, k, w;
+    Gia_SoaForEachAnd( p, i, k )
+    {
+        pSims0 = pSims + nWords * (pFan0[i] >> 1);
+        pSims1 = pSims + nWords * (pFan1[i] >> 1);
+        pSims2 = pSims + nWords * i;
+        Diff0  = _mm512_set1_epi64( -(long long)(pFan0[i] & 1) );
+        Diff1  = _mm512_set1_epi64( -(long long)(pFan1[i] & 1) );
+        if ( Gia_SoaIsXor(p, i) )
+        {
+            for ( w = wStart; w + 8 <= wStop; w += 8 )
+            {
+                Sim0 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pSims0 + w)), Diff0 );
+                Sim1 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pSims1 + w)), Diff1 );
+                _mm512_storeu_si512( (void *)(pSims2 + w), _mm512_xor_si512(Sim0, Sim1) );
+            }
+            for ( ; w < wStop; w++ )
+                pSims2[w] = (pSims0[w] ^ ((word)0 - (word)(pFan0[i] & 1))) ^ (pSims1[w] ^ ((word)0 - (word)(pFan1[i] & 1)));
+            continue;
+        }
+        for ( w = wStart; w + 8 <= wStop; w += 8 )
+        {
+            Sim0 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pSims0 + w)), Diff0 );
+            Sim1 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pSims1 + w)), Diff1 );
+            _mm512_storeu_si512( (void *)(pSims2 + w), _mm512_and_si512(Sim0, Sim1) );
+        }
+        for ( ; w < wStop; w++ )
+            pSims2[w] = (pSims0[w] ^ ((word)0 - (word)(pFan0[i] & 1))) & (pSims1[w] ^ ((word)0 - (word)(pFan1[i] & 1)));
+    }
+}
+#endif
+static Gia_SimAndsFunc_t Gia_ManSimPatSimAndsFunc()
+{
+#ifdef GIA_SIM_USE_AVX
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        return Gia_ManSimPatSimAndsAvx512;
+    if ( __builtin_cpu_supports("avx2") )
+        return Gia_ManSimPatSimAndsAvx2;
+#endif
+    return Gia_ManSimPatSimAnds;
+}
+static int Gia_ManSimPatSimSlice( void * pArg )
+{
+    Gia_SimSlice_t * pSlice = (Gia_SimSlice_t *)pArg;
+    Gia_Soa_t * p = pSlice->pSoa;
+    word * pSims = pSlice->pSims, * pSims0, * pSims2, Diff0;
+    int nWords = pSlice->nWords, nSlice = pSlice->wStop - pSlice->wStart;
+    int i, w, Id;
+    Gia_ManForEachCiId( p->pGia, Id, i )
+        memcpy( pSims + nWords * Id + pSlice->wStart, pSlice->pSimsPi + nWords * i + pSlice->wStart, sizeof(word) * nSlice );
+    pSlice->pFunc( p, pSims, nWords, pSlice->wStart, pSlice->wStop );
+    Gia_ManForEachCoId( p->pGia, Id, i )
+    {
+        pSims0 = pSims + nWords * (p->pFan0[Id] >> 1);
+        pSims2 = pSims + nWords * Id;
+        Diff0  = (word)0 - (word)(p->pFan0[Id] & 1);
+        for ( w = pSlice->wStart; w < pSlice->wStop; w++ )
+            pSims2[w] = pSims0[w] ^ Diff0;
+    }
+    return 1;
+}
+Vec_Wrd_t * Gia_SoaSimPatSim( Gia_Soa_t * p, Vec_Wrd_t * vSimsPi, int nThreads )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Gia_SimAndsFunc_t pFunc = Gia_ManSimPatSimAndsFunc();
+    int i, nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pGia);
+    int nSlices = Abc_MaxInt( 1, Abc_MinInt(nThreads, (nWords + 7) / 8) );
+    int nSliceWords = 8 * (((nWords + nSlices - 1) / nSlices + 7) / 8);
+    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
+    Gia_SimSlice_t * pSlices = ABC_CALLOC( Gia_SimSlice_t, nSlices );
+    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
+    for ( i = 0; i < nSlices; i++ )
+    {
+        pSlices[i].pSoa    = p;
+        pSlices[i].pFunc   = pFunc;
+        pSlices[i].pSims   = Vec_WrdArray(vSims);
+        pSlices[i].pSimsPi = Vec_WrdArray(vSimsPi);
+        pSlices[i].nWords  = nWords;
+        pSlices[i].wStart  = Abc_MinInt( nWords, i * nSliceWords );
+        pSlices[i].wStop   = Abc_MinInt( nWords, (i + 1) * nSliceWords );
+    }
+    if ( nSlices == 1 )
+        Gia_ManSimPatSimSlice( pSlices );
+    else
+    {
+        Util_PoolGroup_t * pGroup = Util_PoolGroupStart( nSlices, 0 );
+        for ( i = 0; i < nSlices; i++ )
+            Util_PoolGroupAdd( pGroup, Gia_ManSimPatSimSlice, pSlices + i );
+        Util_PoolGroupWait( pGroup );
+        Util_PoolGroupStop( pGroup );
+    }
+    ABC_FREE( pSlices );
+    return vSims;
+}
+Vec_Wrd_t * Gia_ManSimPatSimMt( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int nThreads )
+{
+    Gia_Soa_t * p = Gia_SoaStart( pGia );
+    Vec_Wrd_t * vSims = Gia_SoaSimPatSim( p, vSimsPi, nThreads );
+    Gia_SoaStop( p );
+    return vSims;
+}
+
 static inline void Gia_ManSimPatSimAnd3( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsC )
 {
     word pComps[2] = { ~(word)0, 0 };
@@ -0,0 +1,367 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimInc.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Incremental simulation.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: giaSimInc.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+struct Gia_SimInc_t_
+{
+    Gia_Man_t *    pGia;       // the AIG
+    int            nWords;     // the number of words per object
+    int            fFanout;    // the static fanout was computed here
+    int            fBorrow;    // the simulation info belongs to the caller
+    Vec_Wrd_t *    vSims;      // the simulation info of the objects
+    Vec_Bit_t *    vPending;   // the objects to be recomputed
+    int            iPendMin;   // the smallest pending object
+    int            iPendMax;   // the largest pending object
+    Vec_Bit_t *    vDirty;     // the words that changed
+    Vec_Int_t *    vDirtyWords;// the list of words that changed
+    Vec_Bit_t *    vChanged;   // the objects whose simulation info changed
+    Vec_Int_t *    vChangedObjs; // the list of objects whose simulation info changed
+    Vec_Bit_t *    vClasses;   // the classes visited
+    int            nUpdates;   // the number of objects recomputed
+};
+
+static inline word * Gia_SimIncObjSim( Gia_SimInc_t * p, int iObj )  { return Vec_WrdEntryP( p->vSims, p->nWords * iObj ); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the incremental simulation.]
+
+  Description [Simulates the AIG with the given input patterns. After
+  this, the patterns can be changed using Gia_SimIncSetCiWord() and
+  Gia_SimIncFlipCiBit(), and the changes are propagated only through the
+  fanout cones where the simulation info actually changes. New pattern
+  words can be added using Gia_SimIncAppend(). Gia_SimIncStartSims()
+  uses the simulation info of all objects given by the caller, which
+  should be up to date. This info is updated in place and is not freed
+  by Gia_SimIncStop().]
+
+  SideEffects [Computes the static fanout of the AIG, if not computed.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_SimInc_t * Gia_SimIncAlloc( Gia_Man_t * pGia, Vec_Wrd_t * vSims, int nWords )
+{
+    Gia_SimInc_t * p;
+    p = ABC_CALLOC( Gia_SimInc_t, 1 );
+    p->pGia         = pGia;
+    p->nWords       = nWords;
+    p->vSims        = vSims;
+    p->vPending     = Vec_BitStart( Gia_ManObjNum(pGia) );
+    p->iPendMin     = Gia_ManObjNum(pGia);
+    p->iPendMax     = -1;
+    p->vDirty       = Vec_BitStart( p->nWords );
+    p->vDirtyWords  = Vec_IntAlloc( p->nWords );
+    p->vChanged     = Vec_BitStart( Gia_ManObjNum(pGia) );
+    p->vChangedObjs = Vec_IntAlloc( 100 );
+    p->vClasses     = Vec_BitStart( Gia_ManObjNum(pGia) );
+    if ( pGia->vFanoutNums == NULL )
+    {
+        Gia_ManStaticFanoutStart( pGia );
+        p->fFanout = 1;
+    }
+    return p;
+}
+Gia_SimInc_t * Gia_SimIncStart( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi )
+{
+    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
+    return Gia_SimIncAlloc( pGia, Gia_ManSimPatSimOut(pGia, vSimsPi, 0), Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pGia) );
+}
+Gia_SimInc_t * Gia_SimIncStartSims( Gia_Man_t * pGia, Vec_Wrd_t * vSims, int nWords )
+{
+    Gia_SimInc_t * p;
+    assert( Vec_WrdSize(vSims) == Gia_ManObjNum(pGia) * nWords );
+    p = Gia_SimIncAlloc( pGia, vSims, nWords );
+    p->fBorrow = 1;
+    return p;
+}
+void Gia_SimIncStop( Gia_SimInc_t * p )
+{
+    if ( p->fFanout )
+        Gia_ManStaticFanoutStop( p->pGia );
+    if ( !p->fBorrow )
+        Vec_WrdFree( p->vSims );
+    Vec_BitFree( p->vPending );
+    Vec_BitFree( p->vDirty );
+    Vec_IntFree( p->vDirtyWords );
+    Vec_BitFree( p->vChanged );
+    Vec_IntFree( p->vChangedObjs );
+    Vec_BitFree( p->vClasses );
+    ABC_FREE( p );
+}
+Vec_Wrd_t * Gia_SimIncSims( Gia_SimInc_t * p )
+{
+    return p->vSims;
+}
+int Gia_SimIncWordNum( Gia_SimInc_t * p )
+{
+    return p->nWords;
+}
+int Gia_SimIncUpdateNum( Gia_SimInc_t * p )
+{
+    return p->nUpdates;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the changes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_SimIncMarkWord( Gia_SimInc_t * p, int iWord )
+{
+    if ( Vec_BitEntry(p->vDirty, iWord) )
+        return;
+    Vec_BitWriteEntry( p->vDirty, iWord, 1 );
+    Vec_IntPush( p->vDirtyWords, iWord );
+}
+static inline void Gia_SimIncMarkChanged( Gia_SimInc_t * p, int iObj )
+{
+    int i, iFan;
+    if ( !Vec_BitEntry(p->vChanged, iObj) )
+    {
+        Vec_BitWriteEntry( p->vChanged, iObj, 1 );
+        Vec_IntPush( p->vChangedObjs, iObj );
+    }
+    Gia_ObjForEachFanoutStaticId( p->pGia, iObj, iFan, i )
+    {
+        Vec_BitWriteEntry( p->vPending, iFan, 1 );
+        p->iPendMin = Abc_MinInt( p->iPendMin, iFan );
+        p->iPendMax = Abc_MaxInt( p->iPendMax, iFan );
+    }
+}
+void Gia_SimIncSetCiWord( Gia_SimInc_t * p, int iCi, int iWord, word Value )
+{
+    int iObj = Gia_ManCiIdToId( p->pGia, iCi );
+    word * pSim = Gia_SimIncObjSim( p, iObj );
+    assert( iWord >= 0 && iWord < p->nWords );
+    if ( pSim[iWord] == Value )
+        return;
+    pSim[iWord] = Value;
+    Gia_SimIncMarkWord( p, iWord );
+    Gia_SimIncMarkChanged( p, iObj );
+}
+void Gia_SimIncFlipCiBit( Gia_SimInc_t * p, int iCi, int iPat )
+{
+    int iObj = Gia_ManCiIdToId( p->pGia, iCi );
+    word * pSim = Gia_SimIncObjSim( p, iObj );
+    assert( iPat >= 0 && iPat < 64 * p->nWords );
+    Gia_SimIncSetCiWord( p, iCi, iPat >> 6, pSim[iPat >> 6] ^ ((word)1 << (iPat & 63)) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the equivalence classes that split.]
+
+  Description [Checks the classes of the AIG containing the given objects
+  and adds the representatives of the classes, in which the simulation
+  info of some member differs from that of the representative (up to
+  complementation), to vSplit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_SimIncObjEqual( Gia_SimInc_t * p, int iObj0, int iObj1 )
+{
+    word * pSim0 = Gia_SimIncObjSim( p, iObj0 );
+    word * pSim1 = Gia_SimIncObjSim( p, iObj1 );
+    word Diff = (pSim0[0] & 1) == (pSim1[0] & 1) ? 0 : ~(word)0;
+    int w;
+    for ( w = 0; w < p->nWords; w++ )
+        if ( pSim0[w] != (pSim1[w] ^ Diff) )
+            return 0;
+    return 1;
+}
+static void Gia_SimIncCollectSplit( Gia_SimInc_t * p, Vec_Int_t * vObjs, Vec_Int_t * vSplit )
+{
+    Gia_Man_t * pGia = p->pGia;
+    int i, k, iObj, iRepr;
+    if ( pGia->pReprs == NULL || pGia->pNexts == NULL )
+        return;
+    Vec_IntForEachEntry( vObjs, iObj, i )
+    {
+        if ( !Gia_ObjIsClass(pGia, iObj) || Gia_ObjIsConst(pGia, iObj) )
+            continue;
+        iRepr = Gia_ObjIsHead(pGia, iObj) ? iObj : Gia_ObjRepr(pGia, iObj);
+        if ( Vec_BitEntry(p->vClasses, iRepr) )
+            continue;
+        Vec_BitWriteEntry( p->vClasses, iRepr, 1 );
+        Gia_ClassForEachObj1( pGia, iRepr, k )
+            if ( !Gia_SimIncObjEqual(p, iRepr, k) )
+                break;
+        if ( k > 0 )
+            Vec_IntPush( vSplit, iRepr );
+    }
+    Vec_IntForEachEntry( vObjs, iObj, i )
+        if ( Gia_ObjIsClass(pGia, iObj) && !Gia_ObjIsConst(pGia, iObj) )
+            Vec_BitWriteEntry( p->vClasses, Gia_ObjIsHead(pGia, iObj) ? iObj : Gia_ObjRepr(pGia, iObj), 0 );
+    // the constant class splits when a changed member is no longer constant
+    Vec_IntForEachEntry( vObjs, iObj, i )
+        if ( iObj > 0 && Gia_ObjIsConst(pGia, iObj) && !Gia_SimIncObjEqual(p, 0, iObj) )
+        {
+            Vec_IntPush( vSplit, 0 );
+            break;
+        }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the changes of the input patterns.]
+
+  Description [Recomputes the changed words of the objects in the fanout
+  cones of the changed inputs. An object is recomputed only if one of its
+  fanins changed. If vSplit is not NULL and the AIG has equivalence
+  classes, adds the representatives of the classes that split to vSplit.
+  Returns the number of objects whose simulation info changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_SimIncObjUpdate( Gia_SimInc_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    word * pSim = Gia_SimIncObjSim( p, iObj ), * pSim0, * pSim1, Diff0, Diff1, Value;
+    int i, w, fChange = 0;
+    pSim0 = Gia_SimIncObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
+    Diff0 = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
+    if ( Gia_ObjIsCo(pObj) )
+    {
+        Vec_IntForEachEntry( p->vDirtyWords, w, i )
+        {
+            Value = pSim0[w] ^ Diff0;
+            fChange |= (pSim[w] != Value);
+            pSim[w] = Value;
+        }
+        return fChange;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    pSim1 = Gia_SimIncObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
+    Diff1 = Gia_ObjFaninC1(pObj) ? ~(word)0 : 0;
+    if ( Gia_ObjIsXor(pObj) )
+        Vec_IntForEachEntry( p->vDirtyWords, w, i )
+        {
+            Value = (pSim0[w] ^ Diff0) ^ (pSim1[w] ^ Diff1);
+            fChange |= (pSim[w] != Value);
+            pSim[w] = Value;
+        }
+    else
+        Vec_IntForEachEntry( p->vDirtyWords, w, i )
+        {
+            Value = (pSim0[w] ^ Diff0) & (pSim1[w] ^ Diff1);
+            fChange |= (pSim[w] != Value);
+            pSim[w] = Value;
+        }
+    return fChange;
+}
+int Gia_SimIncPropagate( Gia_SimInc_t * p, Vec_Int_t * vSplit )
+{
+    int i, iObj, nChanges;
+    // the objects are ordered topologically, so the fanouts are added after the current object
+    for ( i = p->iPendMin; i <= p->iPendMax; i++ )
+    {
+        if ( !Vec_BitEntry(p->vPending, i) )
+            continue;
+        Vec_BitWriteEntry( p->vPending, i, 0 );
+        p->nUpdates++;
+        if ( Gia_SimIncObjUpdate(p, i) )
+            Gia_SimIncMarkChanged( p, i );
+    }
+    p->iPendMin = Gia_ManObjNum(p->pGia);
+    p->iPendMax = -1;
+    if ( vSplit )
+        Gia_SimIncCollectSplit( p, p->vChangedObjs, vSplit );
+    Vec_IntForEachEntry( p->vDirtyWords, iObj, i )
+        Vec_BitWriteEntry( p->vDirty, iObj, 0 );
+    Vec_IntClear( p->vDirtyWords );
+    Vec_IntForEachEntry( p->vChangedObjs, iObj, i )
+        Vec_BitWriteEntry( p->vChanged, iObj, 0 );
+    nChanges = Vec_IntSize( p->vChangedObjs );
+    Vec_IntClear( p->vChangedObjs );
+    return nChanges;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Appends new pattern words.]
+
+  Description [Simulates the new words for all objects and adds them after
+  the current words. The pending changes should be propagated before.
+  If vSplit is not NULL, adds the representatives of the classes that
+  split to vSplit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimIncAppend( Gia_SimInc_t * p, Vec_Wrd_t * vSimsPiNew, Vec_Int_t * vSplit )
+{
+    Gia_Man_t * pGia = p->pGia;
+    int i, nWordsNew = Vec_WrdSize(vSimsPiNew) / Gia_ManCiNum(pGia);
+    Vec_Wrd_t * vSimsNew = Gia_ManSimPatSimOut( pGia, vSimsPiNew, 0 );
+    Vec_Wrd_t * vSims = Vec_WrdAlloc( Gia_ManObjNum(pGia) * (p->nWords + nWordsNew) );
+    assert( Vec_WrdSize(vSimsPiNew) % Gia_ManCiNum(pGia) == 0 );
+    assert( Vec_IntSize(p->vDirtyWords) == 0 );
+    assert( !p->fBorrow );
+    for ( i = 0; i < Gia_ManObjNum(pGia); i++ )
+    {
+        Vec_WrdPushArray( vSims, Gia_SimIncObjSim(p, i), p->nWords );
+        Vec_WrdPushArray( vSims, Vec_WrdEntryP(vSimsNew, nWordsNew * i), nWordsNew );
+    }
+    Vec_WrdFree( vSimsNew );
+    Vec_WrdFree( p->vSims );
+    p->vSims   = vSims;
+    p->nWords += nWordsNew;
+    Vec_BitFree( p->vDirty );
+    p->vDirty  = Vec_BitStart( p->nWords );
+    if ( vSplit )
+    {
+        Vec_Int_t * vObjs = Vec_IntStartNatural( Gia_ManObjNum(pGia) );
+        Gia_SimIncCollectSplit( p, vObjs, vSplit );
+        Vec_IntFree( vObjs );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,202 @@
+/**CFile****************************************************************
+
+  FileName    [giaSoa.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Structure-of-arrays view of the AIG.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: giaSoa.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the structure-of-arrays view of the AIG.]
+
+  Description [The fanin literals, the marks and the values of the objects
+  are stored in separate arrays, so that the traversals that only need
+  the structure (levelization, reference counting, and the simulation
+  in Gia_SoaSimPatSim()) do not bring the rest of Gia_Obj_t into the
+  cache. The view is not updated when the AIG changes; the marks and
+  the values can be synchronized with the AIG using Gia_SoaLoadMarks()
+  and Gia_SoaSaveMarks(). The XOR nodes
+  keep their fanin order, so they can be recognized as in Gia_ObjIsXor().
+  Only AIGs without MUXes are supported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Soa_t * Gia_SoaStart( Gia_Man_t * pGia )
+{
+    Gia_Soa_t * p;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( pGia->pMuxes == NULL );
+    p = ABC_CALLOC( Gia_Soa_t, 1 );
+    p->pGia    = pGia;
+    p->nObjs   = Gia_ManObjNum(pGia);
+    p->pFan0   = ABC_ALLOC( int, p->nObjs );
+    p->pFan1   = ABC_ALLOC( int, p->nObjs );
+    p->pAnds   = ABC_ALLOC( int, Gia_ManAndNum(pGia) );
+    p->pMarks  = ABC_CALLOC( unsigned char, p->nObjs );
+    p->pValues = ABC_ALLOC( unsigned, p->nObjs );
+    Gia_ManForEachObj( pGia, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            p->pFan0[i] = Gia_ObjFaninLit0(pObj, i);
+            p->pFan1[i] = Gia_ObjFaninLit1(pObj, i);
+            p->pAnds[p->nAnds++] = i;
+        }
+        else if ( Gia_ObjIsCo(pObj) )
+        {
+            p->pFan0[i] = Gia_ObjFaninLit0(pObj, i);
+            p->pFan1[i] = -1;
+        }
+        else
+        {
+            p->pFan0[i] = -1;
+            p->pFan1[i] = -1;
+        }
+    }
+    Gia_SoaLoadMarks( p );
+    return p;
+}
+void Gia_SoaStop( Gia_Soa_t * p )
+{
+    ABC_FREE( p->pFan0 );
+    ABC_FREE( p->pFan1 );
+    ABC_FREE( p->pAnds );
+    ABC_FREE( p->pMarks );
+    ABC_FREE( p->pValues );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Synchronizes the marks and the values with the AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SoaLoadMarks( Gia_Soa_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    assert( p->nObjs == Gia_ManObjNum(p->pGia) );
+    Gia_ManForEachObj( p->pGia, pObj, i )
+    {
+        p->pMarks[i]  = (unsigned char)(pObj->fMark0 | (pObj->fMark1 << 1) | (pObj->fPhase << 2));
+        p->pValues[i] = pObj->Value;
+    }
+}
+void Gia_SoaSaveMarks( Gia_Soa_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    assert( p->nObjs == Gia_ManObjNum(p->pGia) );
+    Gia_ManForEachObj( p->pGia, pObj, i )
+    {
+        pObj->fMark0 = Gia_SoaMark0( p, i );
+        pObj->fMark1 = Gia_SoaMark1( p, i );
+        pObj->fPhase = Gia_SoaPhase( p, i );
+        pObj->Value  = p->pValues[i];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the levels of the objects.]
+
+  Description [Produces the same levels and the same level count as
+  Gia_ManLevelNum().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SoaLevelNum( Gia_Soa_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    int * pFan0 = p->pFan0, * pFan1 = p->pFan1;
+    int * pLevels, i, k, Id, Level0, Level1;
+    Gia_ManCleanLevels( pGia, p->nObjs );
+    pLevels = Vec_IntArray( pGia->vLevels );
+    pGia->nLevels = 0;
+    Gia_SoaForEachAnd( p, i, k )
+    {
+        Level0 = pLevels[pFan0[i] >> 1];
+        Level1 = pLevels[pFan1[i] >> 1];
+        if ( !pGia->fGiaSimple && Gia_SoaIsBuf(p, i) )
+            pLevels[i] = Level0;
+        else
+            pLevels[i] = (Gia_SoaIsXor(p, i) ? 2 : 1) + Abc_MaxInt( Level0, Level1 );
+        pGia->nLevels = Abc_MaxInt( pGia->nLevels, pLevels[i] );
+    }
+    Gia_ManForEachCoId( pGia, Id, i )
+        pLevels[Id] = pLevels[pFan0[Id] >> 1];
+    return pGia->nLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the reference counters of the objects.]
+
+  Description [Produces the same result as Gia_ManCreateRefs().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SoaCreateRefs( Gia_Soa_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    int * pFan0 = p->pFan0, * pFan1 = p->pFan1;
+    int * pRefs, i, k, Id;
+    assert( pGia->pRefs == NULL );
+    pRefs = pGia->pRefs = ABC_CALLOC( int, p->nObjs );
+    Gia_SoaForEachAnd( p, i, k )
+    {
+        pRefs[pFan0[i] >> 1]++;
+        if ( !Gia_SoaIsBuf(p, i) )
+            pRefs[pFan1[i] >> 1]++;
+    }
+    Gia_ManForEachCoId( pGia, Id, i )
+        pRefs[pFan0[Id] >> 1]++;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -193,8 +193,10 @@ Vec_Int_t * Gia_StochProcess( Vec_Ptr_t * vGias, char * pScript, int nProcs, int
     if ( fVerbose )
         printf( "Running concurrent synthesis with %d processes.\n", nProcs ), fflush(stdout);
     Util_ProcessThreads( Gia_StochProcess1, vData, nProcs, TimeSecs, fVerbose );
-    // replace old AIGs by new AIGs
+    // replace old AIGs by new AIGs (the AIGs skipped after the timeout are kept)
     Vec_PtrForEachEntry( Gia_Man_t *, vGias, pGia, i ) {
+        if ( pData[i].pOut == NULL )
+            continue;
         Vec_IntWriteEntry( vGains, i, Gia_ManAndNum(pGia) - Gia_ManAndNum(pData[i].pOut) );
         Gia_ManStop( pGia );
         Vec_PtrWriteEntry( vGias, i, pData[i].pOut );
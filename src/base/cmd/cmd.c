@@ -944,6 +944,8 @@ int CmdCommandSetVariable( Abc_Frame_t * pAbc, int argc, char **argv )
             setvbuf( pAbc->Err, ( char * ) NULL, _IOLBF, 0 );
 #endif
         }
+        if ( strcmp( argv[1], "maxthreads" ) == 0 )
+            Util_PoolSetThreadMax( atoi(flag_value) );
         if ( strcmp( argv[1], "history" ) == 0 )
         {
             if ( pAbc->Hst != NULL )
@@ -1012,6 +1014,8 @@ int CmdCommandUnsetVariable( Abc_Frame_t * pAbc, int argc, char **argv )
             ABC_FREE( key );
             ABC_FREE( value );
         }
+        if ( strcmp( argv[i], "maxthreads" ) == 0 )
+            Util_PoolSetThreadMax( 0 );
     }
     return 0;
 
@@ -97,6 +97,8 @@ static int IoCommandWriteJsonC  ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteResub  ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteMM     ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteMMGia  ( Abc_Frame_t * pAbc, int argc, char **argv );
+static int IoCommandSaveSession ( Abc_Frame_t * pAbc, int argc, char **argv );
+static int IoCommandLoadSession ( Abc_Frame_t * pAbc, int argc, char **argv );
 
 extern void Abc_FrameCopyLTLDataBase( Abc_Frame_t *pAbc, Abc_Ntk_t * pNtk );
 
@@ -181,6 +183,8 @@ void Io_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "I/O", "&write_resub",  IoCommandWriteResub,   0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_mm",      IoCommandWriteMM,      0 );
     Cmd_CommandAdd( pAbc, "I/O", "&write_mm",     IoCommandWriteMMGia,   0 );
+    Cmd_CommandAdd( pAbc, "I/O", "save_session",  IoCommandSaveSession,  0 );
+    Cmd_CommandAdd( pAbc, "I/O", "load_session",  IoCommandLoadSession,  0 );
 }
 
 /**Function*************************************************************
@@ -4606,6 +4610,90 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IoCommandSaveSession( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    int c, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    return !Io_WriteSession( argv[globalUtilOptind], fVerbose );
+
+usage:
+    fprintf( pAbc->Err, "usage: save_session [-vh] <file>\n" );
+    fprintf( pAbc->Err, "\t         saves the current AIG (with mapping and choices), the SCL library\n" );
+    fprintf( pAbc->Err, "\t         and the DSD manager into one binary file restored by \"load_session\"\n" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h     : print the help message\n" );
+    fprintf( pAbc->Err, "\tfile   : the name of the file to write\n" );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IoCommandLoadSession( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    int c, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    return !Io_ReadSession( argv[globalUtilOptind], fVerbose );
+
+usage:
+    fprintf( pAbc->Err, "usage: load_session [-vh] <file>\n" );
+    fprintf( pAbc->Err, "\t         restores the AIG, the SCL library and the DSD manager\n" );
+    fprintf( pAbc->Err, "\t         from the file written by \"save_session\"\n" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h     : print the help message\n" );
+    fprintf( pAbc->Err, "\tfile   : the name of the file to read\n" );
+    return 1;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -162,6 +162,9 @@ extern FILE *             Io_FileOpen( const char * FileName, const char * PathV
 /*=== ioJson.c ===========================================================*/
 extern void               Io_ReadJson( char * pFileName );
 extern void               Io_WriteJson( char * pFileName );
+/*=== ioSession.c ===========================================================*/
+extern int                Io_WriteSession( char * pFileName, int fVerbose );
+extern int                Io_ReadSession( char * pFileName, int fVerbose );
 
 
 
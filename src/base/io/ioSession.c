@@ -0,0 +1,309 @@
+/**CFile****************************************************************
+
+  FileName    [ioSession.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Saving and restoring the state of the ABC frame.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: ioSession.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "ioAbc.h"
+#include "base/main/mainInt.h"
+#include "map/scl/sclLib.h"
+#include "map/mio/mio.h"
+#include "map/if/if.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The session file starts with the header (8-byte magic string, 4-byte
+// version, 4-byte number of sections), followed by the sections.
+// Each section is a 4-byte tag, a 4-byte payload size and the payload,
+// padded with zeros to the multiple of 8 bytes. Sections with unknown
+// tags are skipped by the reader.
+//   "GIA " - the current AIG in the binary AIGER format with extensions
+//            (mapping, cell mapping, choices, timing, etc)
+//   "SCL " - zero-terminated library file name followed by the library
+//            in the binary SCL format
+//   "DSD " - zero-terminated DSD manager file name followed by the manager
+
+#define IO_SESSION_MAGIC    "ABCSESS"
+#define IO_SESSION_VERSION  1
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and finalizes one section.]
+
+  Description [The size of the section is written when the section is
+  finished, because the size of the AIGER and DSD payloads is not known
+  in advance.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static long Io_SessionSectionStart( FILE * pFile, char * pTag )
+{
+    int Size = 0;
+    fwrite( pTag, 1, 4, pFile );
+    fwrite( &Size, 4, 1, pFile );
+    return ftell( pFile );
+}
+static void Io_SessionSectionStop( FILE * pFile, long Pos )
+{
+    char pZeros[8] = {0};
+    long PosEnd = ftell( pFile );
+    int Size = (int)(PosEnd - Pos);
+    fseek( pFile, Pos - 4, SEEK_SET );
+    fwrite( &Size, 4, 1, pFile );
+    fseek( pFile, PosEnd, SEEK_SET );
+    if ( Size % 8 )
+        fwrite( pZeros, 1, 8 - Size % 8, pFile );
+}
+static void Io_SessionWriteString( FILE * pFile, char * pStr )
+{
+    if ( pStr )
+        fwrite( pStr, 1, strlen(pStr), pFile );
+    fputc( 0, pFile );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the current state of the frame into a session file.]
+
+  Description [Saves the current AIG (with its mapping and choices), the
+  current SCL library and the DSD manager. Returns 1 on success.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_WriteSession( char * pFileName, int fVerbose )
+{
+    Abc_Frame_t * pAbc = Abc_FrameReadGlobalFrame();
+    Gia_Man_t * pGia = pAbc->pGia;
+    SC_Lib * pLib = (SC_Lib *)pAbc->pLibScl;
+    If_DsdMan_t * pDsd = (If_DsdMan_t *)pAbc->pManDsd;
+    int Version = IO_SESSION_VERSION, nSections = 0;
+    abctime clk = Abc_Clock();
+    FILE * pFile;
+    long Pos;
+    if ( pGia && Gia_ManCoNum(pGia) == 0 )
+        pGia = NULL;
+    if ( pGia && (pGia->nXors || pGia->nMuxes) )
+    {
+        printf( "Io_WriteSession(): Skipping the current AIG because it contains XORs or MUXes.\n" );
+        pGia = NULL;
+    }
+    nSections = (pGia != NULL) + (pLib != NULL) + (pDsd != NULL);
+    if ( nSections == 0 )
+    {
+        printf( "Io_WriteSession(): There is nothing to save.\n" );
+        return 0;
+    }
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Io_WriteSession(): Cannot open the output file \"%s\".\n", pFileName );
+        return 0;
+    }
+    fwrite( IO_SESSION_MAGIC, 1, 8, pFile );
+    fwrite( &Version, 4, 1, pFile );
+    fwrite( &nSections, 4, 1, pFile );
+    if ( pGia )
+    {
+        Pos = Io_SessionSectionStart( pFile, "GIA " );
+        if ( !Gia_AigerWriteFile( pGia, pFile, 0, 0, 0, 1 ) )
+        {
+            fclose( pFile );
+            return 0;
+        }
+        Io_SessionSectionStop( pFile, Pos );
+    }
+    if ( pLib )
+    {
+        Vec_Str_t * vOut = Abc_SclWriteToStr( pLib );
+        Pos = Io_SessionSectionStart( pFile, "SCL " );
+        Io_SessionWriteString( pFile, pLib->pFileName );
+        fwrite( Vec_StrArray(vOut), 1, Vec_StrSize(vOut), pFile );
+        Io_SessionSectionStop( pFile, Pos );
+        Vec_StrFree( vOut );
+    }
+    if ( pDsd )
+    {
+        Pos = Io_SessionSectionStart( pFile, "DSD " );
+        Io_SessionWriteString( pFile, If_DsdManFileName(pDsd) );
+        If_DsdManSaveFile( pDsd, pFile );
+        Io_SessionSectionStop( pFile, Pos );
+    }
+    if ( fVerbose )
+    {
+        printf( "Saved %d section(s) into session file \"%s\" (%.2f MB).  ", nSections, pFileName, 1.0*ftell(pFile)/(1<<20) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the state of the frame from a session file.]
+
+  Description [The file is memory-mapped when possible, so that the AIG
+  and the library are parsed directly from the mapped pages. The state
+  of the frame is updated only after all sections have been read.
+  Returns 1 on success.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_ReadSession( char * pFileName, int fVerbose )
+{
+    extern void Abc_SclLoad( SC_Lib * pLib, SC_Lib ** ppScl );
+    Abc_Frame_t * pAbc = Abc_FrameReadGlobalFrame();
+    Gia_Man_t * pGia = NULL;
+    SC_Lib * pLib = NULL;
+    If_DsdMan_t * pDsd = NULL;
+    char * pContents, * pCur, * pName, * pEnd;
+    int i, Size, Version, nSections, fMapped = 1, RetValue = 0;
+    ABC_INT64_T nFileSize = 0;
+    abctime clk = Abc_Clock();
+    pContents = Abc_FileMap( pFileName, &nFileSize );
+    if ( pContents == NULL )
+    {
+        FILE * pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+        {
+            printf( "Io_ReadSession(): Cannot open the input file \"%s\".\n", pFileName );
+            return 0;
+        }
+        nFileSize = Abc_FileSize64( pFileName );
+        if ( nFileSize < 0 || (ABC_INT64_T)(size_t)nFileSize != nFileSize )
+        {
+            printf( "Io_ReadSession(): Cannot read the input file \"%s\".\n", pFileName );
+            fclose( pFile );
+            return 0;
+        }
+        pContents = ABC_ALLOC( char, (size_t)nFileSize + 1 );
+        nFileSize = (ABC_INT64_T)fread( pContents, 1, (size_t)nFileSize, pFile );
+        fclose( pFile );
+        fMapped = 0;
+    }
+    if ( nFileSize < 16 || strncmp(pContents, IO_SESSION_MAGIC, 8) )
+    {
+        printf( "Io_ReadSession(): File \"%s\" is not an ABC session file.\n", pFileName );
+        goto finish;
+    }
+    Version   = *(int *)(pContents + 8);
+    nSections = *(int *)(pContents + 12);
+    if ( Version != IO_SESSION_VERSION )
+    {
+        printf( "Io_ReadSession(): File \"%s\" has version %d while version %d is expected.\n", pFileName, Version, IO_SESSION_VERSION );
+        goto finish;
+    }
+    pCur = pContents + 16;
+    for ( i = 0; i < nSections; i++ )
+    {
+        if ( pCur + 8 > pContents + nFileSize )
+            break;
+        Size = *(int *)(pCur + 4);
+        if ( Size < 0 || pCur + 8 + Size > pContents + nFileSize )
+            break;
+        if ( !strncmp(pCur, "GIA ", 4) && pGia == NULL )
+        {
+            // skip structural hashing to keep the mapping and the choices
+            pGia = Gia_AigerReadFromMemory( pCur + 8, Size, 0, 1, 0 );
+            if ( pGia == NULL )
+                break;
+            pGia->pSpec = Abc_UtilStrsav( pFileName );
+        }
+        else if ( !strncmp(pCur, "SCL ", 4) && pLib == NULL )
+        {
+            Vec_Str_t vOut;
+            // the section starts with the zero-terminated library name
+            pName = pCur + 8;
+            pEnd  = (char *)memchr( pName, 0, (size_t)Size );
+            if ( pEnd == NULL )
+                break;
+            vOut.pArray = pEnd + 1;
+            vOut.nSize  = vOut.nCap = Size - (int)(pEnd + 1 - pName);
+            pLib = Abc_SclReadFromStr( &vOut );
+            if ( pLib == NULL )
+                break;
+            pLib->pFileName = Abc_UtilStrsav( pName );
+        }
+        else if ( !strncmp(pCur, "DSD ", 4) && pDsd == NULL )
+        {
+            // the section starts with the zero-terminated manager name
+            pName = pCur + 8;
+            pEnd  = (char *)memchr( pName, 0, (size_t)Size );
+            if ( pEnd == NULL )
+                break;
+            pDsd = If_DsdManLoadBuffer( pEnd + 1, Size - (int)(pEnd + 1 - pName), pName );
+            if ( pDsd == NULL )
+                break;
+        }
+        pCur += 8 + Size + (Size % 8 ? 8 - Size % 8 : 0);
+    }
+    if ( i < nSections )
+    {
+        printf( "Io_ReadSession(): Section %d of file \"%s\" is corrupted.\n", i, pFileName );
+        if ( pGia ) Gia_ManStop( pGia );
+        if ( pLib ) Abc_SclLibFree( pLib );
+        if ( pDsd ) If_DsdManFree( pDsd, 0 );
+        goto finish;
+    }
+    // update the frame
+    if ( pGia )
+        Abc_FrameUpdateGia( pAbc, pGia );
+    if ( pLib )
+    {
+        Abc_SclLoad( pLib, (SC_Lib **)&pAbc->pLibScl );
+        Abc_SclInstallGenlib( pAbc->pLibScl, 0, 0, 0, 0 );
+        Mio_LibraryTransferCellIds();
+    }
+    if ( pDsd )
+        Abc_FrameSetManDsd( pDsd );
+    if ( fVerbose )
+    {
+        printf( "Restored %d section(s) from session file \"%s\" (%.2f MB).  ", nSections, pFileName, 1.0*nFileSize/(1<<20) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    RetValue = 1;
+finish:
+    if ( fMapped )
+        Abc_FileUnmap( pContents, nFileSize );
+    else
+        ABC_FREE( pContents );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -128,6 +128,40 @@ void        Abc_FrameSetArrayMapping( int * p )              { ABC_FREE( s_Globa
 int *       Abc_FrameReadBoxes( Abc_Frame_t * pAbc )         { return pAbc->pBoxes;                                            }
 void        Abc_FrameSetBoxes( int * p )                     { ABC_FREE( s_GlobalFrame->pBoxes ); s_GlobalFrame->pBoxes = p;   }      
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the truth table store shared by the mappers.]
+
+  Description [The store for the functions of nVars variables is created 
+  on the first request and kept until the frame is deallocated, so that 
+  the mapping runs in one session reuse the truth tables. Returns NULL
+  if the frame is not started. Can be called by several threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_FrameReadTtStore( int nVars )
+{
+    static int Lock = 0;
+    Vec_MemMt_t * pStore;
+    if ( s_GlobalFrame == NULL )
+        return NULL;
+    Vec_MemMtLock( &Lock );
+    if ( s_GlobalFrame->vTtStores == NULL )
+        s_GlobalFrame->vTtStores = Vec_PtrAlloc( 16 );
+    Vec_PtrFillExtra( s_GlobalFrame->vTtStores, nVars + 1, NULL );
+    pStore = (Vec_MemMt_t *)Vec_PtrEntry( s_GlobalFrame->vTtStores, nVars );
+    if ( pStore == NULL )
+    {
+        pStore = Vec_MemMtAllocForTT( nVars, 0 );
+        Vec_PtrWriteEntry( s_GlobalFrame->vTtStores, nVars, pStore );
+    }
+    Vec_MemMtUnlock( &Lock );
+    return pStore;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns 1 if the flag is enabled without value or with value 1.]
@@ -208,11 +242,14 @@ Abc_Frame_t * Abc_FrameAllocate()
 void Abc_FrameDeallocate( Abc_Frame_t * p )
 {
     extern void Rwt_ManGlobalStop();
+    extern void Gia_ManRecycleStop();
     extern void undefine_cube_size();
 //    extern void Ivy_TruthManStop();
 //    Abc_HManStop();
 //    undefine_cube_size();
     Rwt_ManGlobalStop();
+    Util_PoolStop();
+    Gia_ManRecycleStop();
 //    Ivy_TruthManStop();
     if ( p->vAbcObjIds)  Vec_IntFree( p->vAbcObjIds );
     if ( p->vCexVec   )  Vec_PtrFreeFree( p->vCexVec );
@@ -229,6 +266,14 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     if ( p->pSave4    )  Aig_ManStop( (Aig_Man_t *)p->pSave4 );
     if ( p->pManDsd   )  If_DsdManFree( (If_DsdMan_t *)p->pManDsd, 0 );
     if ( p->pManDsd2  )  If_DsdManFree( (If_DsdMan_t *)p->pManDsd2, 0 );
+    if ( p->vTtStores )
+    {
+        Vec_MemMt_t * pStore;
+        int i;
+        Vec_PtrForEachEntry( Vec_MemMt_t *, p->vTtStores, pStore, i )
+            Vec_MemMtFree( pStore );
+        Vec_PtrFree( p->vTtStores );
+    }
     if ( p->pNtkBackup)  Abc_NtkDelete( p->pNtkBackup );
     if ( p->vPlugInComBinPairs ) 
     {
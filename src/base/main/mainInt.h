@@ -98,6 +98,7 @@ struct Abc_Frame_t_
     void *          pManDec;       // decomposition manager
     void *          pManDsd;       // decomposition manager
     void *          pManDsd2;      // decomposition manager
+    Vec_Ptr_t *     vTtStores;     // truth tables shared by the mappers (indexed by the number of variables)
     // libraries for mapping
     void *          pLibLut[ABC_LUT_LIBS]; // the current LUT library
     void *          pLibCell;      // the current cell library
@@ -52,6 +52,8 @@ struct Amap_Par_t_
     int    fFreeInvs;   // assume inverters are free (area = 0)
     float  fEpsilon;    // used to compare floating point numbers
     float  fADratio;    // ratio of area/delay improvement
+    int    nProcs;      // the number of threads
+    int    nPartSize;   // the number of AIG nodes in one partition (multi-threaded mapping)
     int    fVerbose;    // verbosity flag
 };
 
@@ -53,33 +53,27 @@ void Amap_ManSetDefaultParams( Amap_Par_t * p )
     p->fUseXors  = 1;            // enables the use of XORs
     p->fFreeInvs = 0;            // assume inverters are free (area = 0)
     p->fEpsilon  = (float)0.001; // used to compare floating point numbers
+    p->nProcs    = 1;            // the number of threads
+    p->nPartSize = 20000;        // the number of AIG nodes in one partition
     p->fVerbose  = 0;            // verbosity flag
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Maps the AIG using the given library.]
 
-  Description []
+  Description [Returns the mapped network as an array of structures
+  (see Amap_ManProduceMapped).]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Ptr_t * Amap_ManTest( Aig_Man_t * pAig, Amap_Par_t * pPars )
+Vec_Ptr_t * Amap_ManPerform( Aig_Man_t * pAig, Amap_Lib_t * pLib, Amap_Par_t * pPars )
 {
-//    extern void * Abc_FrameReadLibGen2();
     Vec_Ptr_t * vRes;
     Amap_Man_t * p;
-    Amap_Lib_t * pLib;
-    abctime clkTotal = Abc_Clock();
-    pLib = (Amap_Lib_t *)Abc_FrameReadLibGen2();
-    if ( pLib == NULL )
-    {
-        printf( "Library is not available.\n" );
-        return NULL;
-    }
     p = Amap_ManStart( Aig_ManNodeNum(pAig) );
     p->pPars = pPars;
     p->pLib  = pLib;
@@ -90,9 +84,38 @@ Vec_Ptr_t * Amap_ManTest( Aig_Man_t * pAig, Amap_Par_t * pPars )
     p->pMatsTemp = ABC_CALLOC( int, 2 * pLib->nNodes );
     Amap_ManCreate( p, pAig );
     Amap_ManMap( p );
-    vRes = NULL;
     vRes = Amap_ManProduceMapped( p );
     Amap_ManStop( p );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Amap_ManTest( Aig_Man_t * pAig, Amap_Par_t * pPars )
+{
+//    extern void * Abc_FrameReadLibGen2();
+    Vec_Ptr_t * vRes;
+    Amap_Lib_t * pLib;
+    abctime clkTotal = Abc_Clock();
+    pLib = (Amap_Lib_t *)Abc_FrameReadLibGen2();
+    if ( pLib == NULL )
+    {
+        printf( "Library is not available.\n" );
+        return NULL;
+    }
+    if ( pPars->nProcs > 1 && pAig->pEquivs == NULL )
+        vRes = Amap_ManPerformPart( pAig, pLib, pPars );
+    else
+        vRes = Amap_ManPerform( pAig, pLib, pPars );
 if ( pPars->fVerbose )
 {
 ABC_PRT( "Total runtime", Abc_Clock() - clkTotal );
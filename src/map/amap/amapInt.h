@@ -324,6 +324,7 @@ extern void Kit_DsdPrintFromTruth( unsigned * pTruth, int nVars );
 ////////////////////////////////////////////////////////////////////////
 
 /*=== amapCore.c ==========================================================*/
+extern Vec_Ptr_t *   Amap_ManPerform( Aig_Man_t * pAig, Amap_Lib_t * pLib, Amap_Par_t * pPars );
 /*=== amapGraph.c ==========================================================*/
 extern Amap_Obj_t *  Amap_ManCreatePi( Amap_Man_t * p );
 extern Amap_Obj_t *  Amap_ManCreatePo( Amap_Man_t * p, Amap_Obj_t * pFan0 );
@@ -345,7 +346,10 @@ extern void          Amap_ManMap( Amap_Man_t * p );
 /*=== amapMerge.c ==========================================================*/
 extern void          Amap_ManMerge( Amap_Man_t * p );
 /*=== amapOutput.c ==========================================================*/
+extern Amap_Out_t *  Amap_OutputStructAlloc( Aig_MmFlex_t * pMem, Amap_Gat_t * pGate );
 extern Vec_Ptr_t *   Amap_ManProduceMapped( Amap_Man_t * p );
+/*=== amapPart.c ==========================================================*/
+extern Vec_Ptr_t *   Amap_ManPerformPart( Aig_Man_t * pAig, Amap_Lib_t * pLib, Amap_Par_t * pPars );
 /*=== amapParse.c ==========================================================*/
 extern int           Amap_LibParseEquations( Amap_Lib_t * p, int fVerbose );
 /*=== amapPerm.c ==========================================================*/
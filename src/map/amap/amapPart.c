@@ -0,0 +1,347 @@
+/**CFile****************************************************************
+
+  FileName    [amapPart.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Technology mapper for standard cells.]
+
+  Synopsis    [Multi-threaded mapping of the design partitions.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: amapPart.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "amapInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Amap_Part_t_ Amap_Part_t;
+struct Amap_Part_t_
+{
+    Aig_Man_t *        pAig;       // the AIG of the partition
+    Vec_Int_t *        vIns;       // the original objects driving the CIs of the partition
+    Vec_Int_t *        vOuts;      // the original nodes (or -1-CoId) driven by the COs of the partition
+    Amap_Lib_t *       pLib;       // the library (shared by all partitions)
+    Amap_Par_t         Pars;       // the mapping parameters
+    Vec_Ptr_t *        vRes;       // the mapped partition
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Divides the AIG into partitions.]
+
+  Description [The nodes are ordered by DFS from the COs and the order
+  is cut into the chunks of nPartSize nodes. The chunks are topologically
+  ordered: the fanins of a node belong to the same or earlier chunk.
+  Each partition is a separate AIG whose CIs are the CIs and the nodes
+  of the earlier partitions used in this partition, and whose COs are
+  the nodes used in the later partitions followed by the COs of the
+  design driven by the nodes of this partition. The partitioning does
+  not depend on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Amap_ManPartition( Aig_Man_t * pAig, int nPartSize )
+{
+    Vec_Ptr_t * vParts, * vNodes;
+    Vec_Int_t * vPartIds, * vCoParts;
+    Vec_Str_t * vUsed;
+    Aig_Obj_t * pObj, * pFanin;
+    Amap_Part_t * pPart;
+    int i, k, f, iStart, nParts;
+    vNodes = Aig_ManDfs( pAig, 1 );
+    nParts = (Vec_PtrSize(vNodes) + nPartSize - 1) / nPartSize;
+    // assign the nodes to the partitions and mark the nodes used in the other partitions
+    vPartIds = Vec_IntStartFull( Aig_ManObjNumMax(pAig) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        Vec_IntWriteEntry( vPartIds, Aig_ObjId(pObj), i / nPartSize );
+    vUsed = Vec_StrStart( Aig_ManObjNumMax(pAig) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        for ( f = 0; f < 2; f++ )
+        {
+            pFanin = f ? Aig_ObjFanin1(pObj) : Aig_ObjFanin0(pObj);
+            if ( Aig_ObjIsNode(pFanin) && Vec_IntEntry(vPartIds, Aig_ObjId(pFanin)) != i / nPartSize )
+                Vec_StrWriteEntry( vUsed, Aig_ObjId(pFanin), 1 );
+        }
+    // the COs driven by the nodes of each partition
+    vCoParts = Vec_IntStartFull( Aig_ManCoNum(pAig) );
+    Aig_ManForEachCo( pAig, pObj, i )
+        if ( Aig_ObjIsNode(Aig_ObjFanin0(pObj)) )
+            Vec_IntWriteEntry( vCoParts, i, Vec_IntEntry(vPartIds, Aig_ObjFaninId0(pObj)) );
+    // create the partitions
+    vParts = Vec_PtrAlloc( nParts );
+    for ( k = 0; k < nParts; k++ )
+    {
+        pPart = ABC_CALLOC( Amap_Part_t, 1 );
+        pPart->pAig  = Aig_ManStart( nPartSize );
+        pPart->vIns  = Vec_IntAlloc( 100 );
+        pPart->vOuts = Vec_IntAlloc( 100 );
+        Vec_PtrPush( vParts, pPart );
+        Aig_ManIncrementTravId( pAig );
+        Aig_ManConst1(pAig)->pData = Aig_ManConst1(pPart->pAig);
+        Aig_ObjSetTravIdCurrent( pAig, Aig_ManConst1(pAig) );
+        iStart = k * nPartSize;
+        for ( i = iStart; i < Abc_MinInt(iStart + nPartSize, Vec_PtrSize(vNodes)); i++ )
+        {
+            pObj = (Aig_Obj_t *)Vec_PtrEntry( vNodes, i );
+            for ( f = 0; f < 2; f++ )
+            {
+                pFanin = f ? Aig_ObjFanin1(pObj) : Aig_ObjFanin0(pObj);
+                if ( Aig_ObjIsTravIdCurrent(pAig, pFanin) )
+                    continue;
+                Aig_ObjSetTravIdCurrent( pAig, pFanin );
+                pFanin->pData = Aig_ObjCreateCi( pPart->pAig );
+                Vec_IntPush( pPart->vIns, Aig_ObjId(pFanin) );
+            }
+            Aig_ObjSetTravIdCurrent( pAig, pObj );
+            pObj->pData = Aig_And( pPart->pAig, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        }
+        for ( i = iStart; i < Abc_MinInt(iStart + nPartSize, Vec_PtrSize(vNodes)); i++ )
+        {
+            pObj = (Aig_Obj_t *)Vec_PtrEntry( vNodes, i );
+            if ( !Vec_StrEntry(vUsed, Aig_ObjId(pObj)) )
+                continue;
+            Aig_ObjCreateCo( pPart->pAig, (Aig_Obj_t *)pObj->pData );
+            Vec_IntPush( pPart->vOuts, Aig_ObjId(pObj) );
+        }
+        Aig_ManForEachCo( pAig, pObj, i )
+        {
+            if ( Vec_IntEntry(vCoParts, i) != k )
+                continue;
+            Aig_ObjCreateCo( pPart->pAig, Aig_ObjChild0Copy(pObj) );
+            Vec_IntPush( pPart->vOuts, -1-i );
+        }
+    }
+    Vec_IntFree( vCoParts );
+    Vec_StrFree( vUsed );
+    Vec_IntFree( vPartIds );
+    Vec_PtrFree( vNodes );
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps one partition.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Amap_ManPartTask( void * pArg )
+{
+    Amap_Part_t * pPart = (Amap_Part_t *)pArg;
+    pPart->vRes = Amap_ManPerform( pPart->pAig, pPart->pLib, &pPart->Pars );
+    Aig_ManStop( pPart->pAig );
+    pPart->pAig = NULL;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies one gate into the resulting mapping.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Amap_Out_t * Amap_ManPartDupOut( Aig_MmFlex_t * pMem, Amap_Out_t * pOut )
+{
+    int nBytes = sizeof(Amap_Out_t) + sizeof(int) * pOut->nFans;
+    Amap_Out_t * pRes = (Amap_Out_t *)Aig_MmFlexEntryFetch( pMem, nBytes );
+    memcpy( pRes, pOut, nBytes );
+    pRes->pName = strcpy( Aig_MmFlexEntryFetch(pMem, strlen(pOut->pName)+1), pOut->pName );
+    return pRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Combines the mapped partitions.]
+
+  Description [Visits the partitions in the topological order and replaces
+  the inputs of each partition by the gates of the earlier partitions.
+  The result has the same format as that of Amap_ManProduceMapped().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Amap_ManPartStitch( Aig_Man_t * pAig, Amap_Lib_t * pLib, Vec_Ptr_t * vParts )
+{
+    Vec_Ptr_t * vRes;
+    Vec_Int_t * vSigs, * vCoSigs, * vMap;
+    Aig_MmFlex_t * pMem;
+    Amap_Part_t * pPart;
+    Amap_Out_t * pOut, * pRes;
+    Aig_Obj_t * pObj, * pFanin;
+    int i, k, f, iCi, iCo, iSig;
+    pMem    = Aig_MmFlexStart();
+    vRes    = Vec_PtrAlloc( 1000 );
+    vSigs   = Vec_IntStartFull( Aig_ManObjNumMax(pAig) );
+    vCoSigs = Vec_IntStartFull( Aig_ManCoNum(pAig) );
+    vMap    = Vec_IntAlloc( 1000 );
+    // the CIs come first
+    Aig_ManForEachCi( pAig, pObj, i )
+    {
+        pRes = Amap_OutputStructAlloc( pMem, NULL );
+        pRes->Type  = -1;
+        pRes->nFans = 0;
+        Vec_IntWriteEntry( vSigs, Aig_ObjId(pObj), Vec_PtrSize(vRes) );
+        Vec_PtrPush( vRes, pRes );
+    }
+    // add the gates of each partition
+    Vec_PtrForEachEntry( Amap_Part_t *, vParts, pPart, k )
+    {
+        Vec_IntClear( vMap );
+        iCi = iCo = 0;
+        Vec_PtrForEachEntryStop( Amap_Out_t *, pPart->vRes, pOut, i, Vec_PtrSize(pPart->vRes)-1 )
+        {
+            if ( pOut->Type == -1 )
+            {
+                iSig = Vec_IntEntry( vSigs, Vec_IntEntry(pPart->vIns, iCi++) );
+                assert( iSig >= 0 );
+                Vec_IntPush( vMap, iSig );
+            }
+            else if ( pOut->Type == 1 )
+            {
+                iSig = Vec_IntEntry( pPart->vOuts, iCo++ );
+                if ( iSig >= 0 )
+                    Vec_IntWriteEntry( vSigs, iSig, Vec_IntEntry(vMap, pOut->pFans[0]) );
+                else
+                    Vec_IntWriteEntry( vCoSigs, -1-iSig, Vec_IntEntry(vMap, pOut->pFans[0]) );
+                Vec_IntPush( vMap, -1 );
+            }
+            else
+            {
+                pRes = Amap_ManPartDupOut( pMem, pOut );
+                for ( f = 0; f < pRes->nFans; f++ )
+                    pRes->pFans[f] = Vec_IntEntry( vMap, pRes->pFans[f] );
+                Vec_IntPush( vMap, Vec_PtrSize(vRes) );
+                Vec_PtrPush( vRes, pRes );
+            }
+        }
+        assert( iCi == Vec_IntSize(pPart->vIns) );
+        assert( iCo == Vec_IntSize(pPart->vOuts) );
+        Aig_MmFlexStop( (Aig_MmFlex_t *)Vec_PtrEntryLast(pPart->vRes), 0 );
+        Vec_PtrFree( pPart->vRes );
+        pPart->vRes = NULL;
+    }
+    // add the COs
+    Aig_ManForEachCo( pAig, pObj, i )
+    {
+        pFanin = Aig_ObjFanin0(pObj);
+        if ( Aig_ObjIsNode(pFanin) )
+            iSig = Vec_IntEntry( vCoSigs, i );
+        else
+        {
+            if ( Aig_ObjIsConst1(pFanin) )
+                pRes = Amap_OutputStructAlloc( pMem, Aig_ObjFaninC0(pObj) ? pLib->pGate0 : pLib->pGate1 );
+            else if ( Aig_ObjFaninC0(pObj) )
+            {
+                pRes = Amap_OutputStructAlloc( pMem, pLib->pGateInv );
+                pRes->pFans[0] = Vec_IntEntry( vSigs, Aig_ObjId(pFanin) );
+            }
+            else
+                pRes = NULL;
+            if ( pRes )
+            {
+                iSig = Vec_PtrSize(vRes);
+                Vec_PtrPush( vRes, pRes );
+            }
+            else
+                iSig = Vec_IntEntry( vSigs, Aig_ObjId(pFanin) );
+        }
+        assert( iSig >= 0 );
+        pRes = Amap_OutputStructAlloc( pMem, NULL );
+        pRes->Type     = 1;
+        pRes->pFans[0] = iSig;
+        Vec_PtrPush( vRes, pRes );
+    }
+    Vec_IntFree( vMap );
+    Vec_IntFree( vCoSigs );
+    Vec_IntFree( vSigs );
+    // return memory manager in the last entry of the array
+    Vec_PtrPush( vRes, pMem );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the AIG in partitions using several threads.]
+
+  Description [The partitions are mapped independently by the threads,
+  which share the read-only library, and are combined in the fixed order.
+  The result does not depend on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Amap_ManPerformPart( Aig_Man_t * pAig, Amap_Lib_t * pLib, Amap_Par_t * pPars )
+{
+    Util_PoolGroup_t * pGroup;
+    Vec_Ptr_t * vParts, * vRes;
+    Amap_Part_t * pPart;
+    abctime clk = Abc_Clock();
+    int i;
+    vParts = Amap_ManPartition( pAig, Abc_MaxInt(pPars->nPartSize, 1) );
+    Vec_PtrForEachEntry( Amap_Part_t *, vParts, pPart, i )
+    {
+        pPart->pLib = pLib;
+        pPart->Pars = *pPars;
+        pPart->Pars.fVerbose = 0;
+    }
+    pGroup = Util_PoolGroupStart( pPars->nProcs, 0 );
+    Vec_PtrForEachEntry( Amap_Part_t *, vParts, pPart, i )
+        Util_PoolGroupAdd( pGroup, Amap_ManPartTask, pPart );
+    Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
+    vRes = Amap_ManPartStitch( pAig, pLib, vParts );
+    if ( pPars->fVerbose )
+    {
+        printf( "Mapped %d partitions with up to %d nodes using %d threads.  ", Vec_PtrSize(vParts), pPars->nPartSize, pPars->nProcs );
+        ABC_PRT( "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrForEachEntry( Amap_Part_t *, vParts, pPart, i )
+    {
+        Vec_IntFree( pPart->vIns );
+        Vec_IntFree( pPart->vOuts );
+        ABC_FREE( pPart );
+    }
+    Vec_PtrFree( vParts );
+    return vRes;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -36,6 +36,7 @@
 #include "misc/tim/tim.h"
 #include "misc/util/utilNam.h"
 #include "misc/vec/vecMem.h"
+#include "misc/vec/vecMemMt.h"
 #include "misc/util/utilTruth.h"
 #include "opt/dau/dau.h"
 #include "misc/vec/vecHash.h"
@@ -115,6 +116,7 @@ struct If_Par_t_
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
     int                nLutDecSize;   // the LUT size for decomposition
+    int                nProcs;        // the number of threads
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -152,6 +154,7 @@ struct If_Par_t_
     int                fUserLutDec;   // perform Boolean decomposition during mapping
     int                fUserLut2D;    // perform Boolean decomposition during mapping
     int                fDumpFile;     // dumping truth tables into a file
+    int                fTtShared;     // use the truth tables shared by the mappers in this session
     int                fVerbose;      // the verbosity flag
     int                fVerboseTrace; // the verbosity flag
     char *             pLutStruct;    // LUT structure
@@ -275,6 +278,7 @@ struct If_Man_t_
     int                nCuts5, nCuts5a;
     If_DsdMan_t *      pIfDsdMan;     // DSD manager
     Vec_Mem_t *        vTtMem[IF_MAX_FUNC_LUTSIZE+1];   // truth table memory and hash table
+    Vec_MemMt_t *      vTtMemMt[IF_MAX_FUNC_LUTSIZE+1]; // shared truth table store (vTtMem points to its memory)
     Vec_Wec_t *        vTtIsops[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table into DSD
     Vec_Int_t *        vTtDsds[IF_MAX_FUNC_LUTSIZE+1];  // mapping of truth table into DSD
     Vec_Str_t *        vTtPerms[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table into permutations
@@ -333,7 +337,7 @@ struct If_Cut_t_
     word               Config;        // configuration string
     int                iCutFunc;      // TT ID of the cut
     int                uMaskFunc;     // polarity bitmask
-    unsigned           uSign;         // cut signature
+    word               uSign;         // cut signature
     unsigned           Cost    : 12;  // the user's cost of the cut (related to IF_COST_MAX)
     unsigned           fCompl  :  1;  // the complemented attribute 
     unsigned           fUser   :  1;  // using the user's area and delay
@@ -455,8 +459,8 @@ static inline void       If_CutCopy( If_Man_t * p, If_Cut_t * pDst, If_Cut_t * p
 static inline void       If_CutSetup( If_Man_t * p, If_Cut_t * pCut        ) { memset(pCut, 0, (size_t)p->nCutBytes); pCut->nLimit = p->pPars->nLutSize; }
 
 static inline If_Cut_t * If_ObjCutBest( If_Obj_t * pObj )                    { return &pObj->CutBest;                }
-static inline unsigned   If_ObjCutSign( unsigned ObjId )                     { return (1 << (ObjId % 31));           }
-static inline unsigned   If_ObjCutSignCompute( If_Cut_t * p )                { unsigned s = 0; int i; for ( i = 0; i < If_CutLeaveNum(p); i++ ) s |= If_ObjCutSign(p->pLeaves[i]); return s; }
+static inline word       If_ObjCutSign( unsigned ObjId )                     { return ((word)1 << (ObjId % 63));     }
+static inline word       If_ObjCutSignCompute( If_Cut_t * p )                { word s = 0; int i; for ( i = 0; i < If_CutLeaveNum(p); i++ ) s |= If_ObjCutSign(p->pLeaves[i]); return s; }
 
 static inline float      If_ObjArrTime( If_Obj_t * pObj )                    { return If_ObjCutBest(pObj)->Delay;    }
 static inline void       If_ObjSetArrTime( If_Obj_t * pObj, float ArrTime )  { If_ObjCutBest(pObj)->Delay = ArrTime; }
@@ -473,6 +477,7 @@ static inline void       If_CutSetDataInt( If_Cut_t * pCut, int Data )       { *
 static inline int        If_CutTruthLit( If_Cut_t * pCut )                   { assert( pCut->iCutFunc >= 0 ); return pCut->iCutFunc;             }
 static inline int        If_CutTruthIsCompl( If_Cut_t * pCut )               { assert( pCut->iCutFunc >= 0 ); return Abc_LitIsCompl(pCut->iCutFunc);                               }
 static inline word *     If_CutTruthWR( If_Man_t * p, If_Cut_t * pCut )      { return p->vTtMem[pCut->nLeaves] ? Vec_MemReadEntry(p->vTtMem[pCut->nLeaves], Abc_Lit2Var(pCut->iCutFunc)) : NULL;  }
+static inline int        If_ManTtInsert( If_Man_t * p, int nLeaves, word * pTruth ) { return p->vTtMemMt[nLeaves] ? Vec_MemMtInsert(p->vTtMemMt[nLeaves], pTruth) : Vec_MemHashInsert(p->vTtMem[nLeaves], pTruth); }
 static inline unsigned * If_CutTruthUR( If_Man_t * p, If_Cut_t * pCut)       { return (unsigned *)If_CutTruthWR(p, pCut);                        }
 static inline word *     If_CutTruthW( If_Man_t * p, If_Cut_t * pCut )       { assert( pCut->iCutFunc >= 0 ); Abc_TtCopy( p->puTempW, If_CutTruthWR(p, pCut), p->nTruth6Words[pCut->nLeaves], If_CutTruthIsCompl(pCut) ); return p->puTempW;  }
 static inline unsigned * If_CutTruth( If_Man_t * p, If_Cut_t * pCut )        { return (unsigned *)If_CutTruthW(p, pCut);                         }
@@ -547,6 +552,7 @@ extern int             If_ManPerformMapping( If_Man_t * p );
 extern int             If_ManPerformMappingComb( If_Man_t * p );
 extern void            If_ManComputeSwitching( If_Man_t * p );
 /*=== ifCut.c ============================================================*/
+extern int             If_CutSimdEnable( int fEnable );
 extern int             If_CutVerifyCuts( If_Set_t * pCutSet, int fOrdered );
 extern int             If_CutFilter( If_Set_t * pCutSet, If_Cut_t * pCut, int fSaveCut0 );
 extern void            If_CutSort( If_Man_t * p, If_Set_t * pCutSet, If_Cut_t * pCut );
@@ -616,9 +622,14 @@ extern void            If_DsdManPrint( If_DsdMan_t * p, char * pFileName, int Nu
 extern void            If_DsdManTune( If_DsdMan_t * p, int LutSize, int fFast, int fAdd, int fSpec, int fVerbose );
 extern void            Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, int nInputs, int fVerbose );
 extern void            If_DsdManFree( If_DsdMan_t * p, int fVerbose );
+extern void            If_DsdManSaveFile( If_DsdMan_t * p, FILE * pFile );
 extern void            If_DsdManSave( If_DsdMan_t * p, char * pFileName );
+extern If_DsdMan_t *   If_DsdManLoadFile( FILE * pFile, char * pFileName );
+extern If_DsdMan_t *   If_DsdManLoadBuffer( char * pBuffer, int nSize, char * pFileName );
 extern If_DsdMan_t *   If_DsdManLoad( char * pFileName );
 extern void            If_DsdManMerge( If_DsdMan_t * p, If_DsdMan_t * pNew );
+extern If_DsdMan_t *   If_DsdManCacheLoad( char * pFileName, int nVars, int LutSize, int fVerbose );
+extern int             If_DsdManCacheSave( If_DsdMan_t * p, char * pFileName, int fVerbose );
 extern void            If_DsdManCleanOccur( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManCleanMarks( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManInvertMarks( If_DsdMan_t * p, int fVerbose );
@@ -689,6 +700,9 @@ extern void            If_ManSetupSetAll( If_Man_t * p, int nCrossCut );
 extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
+extern int             If_ManMappingRoundIsParallel( If_Man_t * p, int Mode );
+extern int             If_ManCrossCutLevels( If_Man_t * p );
+extern void            If_ManPerformMappingLevels( If_Man_t * p, int Mode, int fPreprocess, int fFirst, char * pLabel );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
 /*=== ifReduce.c ==========================================================*/
 extern void            If_ManImproveMapping( If_Man_t * p );
@@ -51,6 +51,7 @@ void If_ManSetDefaultPars( If_Par_t * pPars )
     pPars->nCutsMax    =  8;
     pPars->nFlowIters  =  1;
     pPars->nAreaIters  =  2;
+    pPars->nProcs      =  1;
     pPars->DelayTarget = -1;
     pPars->Epsilon     =  (float)0.005;
     pPars->fPreprocess =  1;
@@ -64,6 +65,7 @@ void If_ManSetDefaultPars( If_Par_t * pPars )
     pPars->fBidec      =  0;
     pPars->fUserLutDec =  0;
     pPars->fUserLut2D  =  0;
+    pPars->fTtShared   =  1;
     pPars->fVerbose    =  0;
 }
 
@@ -85,7 +87,10 @@ int If_ManPerformMapping( If_Man_t * p )
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
     // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    if ( If_ManMappingRoundIsParallel(p, 0) )
+        If_ManSetupSetAll( p, Abc_MaxInt(If_ManCrossCut(p), If_ManCrossCutLevels(p)) );
+    else
+        If_ManSetupSetAll( p, If_ManCrossCut(p) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
     return If_ManPerformMappingComb( p );
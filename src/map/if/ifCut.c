@@ -20,6 +20,11 @@
 
 #include "if.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IF_CUT_USE_AVX
+#include <immintrin.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,10 +32,196 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// set to 1 if the AVX2 versions of cut merging and filtering are used
+static int If_CutUseAvx2 = -1;
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Selects the vector implementation of cut merging and filtering.]
+
+  Description [The AVX2 procedures are compiled with the target attribute
+  and used only if the CPU supports them. They produce the same cuts as
+  the scalar procedures. If fEnable is -1, selects the default (AVX2 when 
+  available) unless the choice has already been made. Returns the previous
+  setting.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_CutSimdEnable( int fEnable )
+{
+    int fOld = If_CutUseAvx2;
+    if ( fEnable == -1 && fOld != -1 )
+        return fOld;
+    If_CutUseAvx2 = 0;
+#ifdef IF_CUT_USE_AVX
+    __builtin_cpu_init();
+    if ( fEnable && __builtin_cpu_supports("avx2") )
+        If_CutUseAvx2 = 1;
+#endif
+    return fOld;
+}
+
+#ifdef IF_CUT_USE_AVX
+
+/**Function*************************************************************
+
+  Synopsis    [Loads up to 8 leaves of the cut, padding the rest with -1.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static inline __m256i If_CutLoadLeavesAvx2( int * pLeaves, int nLeaves, int Pad )
+{
+    __m256i Mask = _mm256_cmpgt_epi32( _mm256_set1_epi32(nLeaves), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7) );
+    __m256i Data = _mm256_maskload_epi32( pLeaves, Mask );
+    return _mm256_blendv_epi8( _mm256_set1_epi32(Pad), Data, Mask );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if pDom is contained in pCut.]
+
+  Description [Each leaf of pDom is compared with all leaves of pCut.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static int If_CutCheckDominanceAvx2( If_Cut_t * pDom, If_Cut_t * pCut )
+{
+    __m256i Leaves[IF_MAX_LUTSIZE/8], Leaf, Equal;
+    int i, w, nWords = ((int)pCut->nLeaves + 7) / 8;
+    assert( pDom->nLeaves <= pCut->nLeaves );
+    for ( w = 0; w < nWords; w++ )
+        Leaves[w] = If_CutLoadLeavesAvx2( pCut->pLeaves + 8*w, (int)pCut->nLeaves - 8*w, -1 );
+    for ( i = 0; i < (int)pDom->nLeaves; i++ )
+    {
+        Leaf  = _mm256_set1_epi32( pDom->pLeaves[i] );
+        Equal = _mm256_cmpeq_epi32( Leaves[0], Leaf );
+        for ( w = 1; w < nWords; w++ )
+            Equal = _mm256_or_si256( Equal, _mm256_cmpeq_epi32(Leaves[w], Leaf) );
+        if ( _mm256_testz_si256(Equal, Equal) )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges two ordered cuts with up to 8 leaves each.]
+
+  Description [The position of a leaf in the merged cut is the number of
+  smaller leaves in both cuts, counting the shared leaves once. These 
+  counts are computed for all leaves at once by comparing the vector of
+  leaves of one cut with each leaf of the other cut.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static int If_CutMergeOrderedAvx2( If_Cut_t * pC0, If_Cut_t * pC1, If_Cut_t * pC )
+{
+    int nSizeC0 = pC0->nLeaves;
+    int nSizeC1 = pC1->nLeaves;
+    int pPos0[8], pPos1[8], i, k, uShared, nShared;
+    __m256i Vec0  = If_CutLoadLeavesAvx2( pC0->pLeaves, nSizeC0, 0x7FFFFFFF );
+    __m256i Vec1  = If_CutLoadLeavesAvx2( pC1->pLeaves, nSizeC1, 0x7FFFFFFF );
+    __m256i Pos0  = _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 );
+    __m256i Pos1  = _mm256_setzero_si256();
+    __m256i Equal = _mm256_setzero_si256(), Leaf;
+    assert( nSizeC0 <= 8 && nSizeC1 <= 8 );
+    // count the smaller leaves of the first cut and find the shared leaves
+    for ( i = 0; i < nSizeC0; i++ )
+    {
+        Leaf  = _mm256_set1_epi32( pC0->pLeaves[i] );
+        Pos1  = _mm256_sub_epi32( Pos1, _mm256_cmpgt_epi32(Vec1, Leaf) );
+        Equal = _mm256_or_si256( Equal, _mm256_cmpeq_epi32(Vec1, Leaf) );
+    }
+    uShared = _mm256_movemask_ps( _mm256_castsi256_ps(Equal) ) & ((1 << nSizeC1) - 1);
+    nShared = __builtin_popcount( uShared );
+    if ( nSizeC0 + nSizeC1 - nShared > (int)pC0->nLimit )
+        return 0;
+    // count the smaller leaves of the second cut, which are not shared
+    for ( k = 0; k < nSizeC1; k++ )
+    {
+        if ( (uShared >> k) & 1 )
+            continue;
+        Leaf = _mm256_set1_epi32( pC1->pLeaves[k] );
+        Pos0 = _mm256_sub_epi32( Pos0, _mm256_cmpgt_epi32(Vec0, Leaf) );
+    }
+    _mm256_storeu_si256( (__m256i *)pPos0, Pos0 );
+    _mm256_storeu_si256( (__m256i *)pPos1, Pos1 );
+    for ( i = 0; i < nSizeC0; i++ )
+        pC->pLeaves[pPos0[i]] = pC0->pLeaves[i];
+    for ( k = 0; k < nSizeC1; k++ )
+        if ( !((uShared >> k) & 1) )
+            pC->pLeaves[pPos1[k] + k - __builtin_popcount(uShared & ((1 << k) - 1))] = pC1->pLeaves[k];
+    pC->nLeaves = nSizeC0 + nSizeC1 - nShared;
+    pC->uSign = pC0->uSign | pC1->uSign;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges two unordered cuts when the first one has up to 8 leaves.]
+
+  Description [Finds the position of each leaf of the second cut in the 
+  first cut using one vector comparison.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static int If_CutMergeAvx2( If_Man_t * p, If_Cut_t * pCut0, If_Cut_t * pCut1, If_Cut_t * pCut )
+{
+    int nLutSize = pCut0->nLimit;
+    int nSize0 = pCut0->nLeaves;
+    int nSize1 = pCut1->nLeaves;
+    int * pC1 = pCut1->pLeaves;
+    int * pC = pCut->pLeaves;
+    __m256i Vec0 = If_CutLoadLeavesAvx2( pCut0->pLeaves, nSize0, -1 );
+    int i, c = nSize0, Mask;
+    assert( nSize0 <= 8 );
+    for ( i = 0; i < nSize1; i++ )
+    {
+        Mask = _mm256_movemask_ps( _mm256_castsi256_ps(_mm256_cmpeq_epi32(Vec0, _mm256_set1_epi32(pC1[i]))) );
+        if ( Mask )
+        {
+            p->pPerm[1][i] = __builtin_ctz( Mask );
+            continue;
+        }
+        if ( c == nLutSize )
+            return 0;
+        p->pPerm[1][i] = c;
+        pC[c++] = pC1[i];
+    }
+    for ( i = 0; i < nSize0; i++ )
+        pC[i] = pCut0->pLeaves[i];
+    pCut->nLeaves = c;
+    pCut->uSign = pCut0->uSign | pCut1->uSign;
+    return 1;
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Check correctness of cuts.]
@@ -120,6 +311,10 @@ static inline int If_CutCheckDominance( If_Cut_t * pDom, If_Cut_t * pCut )
 {
     int i, k;
     assert( pDom->nLeaves <= pCut->nLeaves );
+#ifdef IF_CUT_USE_AVX
+    if ( If_CutUseAvx2 > 0 )
+        return If_CutCheckDominanceAvx2( pDom, pCut );
+#endif
     for ( i = 0; i < (int)pDom->nLeaves; i++ )
     {
         for ( k = 0; k < (int)pCut->nLeaves; k++ )
@@ -294,6 +489,11 @@ int If_CutMergeOrdered( If_Man_t * p, If_Cut_t * pC0, If_Cut_t * pC1, If_Cut_t *
     int nLimit  = pC0->nLimit;
     int i, k, c, s;
 
+#ifdef IF_CUT_USE_AVX
+    if ( If_CutUseAvx2 > 0 && nSizeC0 <= 8 && nSizeC1 <= 8 )
+        return If_CutMergeOrderedAvx2( pC0, pC1, pC );
+#endif
+
     // both cuts are the largest
     if ( nSizeC0 == nLimit && nSizeC1 == nLimit )
     {
@@ -370,6 +570,10 @@ int If_CutMerge( If_Man_t * p, If_Cut_t * pCut0, If_Cut_t * pCut1, If_Cut_t * pC
     int * pC1 = pCut1->pLeaves;
     int * pC = pCut->pLeaves;
     int i, k, c;
+#ifdef IF_CUT_USE_AVX
+    if ( If_CutUseAvx2 > 0 && nSize0 <= 8 )
+        return If_CutMergeAvx2( p, pCut0, pCut1, pCut );
+#endif
     // compare two cuts with different numbers
     c = nSize0; 
     for ( i = 0; i < nSize1; i++ )
@@ -25,20 +25,14 @@
 #include "sat/bsat/satSolver.h"
 #include "aig/gia/gia.h"
 #include "bool/kit/kit.h"
+#include "misc/util/utilSignal.h"
 
-#ifdef ABC_USE_CUDD
-#include "bdd/extrab/extraBdd.h"
-#endif
-
-#ifdef ABC_USE_PTHREADS
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#include <unistd.h>
+#ifndef _WIN32
+#include <sys/stat.h>
 #endif
 
+#ifdef ABC_USE_CUDD
+#include "bdd/extrab/extraBdd.h"
 #endif
 
 ABC_NAMESPACE_IMPL_START
@@ -100,6 +94,7 @@ struct If_DsdMan_t_
     void *         pSat;           // SAT solver
     char *         pCellStr;       // symbolic cell description
     int            nObjsPrev;      // previous number of objects
+    int            nObjsCache;     // the number of objects in the cache file
     int            fNewAsUseless;  // set new as useless
     int            nUniqueHits;    // statistics
     int            nUniqueMisses;  // statistics
@@ -1039,25 +1034,23 @@ int If_DsdObjFindOrAdd( If_DsdMan_t * p, int Type, int * pLits, int nLits, word
 
   Synopsis    [Saving/loading DSD manager.]
 
-  Description []
+  Description [The file-based versions read/write at the current position
+  of an open file, so that the manager can be stored inside a larger file.
+  The buffer-based version reads the manager from memory and does not read
+  past the end of the buffer. The loaders return NULL if the data is
+  truncated or corrupted.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
+void If_DsdManSaveFile( If_DsdMan_t * p, FILE * pFile )
 {
     If_DsdObj_t * pObj; 
     Vec_Int_t * vSets;
     word * pTruth; 
     int i, v, Num;
-    FILE * pFile = fopen( pFileName ? pFileName : p->pStore, "wb" );
-    if ( pFile == NULL )
-    {
-        printf( "Writing DSD manager file \"%s\" has failed.\n", pFileName ? pFileName : p->pStore );
-        return;
-    }
     fwrite( DSD_VERSION, 4, 1, pFile );
     Num = p->nVars;
     fwrite( &Num, 4, 1, pFile );
@@ -1101,38 +1094,62 @@ void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
     fwrite( &Num, 4, 1, pFile );
     if ( Num )
         fwrite( p->pCellStr, sizeof(char)*Num, 1, pFile );
+}
+void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
+{
+    FILE * pFile = fopen( pFileName ? pFileName : p->pStore, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Writing DSD manager file \"%s\" has failed.\n", pFileName ? pFileName : p->pStore );
+        return;
+    }
+    If_DsdManSaveFile( p, pFile );
     fclose( pFile );
 }
-If_DsdMan_t * If_DsdManLoad( char * pFileName )
+typedef struct If_DsdReader_t_ If_DsdReader_t;
+struct If_DsdReader_t_
+{
+    FILE *         pFile;    // the file to read, if any
+    char *         pCur;     // the current position in the buffer
+    char *         pEnd;     // the end of the buffer
+};
+static int If_DsdManRead( If_DsdReader_t * pRead, void * pData, int nBytes )
+{
+    if ( nBytes < 0 )
+        return 0;
+    if ( pRead->pFile )
+        return nBytes == 0 || fread( pData, nBytes, 1, pRead->pFile ) == 1;
+    if ( nBytes > pRead->pEnd - pRead->pCur )
+        return 0;
+    memcpy( pData, pRead->pCur, (size_t)nBytes );
+    pRead->pCur += nBytes;
+    return 1;
+}
+static If_DsdMan_t * If_DsdManLoadInt( If_DsdReader_t * pRead, char * pFileName )
 {
     If_DsdMan_t * p;
     If_DsdObj_t * pObj; 
     Vec_Int_t * vSets;
     char pBuffer[10];
     unsigned * pSpot;
-    word * pTruth;
-    int i, v, Num, Num2, RetValue;
-    FILE * pFile = fopen( pFileName, "rb" );
-    if ( pFile == NULL )
-    {
-        printf( "Reading DSD manager file \"%s\" has failed.\n", pFileName );
-        return NULL;
-    }
-    RetValue = fread( pBuffer, 4, 1, pFile );
-    if ( strncmp(pBuffer, DSD_VERSION, strlen(DSD_VERSION)) )
+    word * pTruth = NULL;
+    int i, v, Num, Num2;
+    if ( !If_DsdManRead( pRead, pBuffer, 4 ) || strncmp(pBuffer, DSD_VERSION, strlen(DSD_VERSION)) )
     {
         printf( "Unrecognized format of file \"%s\".\n", pFileName );
         return NULL;
     }
-    RetValue = fread( &Num, 4, 1, pFile );
+    if ( !If_DsdManRead( pRead, &Num, 4 ) || Num < 3 || Num > DAU_MAX_VAR )
+        goto corrupted;
     p = If_DsdManAlloc( Num, 0 );
     ABC_FREE( p->pStore );
     p->pStore = Abc_UtilStrsav( pFileName );
-    RetValue = fread( &Num, 4, 1, pFile );
+    if ( !If_DsdManRead( pRead, &Num, 4 ) )
+        goto corrupted_man;
     p->LutSize = Num;
     p->pSat  = If_ManSatBuildXY( p->LutSize );
-    RetValue = fread( &Num, 4, 1, pFile );
-    assert( Num >= 2 );
+    if ( !If_DsdManRead( pRead, &Num, 4 ) || Num < 2 )
+        goto corrupted_man;
     Vec_PtrFillExtra( &p->vObjs, Num, NULL );
     Vec_IntFill( &p->vNexts, Num, 0 );
     Vec_IntFill( &p->vTruths, Num, -1 );
@@ -1141,13 +1158,16 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
     memset( p->pBins, 0, sizeof(unsigned) * p->nBins );
     for ( i = 2; i < Vec_PtrSize(&p->vObjs); i++ )
     {
-        RetValue = fread( &Num, 4, 1, pFile );
+        if ( !If_DsdManRead( pRead, &Num, 4 ) || Num < 1 || Num > If_DsdObjWordNum(DAU_MAX_VAR) )
+            goto corrupted_man;
         pObj = (If_DsdObj_t *)Mem_FlexEntryFetch( p->pMem, sizeof(word) * Num );
-        RetValue = fread( pObj, sizeof(word)*Num, 1, pFile );
+        if ( !If_DsdManRead( pRead, pObj, sizeof(word)*Num ) || (int)pObj->Id != i || Num != If_DsdObjWordNum(pObj->nFans) )
+            goto corrupted_man;
         Vec_PtrWriteEntry( &p->vObjs, i, pObj );
         if ( pObj->Type == IF_DSD_PRIME )
         {
-            RetValue = fread( &Num, 4, 1, pFile );
+            if ( !If_DsdManRead( pRead, &Num, 4 ) )
+                goto corrupted_man;
             Vec_IntWriteEntry( &p->vTruths, i, Num );
         }
         pSpot = If_DsdObjHashLookup( p, pObj->Type, (int *)pObj->pFans, pObj->nFans, If_DsdObjTruthId(p, pObj) );
@@ -1160,41 +1180,77 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
     for ( v = 3; v <= p->nVars; v++ )
     {
         int nBytes = sizeof(word)*Vec_MemEntrySize(p->vTtMem[v]);
-        RetValue = fread( &Num, 4, 1, pFile );
+        if ( !If_DsdManRead( pRead, &Num, 4 ) || Num < 0 )
+            goto corrupted_man;
         for ( i = 0; i < Num; i++ )
         {
-            RetValue = fread( pTruth, nBytes, 1, pFile );
+            if ( !If_DsdManRead( pRead, pTruth, nBytes ) )
+                goto corrupted_man;
             Vec_MemHashInsert( p->vTtMem[v], pTruth );
         }
         assert( Num == Vec_MemEntryNum(p->vTtMem[v]) );
-        RetValue = fread( &Num2, 4, 1, pFile );
+        if ( !If_DsdManRead( pRead, &Num2, 4 ) || Num2 < 0 )
+            goto corrupted_man;
         for ( i = 0; i < Num2; i++ )
         {
-            RetValue = fread( &Num, 4, 1, pFile );
+            if ( !If_DsdManRead( pRead, &Num, 4 ) || Num < 0 )
+                goto corrupted_man;
             vSets = Vec_IntAlloc( Num );
-            RetValue = fread( Vec_IntArray(vSets), sizeof(int)*Num, 1, pFile );
-            vSets->nSize = Num;
             Vec_PtrPush( p->vTtDecs[v], vSets );
+            if ( !If_DsdManRead( pRead, Vec_IntArray(vSets), sizeof(int)*Num ) )
+                goto corrupted_man;
+            vSets->nSize = Num;
         }
         assert( Num2 == Vec_PtrSize(p->vTtDecs[v]) ); 
     }
     ABC_FREE( pTruth );
-    RetValue = fread( &Num, 4, 1, pFile );
+    // the remaining fields are optional
+    if ( !If_DsdManRead( pRead, &Num, 4 ) )
+        return p;
     p->nConfigWords = Num;
-    RetValue = fread( &Num, 4, 1, pFile );
+    if ( !If_DsdManRead( pRead, &Num, 4 ) )
+        return p;
     p->nTtBits = Num;
-    RetValue = fread( &Num, 4, 1, pFile );
-    if ( RetValue && Num )
+    if ( If_DsdManRead( pRead, &Num, 4 ) && Num > 0 )
     {
         p->vConfigs = Vec_WrdStart( Num );
-        RetValue = fread( Vec_WrdArray(p->vConfigs), sizeof(word)*Num, 1, pFile );
+        if ( !If_DsdManRead( pRead, Vec_WrdArray(p->vConfigs), sizeof(word)*Num ) )
+            goto corrupted_man;
     }
-    RetValue = fread( &Num, 4, 1, pFile );
-    if ( RetValue && Num )
+    if ( If_DsdManRead( pRead, &Num, 4 ) && Num > 0 )
     {
         p->pCellStr = ABC_CALLOC( char, Num + 1 );
-        RetValue = fread( p->pCellStr, sizeof(char)*Num, 1, pFile );
+        if ( !If_DsdManRead( pRead, p->pCellStr, sizeof(char)*Num ) )
+            goto corrupted_man;
     }
+    return p;
+corrupted_man:
+    ABC_FREE( pTruth );
+    If_DsdManFree( p, 0 );
+corrupted:
+    printf( "The DSD manager in file \"%s\" is corrupted.\n", pFileName );
+    return NULL;
+}
+If_DsdMan_t * If_DsdManLoadFile( FILE * pFile, char * pFileName )
+{
+    If_DsdReader_t Read = { pFile, NULL, NULL };
+    return If_DsdManLoadInt( &Read, pFileName );
+}
+If_DsdMan_t * If_DsdManLoadBuffer( char * pBuffer, int nSize, char * pFileName )
+{
+    If_DsdReader_t Read = { NULL, pBuffer, pBuffer + nSize };
+    return If_DsdManLoadInt( &Read, pFileName );
+}
+If_DsdMan_t * If_DsdManLoad( char * pFileName )
+{
+    If_DsdMan_t * p;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Reading DSD manager file \"%s\" has failed.\n", pFileName );
+        return NULL;
+    }
+    p = If_DsdManLoadFile( pFile, pFileName );
     fclose( pFile );
     return p;
 }
@@ -1245,6 +1301,92 @@ void If_DsdManMerge( If_DsdMan_t * p, If_DsdMan_t * pNew )
     if ( p->vConfigs && pNew->vConfigs )
         Vec_WrdShrink( p->vConfigs, p->nConfigWords * Vec_PtrSize(&p->vObjs) );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Loading/saving the DSD manager used as a persistent cache.]
+
+  Description [The cache file has the same format as the file written by 
+  "dsd_save". Loading returns NULL if the file does not exist, has a different 
+  version, or was computed for a different LUT size or a smaller number of 
+  variables. Saving is skipped if no objects were added since the file was 
+  read or written. Otherwise, the objects added to the file by other processes 
+  are merged into the manager, and the manager is written into a temporary 
+  file, which is then renamed, so that the processes sharing the cache never 
+  see a partially written file. Returns 1 if the file was written.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_DsdMan_t * If_DsdManCacheLoad( char * pFileName, int nVars, int LutSize, int fVerbose )
+{
+    If_DsdMan_t * p = NULL;
+    char pBuffer[4]; int pHeader[2] = {0};
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    if ( fread(pBuffer, 4, 1, pFile) == 1 && !strncmp(pBuffer, DSD_VERSION, 4) && fread(pHeader, 4, 2, pFile) == 2 && 
+         pHeader[0] >= nVars && pHeader[0] <= DAU_MAX_VAR && pHeader[1] == LutSize )
+    {
+        rewind( pFile );
+        p = If_DsdManLoadFile( pFile, pFileName );
+    }
+    fclose( pFile );
+    if ( p == NULL )
+    {
+        if ( fVerbose )
+            printf( "DSD cache \"%s\" is incompatible and will be replaced.\n", pFileName );
+        return NULL;
+    }
+    p->nObjsCache = If_DsdManObjNum( p );
+    if ( fVerbose )
+        printf( "Loaded %d DSD objects from cache \"%s\".\n", p->nObjsCache, pFileName );
+    return p;
+}
+int If_DsdManCacheSave( If_DsdMan_t * p, char * pFileName, int fVerbose )
+{
+    If_DsdMan_t * pDisk;
+    char * pTemp = NULL;
+    FILE * pFile;
+    int fd, nObjs = If_DsdManObjNum( p );
+    if ( nObjs == p->nObjsCache )
+        return 0;
+    pDisk = If_DsdManCacheLoad( pFileName, 0, p->LutSize, 0 );
+    if ( pDisk && pDisk->nVars <= p->nVars && pDisk->nTtBits == p->nTtBits && pDisk->nConfigWords == p->nConfigWords && 
+         If_DsdManHasMarks(pDisk) == If_DsdManHasMarks(p) )
+        If_DsdManMerge( p, pDisk );
+    if ( pDisk )
+        If_DsdManFree( pDisk, 0 );
+    fd = Util_SignalTmpFile( pFileName, ".tmp", &pTemp );
+    if ( fd == -1 || (pFile = fdopen(fd, "wb")) == NULL )
+    {
+        printf( "Cannot write DSD cache \"%s\".\n", pFileName );
+        ABC_FREE( pTemp );
+        return 0;
+    }
+    If_DsdManSaveFile( p, pFile );
+    fclose( pFile );
+#ifdef _WIN32
+    remove( pFileName );
+#else
+    chmod( pTemp, 0644 );
+#endif
+    if ( rename( pTemp, pFileName ) )
+    {
+        printf( "Cannot write DSD cache \"%s\".\n", pFileName );
+        remove( pTemp );
+        ABC_FREE( pTemp );
+        return 0;
+    }
+    ABC_FREE( pTemp );
+    if ( fVerbose )
+        printf( "Saved %d DSD objects (%d new, %d from the file) into cache \"%s\".\n", 
+            If_DsdManObjNum(p), nObjs - p->nObjsCache, If_DsdManObjNum(p) - nObjs, pFileName );
+    p->nObjsCache = If_DsdManObjNum( p );
+    return 1;
+}
 void If_DsdManCleanOccur( If_DsdMan_t * p, int fVerbose )
 {
     If_DsdObj_t * pObj; 
@@ -2575,30 +2717,17 @@ typedef struct Ifn_ThData_t_
     int         Status;  // state
     abctime     clkUsed; // total runtime
 } Ifn_ThData_t;
-void * Ifn_WorkerThread( void * pArg )
+int Ifn_WorkerTask( void * pArg )
 {
     Ifn_ThData_t * pThData = (Ifn_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->Status;
-    abctime clk;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->Status == 1 );
-        if ( pThData->Id == -1 )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        clk = Abc_Clock();
-        memset( pThData->pConfig, 0, sizeof(word) * pThData->nConfigWords );
-        pThData->Result = Ifn_NtkMatch( pThData->pNtk, pThData->pTruth, pThData->nVars, pThData->nConfls, 0, 0, pThData->pConfig );
-        pThData->clkUsed += Abc_Clock() - clk;
-        pThData->Status = 0;
-//        printf( "Finished object %d\n", pThData->Id );
-    }
-    assert( 0 );
-    return NULL;
+    abctime clk = Abc_Clock();
+    assert( pThData->Status == 1 && pThData->Id >= 0 );
+    memset( pThData->pConfig, 0, sizeof(word) * pThData->nConfigWords );
+    pThData->Result = Ifn_NtkMatch( pThData->pNtk, pThData->pTruth, pThData->nVars, pThData->nConfls, 0, 0, pThData->pConfig );
+    pThData->clkUsed += Abc_Clock() - clk;
+    pThData->Status = 0;
+//    printf( "Finished object %d\n", pThData->Id );
+    return 1;
 }
 void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, int nInputs, int fVerbose )
 {
@@ -2658,11 +2787,11 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
 
     // perform concurrent solving
     {
-        pthread_t WorkerThread[PAR_THR_MAX];
         Ifn_ThData_t ThData[PAR_THR_MAX];
+        Util_PoolGroup_t * pGroup;
         abctime clk, clkUsed = 0;
-        int status, fRunning = 1, iCurrentObj = p->nObjsPrev;
-        // start the threads
+        int fRunning = 1, iCurrentObj = p->nObjsPrev;
+        // each slot matches one function at a time using a task of the thread pool
         for ( i = 0; i < nProcs; i++ )
         {
             ThData[i].pNtk     = Ifn_NtkParse( pStruct );
@@ -2673,8 +2802,8 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
             ThData[i].Status   =  0;      // state
             ThData[i].clkUsed  =  0;      // total runtime
             ThData[i].nConfigWords = p->nConfigWords;
-            status = pthread_create( WorkerThread + i, NULL, Ifn_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
         }
+        pGroup = Util_PoolGroupStart( nProcs + 1, 0 );
         // run the threads
         while ( fRunning || iCurrentObj < Vec_PtrSize(&p->vObjs) )
         {
@@ -2712,6 +2841,7 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
                     ThData[i].Id     =  k;
                     ThData[i].Result = -1;
                     ThData[i].Status =  1;
+                    Util_PoolGroupAdd( pGroup, Ifn_WorkerTask, (void *)(ThData + i) );
                     //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
                     iCurrentObj = k+1;
                     break;
@@ -2723,14 +2853,11 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
                     fRunning = 1;
             //printf( "fRunning %d\n", fRunning );
         }
-        // stop the threads
+        // wait for the tasks to return
+        Util_PoolGroupWait( pGroup );
+        Util_PoolGroupStop( pGroup );
         for ( i = 0; i < nProcs; i++ )
-        {
-            assert( ThData[i].Status == 0 );
-            ThData[i].Id = -1;
-            ThData[i].Status = 1;
             ABC_FREE( ThData[i].pNtk );
-        }
         if ( fVerbose )
         {
             printf( "Main     : " );
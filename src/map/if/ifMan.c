@@ -37,6 +37,25 @@ static If_Set_t * If_ManCutSetFetch( If_Man_t * p )                    { If_Set_
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the truth tables can come from the shared store.]
+
+  Description [The shared store is used only when the truth table IDs are
+  not tied to the per-manager data (ISOP caches, permutation counters)
+  and when the truth tables are not dumped at the end.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ManTtStoreCanShare( If_Par_t * pPars )
+{
+    return pPars->fTtShared && !pPars->fUseTtPerm && !pPars->fDelayOpt && pPars->nGateSize == 0 && 
+        !pPars->fDsdBalance && !pPars->fDumpFile;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Starts the AIG manager.]
@@ -50,6 +69,7 @@ static If_Set_t * If_ManCutSetFetch( If_Man_t * p )                    { If_Set_
 ***********************************************************************/
 If_Man_t * If_ManStart( If_Par_t * pPars )
 {
+    extern void * Abc_FrameReadTtStore( int nVars );
     If_Man_t * p; int v;
     assert( !pPars->fUseDsd || !pPars->fUseTtPerm );
     // start the manager
@@ -57,6 +77,7 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
     memset( p, 0, sizeof(If_Man_t) );
     p->pPars    = pPars;
     p->fEpsilon = pPars->Epsilon;
+    If_CutSimdEnable( -1 );
     // allocate arrays for nodes
     p->vCis     = Vec_PtrAlloc( 100 );
     p->vCos     = Vec_PtrAlloc( 100 );
@@ -68,8 +89,19 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
     {
         for ( v = 0; v <= p->pPars->nLutSize; v++ )
             p->nTruth6Words[v] = Abc_Truth6WordNum( v );
-        for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
-            p->vTtMem[v] = Vec_MemAllocForTT( v, pPars->fUseTtPerm );
+        if ( If_ManTtStoreCanShare(pPars) && Abc_FrameReadTtStore(6) )
+        {
+            for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+            {
+                p->vTtMemMt[v] = (Vec_MemMt_t *)Abc_FrameReadTtStore( v );
+                p->vTtMem[v]   = Vec_MemMtMem( p->vTtMemMt[v] );
+            }
+            for ( v = 0; v < 6; v++ )
+                p->vTtMemMt[v] = p->vTtMemMt[6];
+        }
+        else
+            for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+                p->vTtMem[v] = Vec_MemAllocForTT( v, pPars->fUseTtPerm );
         for ( v = 0; v < 6; v++ )
             p->vTtMem[v] = p->vTtMem[6];
         if ( p->pPars->fDelayOpt || pPars->nGateSize > 0 )
@@ -416,7 +448,8 @@ void If_ManStop( If_Man_t * p )
             nUnique += Vec_MemEntryNum(p->vTtMem[i]);
         for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
             nMemTotal += (int)Vec_MemMemory(p->vTtMem[i]);
-        printf( "Unique truth tables = %d   Memory = %.2f MB   ", nUnique, 1.0 * nMemTotal / (1<<20) ); 
+        // the shared store also contains the truth tables of the other managers
+        printf( "Unique truth tables%s = %d   Memory = %.2f MB   ", p->vTtMemMt[6] ? " (global store)" : "", nUnique, 1.0 * nMemTotal / (1<<20) ); 
         Abc_PrintTime( 1, "Time", p->timeCache[4] );
         if ( p->nCacheMisses )
         {
@@ -474,9 +507,11 @@ void If_ManStop( If_Man_t * p )
     if ( p->vPairHash )
         Hash_IntManStop( p->vPairHash );
     for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
-        Vec_MemHashFree( p->vTtMem[i] );
+        if ( p->vTtMemMt[i] == NULL )
+            Vec_MemHashFree( p->vTtMem[i] );
     for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
-        Vec_MemFreeP( &p->vTtMem[i] );
+        if ( p->vTtMemMt[i] == NULL )
+            Vec_MemFreeP( &p->vTtMem[i] );
     for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
         Vec_WecFreeP( &p->vTtIsops[i] );
     for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
@@ -93,13 +93,9 @@ int If_ManCutAigDelay( If_Man_t * p, If_Obj_t * pObj, If_Cut_t * pCut )
   SeeAlso     []
 
 ***********************************************************************/
-static inline int If_WordCountOnes( unsigned uWord )
+static inline int If_WordCountOnes( word uWord )
 {
-    uWord = (uWord & 0x55555555) + ((uWord>>1) & 0x55555555);
-    uWord = (uWord & 0x33333333) + ((uWord>>2) & 0x33333333);
-    uWord = (uWord & 0x0F0F0F0F) + ((uWord>>4) & 0x0F0F0F0F);
-    uWord = (uWord & 0x00FF00FF) + ((uWord>>8) & 0x00FF00FF);
-    return  (uWord & 0x0000FFFF) + (uWord>>16);
+    return Abc_TtCountOnes( uWord );
 }
 
 /**Function*************************************************************
@@ -150,29 +146,18 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
 
 /**Function*************************************************************
 
-  Synopsis    [Finds the best cut for the given node.]
+  Synopsis    [Prepares the node for cut computation.]
 
-  Description [Mapping modes: delay (0), area flow (1), area (2).]
+  Description [Updates the fanout estimate, dereferences the best cut in
+  the area recovery modes and allocates the cutset.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+static inline void If_ObjPrepareMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode )
 {
-    If_Set_t * pCutSet;
-    If_Obj_t * pLeaf;
-    If_Cut_t * pCut0, * pCut1, * pCut;
-    If_Cut_t * pCut0R, * pCut1R;
-    int fFunc0R, fFunc1R;
-    int i, k, v, iCutDsd, fChange;
-    int fSave0 = p->pPars->fDelayOpt || p->pPars->fDelayOptLut || p->pPars->fDsdBalance || p->pPars->fUserRecLib || p->pPars->fUserSesLib || p->pPars->fUserLutDec || p->pPars->fUserLut2D ||
-        p->pPars->fUseDsdTune || p->pPars->fUseCofVars || p->pPars->fUseAndVars || p->pPars->fUse34Spec || p->pPars->pLutStruct || p->pPars->pFuncCell2 || p->pPars->fUseCheck1 || p->pPars->fUseCheck2 || p->pPars->fEnableCheck07;
-    int fUseAndCut = (p->pPars->nAndDelay > 0) || (p->pPars->nAndArea > 0);
-    assert( !If_ObjIsAnd(pObj->pFanin0) || pObj->pFanin0->pCutSet->nCuts > 0 );
-    assert( !If_ObjIsAnd(pObj->pFanin1) || pObj->pFanin1->pCutSet->nCuts > 0 );
-
     // prepare
     if ( Mode == 0 )
         pObj->EstRefs = (float)pObj->nRefs;
@@ -181,9 +166,39 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     // deref the selected cut
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
-
     // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    If_ManSetupNodeCutSet( p, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts of the node and selects the best one.]
+
+  Description [Mapping modes: delay (0), area flow (1), area (2).
+  Only reads the cuts of the fanins and writes the cuts of the node,
+  so nodes whose fanins are mapped can be processed concurrently, as
+  long as the options are accepted by If_ManMappingRoundIsParallel().
+  Returns the number of merged cuts.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ObjComputeCutsAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    If_Set_t * pCutSet = pObj->pCutSet;
+    If_Obj_t * pLeaf;
+    If_Cut_t * pCut0, * pCut1, * pCut;
+    If_Cut_t * pCut0R, * pCut1R;
+    int fFunc0R, fFunc1R;
+    int i, k, v, iCutDsd, fChange, nCutsMerged = 0;
+    int fSave0 = p->pPars->fDelayOpt || p->pPars->fDelayOptLut || p->pPars->fDsdBalance || p->pPars->fUserRecLib || p->pPars->fUserSesLib || p->pPars->fUserLutDec || p->pPars->fUserLut2D ||
+        p->pPars->fUseDsdTune || p->pPars->fUseCofVars || p->pPars->fUseAndVars || p->pPars->fUse34Spec || p->pPars->pLutStruct || p->pPars->pFuncCell2 || p->pPars->fUseCheck1 || p->pPars->fUseCheck2 || p->pPars->fEnableCheck07;
+    int fUseAndCut = (p->pPars->nAndDelay > 0) || (p->pPars->nAndArea > 0);
+    assert( !If_ObjIsAnd(pObj->pFanin0) || pObj->pFanin0->pCutSet->nCuts > 0 );
+    assert( !If_ObjIsAnd(pObj->pFanin1) || pObj->pFanin1->pCutSet->nCuts > 0 );
+    assert( pCutSet != NULL && pCutSet->nCuts == 0 );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -297,8 +312,7 @@ IfMapBestCutDone:
             continue;
         if ( pObj->fSpec && pCut->nLeaves == (unsigned)p->pPars->nLutSize )
             continue;
-        p->nCutsMerged++;
-        p->nCutsTotal++;
+        nCutsMerged++;
         // check if this cut is contained in any of the available cuts
         if ( !p->pPars->fSkipCutFilter && If_CutFilter( pCutSet, pCut, fSave0 ) )
             continue;
@@ -572,7 +586,25 @@ IfMapCutEvalDone:
 //        p->nBestCutSmall[0]++;
 //    else if ( If_ObjCutBest(pObj)->nLeaves == 1 )
 //        p->nBestCutSmall[1]++;
+    return nCutsMerged;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finalizes the cut computation for the node.]
 
+  Description [References the best cut in the area recovery modes, calls
+  the user's callback and recycles the cutsets that are no longer needed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void If_ObjFinishMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode )
+{
+    If_Cut_t * pCut;
+    int i;
     // ref the selected cut
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaRef( p, If_ObjCutBest(pObj) );
@@ -586,6 +618,27 @@ IfMapCutEvalDone:
     If_ManDerefNodeCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the best cut for the given node.]
+
+  Description [Mapping modes: delay (0), area flow (1), area (2).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    int nCutsMerged;
+    If_ObjPrepareMappingAnd( p, pObj, Mode );
+    nCutsMerged = If_ObjComputeCutsAnd( p, pObj, Mode, fPreprocess, fFirst );
+    p->nCutsMerged += nCutsMerged;
+    p->nCutsTotal  += nCutsMerged;
+    If_ObjFinishMappingAnd( p, pObj, Mode );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Finds the best cut for the choice node.]
@@ -671,6 +724,193 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks if the mapping round can be performed in parallel.]
+
+  Description [Nodes of one level are mapped concurrently only in the 
+  delay-oriented rounds, which do not update the reference counters, and
+  only with the options whose cut evaluation does not use the shared 
+  data of the manager (truth tables, caches, timing manager, callbacks).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManMappingRoundIsParallel( If_Man_t * p, int Mode )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( pPars->nProcs <= 1 || Mode != 0 || p->pManTim != NULL || p->nChoices > 0 || p->vCuts != NULL )
+        return 0;
+    if ( pPars->fTruth || pPars->fUseTtPerm || pPars->fPower || pPars->fLiftLeaves || pPars->nGateSize > 0 )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->fUserRecLib || pPars->fUserSesLib || pPars->fUserLutDec || pPars->fUserLut2D || pPars->fEnableCheck07 )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncCell || pPars->pFuncCell2 )
+        return 0;
+    if ( pPars->pLutLib && pPars->pLutLib->fVarPinDelays )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the peak number of cutsets in the level-based round.]
+
+  Description [Similar to If_ManCrossCut() but assumes that the nodes are
+  visited by If_ManPerformMappingLevels(), that is, level by level, with
+  the cutsets allocated for the complete batch of nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define IF_MAP_CHUNK  256
+#define IF_MAP_BATCH  (1 << 14)
+
+static Vec_Wec_t * If_ManCollectLevels( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels = Vec_WecStart( p->nLevelMax + 1 );
+    If_Obj_t * pObj; int i;
+    If_ManForEachNode( p, pObj, i )
+        Vec_WecPush( vLevels, pObj->Level, pObj->Id );
+    return vLevels;
+}
+int If_ManCrossCutLevels( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels = If_ManCollectLevels( p );
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj, * pFanin;
+    int i, k, iStart, iStop, Id, nCutSize = 0, nCutSizeMax = 0;
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    for ( iStart = 0; iStart < Vec_IntSize(vLevel); iStart += IF_MAP_BATCH )
+    {
+        iStop = Abc_MinInt( iStart + IF_MAP_BATCH, Vec_IntSize(vLevel) );
+        nCutSize += iStop - iStart;
+        nCutSizeMax = Abc_MaxInt( nCutSizeMax, nCutSize );
+        Vec_IntForEachEntryStartStop( vLevel, Id, k, iStart, iStop )
+        {
+            pObj = If_ManObj( p, Id );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    assert( nCutSize == 0 );
+    Vec_WecFree( vLevels );
+    return nCutSizeMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping round level by level.]
+
+  Description [The nodes of each level depend only on the cuts of the 
+  lower levels. The nodes are processed in batches belonging to the same
+  level. For each batch, the cutsets are allocated and recycled by the 
+  calling thread in the order of node IDs, while the cuts are computed
+  by the thread pool in chunks of IF_MAP_CHUNK nodes. The result does
+  not depend on the number of threads and is the same as the result of 
+  the sequential round.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct If_MapTask_t_ If_MapTask_t;
+struct If_MapTask_t_
+{
+    If_Man_t *       p;           // mapping manager
+    If_Obj_t **      ppObjs;      // nodes to map
+    int              nObjs;       // the number of nodes
+    int              Mode;        // mapping mode
+    int              fPreprocess; // preprocessing
+    int              fFirst;      // first round
+    int              nCutsMerged; // the number of merged cuts
+};
+
+static int If_ManMappingTask( void * pArg )
+{
+    If_MapTask_t * pTask = (If_MapTask_t *)pArg;
+    int i;
+    pTask->nCutsMerged = 0;
+    for ( i = 0; i < pTask->nObjs; i++ )
+        pTask->nCutsMerged += If_ObjComputeCutsAnd( pTask->p, pTask->ppObjs[i], pTask->Mode, pTask->fPreprocess, pTask->fFirst );
+    return 0;
+}
+void If_ManPerformMappingLevels( If_Man_t * p, int Mode, int fPreprocess, int fFirst, char * pLabel )
+{
+    ProgressBar * pProgress;
+    Util_PoolGroup_t * pGroup;
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    Vec_Ptr_t * vBatch;
+    If_MapTask_t * pTasks;
+    If_Obj_t * pObj;
+    int i, k, t, iStart, nTasks, Id, nDone = 0;
+    pTasks  = ABC_CALLOC( If_MapTask_t, IF_MAP_BATCH / IF_MAP_CHUNK );
+    vBatch  = Vec_PtrAlloc( IF_MAP_BATCH );
+    vLevels = If_ManCollectLevels( p );
+    pProgress = Extra_ProgressBarStart( stdout, If_ManAndNum(p) );
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    for ( iStart = 0; iStart < Vec_IntSize(vLevel); iStart += IF_MAP_BATCH )
+    {
+        // allocate the cutsets
+        Vec_PtrClear( vBatch );
+        Vec_IntForEachEntryStartStop( vLevel, Id, k, iStart, Abc_MinInt(iStart + IF_MAP_BATCH, Vec_IntSize(vLevel)) )
+        {
+            pObj = If_ManObj( p, Id );
+            If_ObjPrepareMappingAnd( p, pObj, Mode );
+            Vec_PtrPush( vBatch, pObj );
+        }
+        // compute the cuts
+        nTasks = (Vec_PtrSize(vBatch) + IF_MAP_CHUNK - 1) / IF_MAP_CHUNK;
+        for ( t = 0; t < nTasks; t++ )
+        {
+            pTasks[t].p           = p;
+            pTasks[t].ppObjs      = (If_Obj_t **)Vec_PtrArray(vBatch) + t * IF_MAP_CHUNK;
+            pTasks[t].nObjs       = Abc_MinInt( IF_MAP_CHUNK, Vec_PtrSize(vBatch) - t * IF_MAP_CHUNK );
+            pTasks[t].Mode        = Mode;
+            pTasks[t].fPreprocess = fPreprocess;
+            pTasks[t].fFirst      = fFirst;
+        }
+        if ( nTasks == 1 )
+            If_ManMappingTask( pTasks );
+        else
+        {
+            pGroup = Util_PoolGroupStart( Abc_MinInt(p->pPars->nProcs, nTasks), 0 );
+            for ( t = 0; t < nTasks; t++ )
+                Util_PoolGroupAdd( pGroup, If_ManMappingTask, pTasks + t );
+            Util_PoolGroupWait( pGroup );
+            Util_PoolGroupStop( pGroup );
+        }
+        // finalize the nodes
+        for ( t = 0; t < nTasks; t++ )
+        {
+            p->nCutsMerged += pTasks[t].nCutsMerged;
+            p->nCutsTotal  += pTasks[t].nCutsMerged;
+        }
+        Vec_PtrForEachEntry( If_Obj_t *, vBatch, pObj, k )
+            If_ObjFinishMappingAnd( p, pObj, Mode );
+        nDone += Vec_PtrSize(vBatch);
+        Extra_ProgressBarUpdate( pProgress, nDone, pLabel );
+    }
+    Extra_ProgressBarStop( pProgress );
+    Vec_WecFree( vLevels );
+    Vec_PtrFree( vBatch );
+    ABC_FREE( pTasks );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -737,6 +977,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( If_ManMappingRoundIsParallel(p, Mode) )
+        If_ManPerformMappingLevels( p, Mode, fPreprocess, fFirst, pLabel );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
@@ -80,7 +80,7 @@ void If_CutRotatePins( If_Man_t * p, If_Cut_t * pCut )
     }
     Abc_TtCopy( p->puTempW, If_CutTruthWR(p, pCut), p->nTruth6Words[pCut->nLeaves], 0 );
     If_CutTruthPermute( p->puTempW, If_CutLeaveNum(pCut), pCut->nLeaves, p->nTruth6Words[pCut->nLeaves], PinDelays, If_CutLeaves(pCut) );
-    truthId        = Vec_MemHashInsert( p->vTtMem[pCut->nLeaves], p->puTempW );
+    truthId        = If_ManTtInsert( p, pCut->nLeaves, p->puTempW );
     pCut->iCutFunc = Abc_Var2Lit( truthId, If_CutTruthIsCompl(pCut) );
     assert( (p->puTempW[0] & 1) == 0 );
 }
@@ -123,7 +123,7 @@ int If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_
         }
     }
     PrevSize       = Vec_MemEntryNum( p->vTtMem[pCut->nLeaves] );   
-    truthId        = Vec_MemHashInsert( p->vTtMem[pCut->nLeaves], pTruth );
+    truthId        = If_ManTtInsert( p, pCut->nLeaves, pTruth );
     pCut->iCutFunc = Abc_Var2Lit( truthId, fCompl );
     assert( (pTruth[0] & 1) == 0 );
 #ifdef IF_TRY_NEW
@@ -86,6 +86,7 @@ int Map_CommandReadLibrary( Abc_Frame_t * pAbc, int argc, char **argv )
     Map_SuperLib_t * pLib;
     Abc_Ntk_t * pNet;
     char * FileName, * ExcludeFile;
+    char * pCacheDir = Abc_FrameReadFlag( "libcache" );
     int fVerbose;
     int fAlgorithm;
     int c;
@@ -99,10 +100,19 @@ int Map_CommandReadLibrary( Abc_Frame_t * pAbc, int argc, char **argv )
     fAlgorithm = 1;
     ExcludeFile = 0;
     Extra_UtilGetoptReset();
-    while ( (c = Extra_UtilGetopt(argc, argv, "eovh")) != EOF ) 
+    while ( (c = Extra_UtilGetopt(argc, argv, "eCovh")) != EOF ) 
     {
         switch (c) 
         {
+            case 'C':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pErr, "Command line switch \"-C\" should be followed by a directory name.\n" );
+                    goto usage;
+                }
+                pCacheDir = argv[globalUtilOptind];
+                globalUtilOptind++;
+                break;
             case 'e':
                 ExcludeFile = argv[globalUtilOptind];
                 if ( ExcludeFile == 0 )
@@ -149,7 +159,10 @@ int Map_CommandReadLibrary( Abc_Frame_t * pAbc, int argc, char **argv )
     }
 
     // set the new network
-    pLib = Map_SuperLibCreate( (Mio_Library_t *)Abc_FrameReadLibGen(), NULL, FileName, ExcludeFile, fAlgorithm, fVerbose );
+    if ( pCacheDir && fAlgorithm )
+        pLib = Map_SuperLibReadCache( (Mio_Library_t *)Abc_FrameReadLibGen(), FileName, ExcludeFile, pCacheDir, fVerbose );
+    else
+        pLib = Map_SuperLibCreate( (Mio_Library_t *)Abc_FrameReadLibGen(), NULL, FileName, ExcludeFile, fAlgorithm, fVerbose );
     if ( pLib == NULL )
     {
         fprintf( pErr, "Reading supergate library has failed.\n" );
@@ -166,9 +179,10 @@ int Map_CommandReadLibrary( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pErr, "\nusage: read_super [-ovh]\n");
+    fprintf( pErr, "\nusage: read_super [-e file] [-C dir] [-ovh] <file>\n");
     fprintf( pErr, "\t         read the supergate library from the file\n" );  
     fprintf( pErr, "\t-e file : file contains list of genlib gates to exclude\n" );
+    fprintf( pErr, "\t-C dir  : the cache directory of binary supergate libraries (or use \"set libcache <dir>\") [default = %s]\n", pCacheDir ? pCacheDir : "none" );
     fprintf( pErr, "\t-o      : toggles the use of old file format [default = %s]\n", (fAlgorithm? "new" : "old") );
     fprintf( pErr, "\t-v      : toggles enabling of verbose output [default = %s]\n", (fVerbose? "yes" : "no") );
     fprintf( pErr, "\t-h      : print the command usage\n");
@@ -378,6 +378,7 @@ extern void              Map_NodeRemoveFaninFanout( Map_Node_t * pFanin, Map_Nod
 extern int               Map_NodeGetFanoutNum( Map_Node_t * pNode );
 /*=== mapperLib.c ============================================================*/
 extern Map_SuperLib_t *  Map_SuperLibCreate( Mio_Library_t * pGenlib, Vec_Str_t * vStr, char * pFileName, char * pExcludeFile, int  fAlgorithm, int  fVerbose );
+extern Map_SuperLib_t *  Map_SuperLibReadCache( Mio_Library_t * pGenlib, char * pFileName, char * pExcludeFile, char * pCacheDir, int fVerbose );
 extern void              Map_SuperLibFree( Map_SuperLib_t * p );
 /*=== mapperMatch.c ===============================================================*/
 extern int               Map_MappingMatches( Map_Man_t * p );
@@ -399,6 +400,8 @@ extern float             Map_MappingGetSwitching( Map_Man_t * pMan );
 /*=== mapperTree.c ===============================================================*/
 extern int               Map_LibraryDeriveGateInfo( Map_SuperLib_t * pLib, st__table * tExcludeGate );
 extern int               Map_LibraryReadFileTreeStr( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, Vec_Str_t * vStr, char * pFileName );
+extern Vec_Str_t *       Map_LibraryWriteBinStr( Map_SuperLib_t * pLib );
+extern int               Map_LibraryReadBinStr( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, Vec_Str_t * vStr );
 extern int               Map_LibraryReadTree( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, char * pFileName, char * pExcludeFile );
 extern void              Map_LibraryPrintTree( Map_SuperLib_t * pLib );
 /*=== mapperSuper.c ===============================================================*/
@@ -58,10 +58,9 @@ ABC_NAMESPACE_IMPL_START
   SeeAlso     []
 
 ***********************************************************************/
-Map_SuperLib_t * Map_SuperLibCreate( Mio_Library_t * pGenlib, Vec_Str_t * vStr, char * pFileName, char * pExcludeFile, int fAlgorithm, int fVerbose )
+static Map_SuperLib_t * Map_SuperLibStart( char * pFileName, int fVerbose )
 {
     Map_SuperLib_t * p;
-    abctime clk;
 
     // start the supergate library
     p = ABC_ALLOC( Map_SuperLib_t, 1 );
@@ -76,6 +75,41 @@ Map_SuperLib_t * Map_SuperLibCreate( Mio_Library_t * pGenlib, Vec_Str_t * vStr,
     // start the hash table
     p->tTableC = Map_SuperTableCreate( p );
     p->tTable  = Map_SuperTableCreate( p );
+    return p;
+}
+static void Map_SuperLibFinish( Map_SuperLib_t * p )
+{
+    // assign the interver parameters
+    p->pGateInv        = Mio_LibraryReadInv( p->pGenlib );
+    p->tDelayInv.Rise  = Mio_LibraryReadDelayInvRise( p->pGenlib );
+    p->tDelayInv.Fall  = Mio_LibraryReadDelayInvFall( p->pGenlib );
+    p->tDelayInv.Worst = MAP_MAX( p->tDelayInv.Rise, p->tDelayInv.Fall );
+    p->AreaInv         = Mio_LibraryReadAreaInv( p->pGenlib );
+    p->AreaBuf         = Mio_LibraryReadAreaBuf( p->pGenlib );
+
+    // assign the interver supergate
+    p->pSuperInv = (Map_Super_t *)Extra_MmFixedEntryFetch( p->mmSupers );
+    memset( p->pSuperInv, 0, sizeof(Map_Super_t) );
+    p->pSuperInv->Num         = -1;
+    p->pSuperInv->nGates      =  1;
+    p->pSuperInv->nFanins     =  1;
+    p->pSuperInv->nFanLimit   = 10;
+    p->pSuperInv->pFanins[0]  = p->ppSupers[0];
+    p->pSuperInv->pRoot       = p->pGateInv;
+    p->pSuperInv->Area        = p->AreaInv;
+    p->pSuperInv->tDelayMax   = p->tDelayInv;
+    p->pSuperInv->tDelaysR[0].Rise = MAP_NO_VAR;
+    p->pSuperInv->tDelaysR[0].Fall = p->tDelayInv.Rise;
+    p->pSuperInv->tDelaysF[0].Rise = p->tDelayInv.Fall;
+    p->pSuperInv->tDelaysF[0].Fall = MAP_NO_VAR;
+}
+Map_SuperLib_t * Map_SuperLibCreate( Mio_Library_t * pGenlib, Vec_Str_t * vStr, char * pFileName, char * pExcludeFile, int fAlgorithm, int fVerbose )
+{
+    Map_SuperLib_t * p;
+    abctime clk;
+
+    // start the supergate library
+    p = Map_SuperLibStart( pFileName, fVerbose );
 
     // read the supergate library from file
 clk = Abc_Clock();
@@ -129,33 +163,144 @@ clk = Abc_Clock();
         ABC_PRT( "Time", Abc_Clock() - clk );
     }
 
-    // assign the interver parameters
-    p->pGateInv        = Mio_LibraryReadInv( p->pGenlib );
-    p->tDelayInv.Rise  = Mio_LibraryReadDelayInvRise( p->pGenlib );
-    p->tDelayInv.Fall  = Mio_LibraryReadDelayInvFall( p->pGenlib );
-    p->tDelayInv.Worst = MAP_MAX( p->tDelayInv.Rise, p->tDelayInv.Fall );
-    p->AreaInv         = Mio_LibraryReadAreaInv( p->pGenlib );
-    p->AreaBuf         = Mio_LibraryReadAreaBuf( p->pGenlib );
-
-    // assign the interver supergate
-    p->pSuperInv = (Map_Super_t *)Extra_MmFixedEntryFetch( p->mmSupers );
-    memset( p->pSuperInv, 0, sizeof(Map_Super_t) );
-    p->pSuperInv->Num         = -1;
-    p->pSuperInv->nGates      =  1;
-    p->pSuperInv->nFanins     =  1;
-    p->pSuperInv->nFanLimit   = 10;
-    p->pSuperInv->pFanins[0]  = p->ppSupers[0];
-    p->pSuperInv->pRoot       = p->pGateInv;
-    p->pSuperInv->Area        = p->AreaInv;
-    p->pSuperInv->tDelayMax   = p->tDelayInv;
-    p->pSuperInv->tDelaysR[0].Rise = MAP_NO_VAR;
-    p->pSuperInv->tDelaysR[0].Fall = p->tDelayInv.Rise;
-    p->pSuperInv->tDelaysF[0].Rise = p->tDelayInv.Fall;
-    p->pSuperInv->tDelaysF[0].Fall = MAP_NO_VAR;
+    // assign the interver parameters and the interver supergate
+    Map_SuperLibFinish( p );
     return p;
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Reads the supergate library through the cache of binary images.]
+
+  Description [The cache is a directory with the binary images of the 
+  supergate libraries derived earlier. Each image is stored in file 
+  "<hash>.sgl", where the hash is computed from the genlib library (the 
+  gates, their areas, functions, and pin parameters) and from the source 
+  of supergates (the contents of the supergate file and the exclude file, 
+  or the parameters of supergate generation). The image is written by 
+  Abc_CacheSave() and contains the library written by 
+  Map_LibraryWriteBinStr(). When the image is present, it is memory-mapped 
+  and the supergates are read from the mapped pages without parsing and 
+  canonicization. Otherwise, the library is derived as usual and the image 
+  is added to the cache.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define MAP_CACHE_MAGIC    "SGLC"
+#define MAP_CACHE_VERSION  1
+
+static word Map_SuperLibCacheHashStr( char * pStr, word Hash )
+{
+    return Abc_CacheHash( pStr ? pStr : (char *)"", pStr ? (ABC_INT64_T)strlen(pStr) + 1 : 1, Hash );
+}
+static word Map_SuperLibCacheHashNum( double Num, word Hash )
+{
+    return Abc_CacheHash( (char *)&Num, sizeof(double), Hash );
+}
+static word Map_SuperLibCacheHashGenlib( Mio_Library_t * pGenlib, word Hash )
+{
+    Mio_Gate_t * pGate;
+    Mio_Pin_t * pPin;
+    int Version = MAP_CACHE_VERSION;
+    Hash = Abc_CacheHash( (char *)&Version, sizeof(int), Hash );
+    Hash = Map_SuperLibCacheHashStr( Mio_LibraryReadName(pGenlib), Hash );
+    for ( pGate = Mio_LibraryReadGates(pGenlib); pGate; pGate = Mio_GateReadNext(pGate) )
+    {
+        Hash = Map_SuperLibCacheHashStr( Mio_GateReadName(pGate), Hash );
+        Hash = Map_SuperLibCacheHashStr( Mio_GateReadOutName(pGate), Hash );
+        Hash = Map_SuperLibCacheHashStr( Mio_GateReadForm(pGate), Hash );
+        Hash = Map_SuperLibCacheHashNum( Mio_GateReadArea(pGate), Hash );
+        for ( pPin = Mio_GateReadPins(pGate); pPin; pPin = Mio_PinReadNext(pPin) )
+        {
+            Hash = Map_SuperLibCacheHashStr( Mio_PinReadName(pPin), Hash );
+            Hash = Map_SuperLibCacheHashNum( (double)Mio_PinReadPhase(pPin), Hash );
+            Hash = Map_SuperLibCacheHashNum( Mio_PinReadInputLoad(pPin), Hash );
+            Hash = Map_SuperLibCacheHashNum( Mio_PinReadMaxLoad(pPin), Hash );
+            Hash = Map_SuperLibCacheHashNum( Mio_PinReadDelayBlockRise(pPin), Hash );
+            Hash = Map_SuperLibCacheHashNum( Mio_PinReadDelayFanoutRise(pPin), Hash );
+            Hash = Map_SuperLibCacheHashNum( Mio_PinReadDelayBlockFall(pPin), Hash );
+            Hash = Map_SuperLibCacheHashNum( Mio_PinReadDelayFanoutFall(pPin), Hash );
+        }
+    }
+    return Hash;
+}
+static Map_SuperLib_t * Map_SuperLibCacheLoad( Mio_Library_t * pGenlib, char * pCacheName, word Hash, char * pFileName, int fVerbose )
+{
+    Map_SuperLib_t * p = NULL;
+    Vec_Str_t vOut;
+    char * pContents;
+    ABC_INT64_T nFileSize = 0;
+    abctime clk = Abc_Clock();
+    pContents = Abc_CacheMap( pCacheName, MAP_CACHE_MAGIC, MAP_CACHE_VERSION, Hash, &nFileSize );
+    if ( pContents == NULL )
+        return NULL;
+    vOut.pArray = pContents + ABC_CACHE_HEADER;
+    vOut.nSize  = vOut.nCap = (int)(nFileSize - ABC_CACHE_HEADER);
+    p = Map_SuperLibStart( pFileName, fVerbose );
+    if ( Map_LibraryReadBinStr( p, pGenlib, &vOut ) )
+        Map_SuperLibFinish( p );
+    else
+    {
+        // do not delete the genlib library, which belongs to the caller
+        p->pGenlib = NULL;
+        Map_SuperLibFree( p );
+        p = NULL;
+    }
+    Abc_FileUnmap( pContents, nFileSize );
+    if ( p && fVerbose )
+    {
+        printf( "Loaded %d unique %d-input supergates from \"%s\" (read from cache \"%s\").  ", 
+            p->nSupersReal, p->nVarsMax, pFileName, pCacheName );
+        ABC_PRT( "Time", Abc_Clock() - clk );
+    }
+    return p;
+}
+static void Map_SuperLibCacheSave( char * pCacheDir, char * pCacheName, word Hash, Map_SuperLib_t * p )
+{
+    Vec_Str_t * vStr = Map_LibraryWriteBinStr( p );
+    if ( !Abc_CacheSave( pCacheDir, pCacheName, MAP_CACHE_MAGIC, MAP_CACHE_VERSION, Hash, Vec_StrArray(vStr), Vec_StrSize(vStr) ) )
+        printf( "Cannot write supergate library cache \"%s\".\n", pCacheName );
+    Vec_StrFree( vStr );
+}
+Map_SuperLib_t * Map_SuperLibReadCache( Mio_Library_t * pGenlib, char * pFileName, char * pExcludeFile, char * pCacheDir, int fVerbose )
+{
+    Map_SuperLib_t * p;
+    char * pContents, * pCacheName;
+    word Hash = ABC_CACHE_HASH_START;
+    if ( pGenlib == NULL )
+        return NULL;
+    pContents = Mio_ReadFile( pFileName, 0 );
+    if ( pContents == NULL )
+    {
+        printf( "Cannot open input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    Hash = Map_SuperLibCacheHashGenlib( pGenlib, Hash );
+    Hash = Map_SuperLibCacheHashStr( pContents, Hash );
+    ABC_FREE( pContents );
+    if ( pExcludeFile )
+    {
+        pContents = Mio_ReadFile( pExcludeFile, 0 );
+        Hash = Map_SuperLibCacheHashStr( pContents ? pContents : pExcludeFile, Hash );
+        ABC_FREE( pContents );
+    }
+    pCacheName = Abc_CacheFileName( pCacheDir, Hash, "sgl" );
+    p = Map_SuperLibCacheLoad( pGenlib, pCacheName, Hash, pFileName, fVerbose );
+    if ( p == NULL )
+    {
+        // derive the library and add it to the cache
+        p = Map_SuperLibCreate( pGenlib, NULL, pFileName, pExcludeFile, 1, fVerbose );
+        if ( p != NULL )
+            Map_SuperLibCacheSave( pCacheDir, pCacheName, Hash, p );
+    }
+    ABC_FREE( pCacheName );
+    return p;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Deallocates the supergate library.]
@@ -201,21 +346,40 @@ void Map_SuperLibFree( Map_SuperLib_t * p )
 ***********************************************************************/
 int Map_SuperLibDeriveFromGenlib( Mio_Library_t * pLib, int fVerbose )
 {
-    Map_SuperLib_t * pLibSuper;
+    Map_SuperLib_t * pLibSuper = NULL;
     Vec_Str_t * vStr;
-    char * pFileName;
+    char * pFileName, * pCacheName = NULL;
+    char * pCacheDir = Abc_FrameReadFlag( "libcache" );
+    int pParams[8] = { 5, 1, 100000000, 10000000, 10000000, 100, 1, 0 };
+    word Hash = ABC_CACHE_HASH_START;
     if ( pLib == NULL )
         return 0;
-
-    // compute supergates
-    vStr = Super_PrecomputeStr( pLib, 5, 1, 100000000, 10000000, 10000000, 100, 1, 0 );
-    if ( vStr == NULL )
-        return 0;
-
-    // create supergate library
     pFileName = Extra_FileNameGenericAppend( Mio_LibraryReadName(pLib), ".super" );
-    pLibSuper = Map_SuperLibCreate( pLib, vStr, pFileName, NULL, 1, 0 );
-    Vec_StrFree( vStr );
+
+    // try the cache of supergate libraries
+    if ( pCacheDir )
+    {
+        Hash = Map_SuperLibCacheHashGenlib( pLib, Hash );
+        Hash = Abc_CacheHash( (char *)pParams, sizeof(pParams), Hash );
+        pCacheName = Abc_CacheFileName( pCacheDir, Hash, "sgl" );
+        pLibSuper = Map_SuperLibCacheLoad( pLib, pCacheName, Hash, pFileName, 0 );
+    }
+    if ( pLibSuper == NULL )
+    {
+        // compute supergates
+        vStr = Super_PrecomputeStr( pLib, pParams[0], pParams[1], pParams[2], (float)pParams[3], (float)pParams[4], pParams[5], pParams[6], pParams[7] );
+        if ( vStr == NULL )
+        {
+            ABC_FREE( pCacheName );
+            return 0;
+        }
+        // create supergate library
+        pLibSuper = Map_SuperLibCreate( pLib, vStr, pFileName, NULL, 1, 0 );
+        Vec_StrFree( vStr );
+        if ( pLibSuper && pCacheName )
+            Map_SuperLibCacheSave( pCacheDir, pCacheName, Hash, pLibSuper );
+    }
+    ABC_FREE( pCacheName );
 
     // replace the library
     Map_SuperLibFree( (Map_SuperLib_t *)Abc_FrameReadLibSuper() );
@@ -32,6 +32,7 @@ ABC_NAMESPACE_IMPL_START
 static void      Map_LibraryAddFaninDelays( Map_SuperLib_t * pLib, Map_Super_t * pGate, Map_Super_t * pFanin, Mio_Pin_t * pPin );
 static int       Map_LibraryGetMaxSuperPi_rec( Map_Super_t * pGate );
 static unsigned  Map_LibraryGetGateSupp_rec( Map_Super_t * pGate );
+static void      Map_LibraryStartSupers( Map_SuperLib_t * pLib );
 
 // fanout limits
 static const int s_MapFanoutLimits[10] = { 1/*0*/, 10/*1*/, 5/*2*/, 2/*3*/, 1/*4*/, 1/*5*/, 1/*6*/ };
@@ -377,6 +378,50 @@ int Map_LibraryCompareLibNames( char * pName1, char * pName2 )
     return RetValue; 
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Allocates the supergate array and creates elementary supergates.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Map_LibraryStartSupers( Map_SuperLib_t * pLib )
+{
+    Map_Super_t * pGate;
+    int i, k;
+
+    // allocate room for supergate pointers
+    pLib->ppSupers = ABC_ALLOC( Map_Super_t *, pLib->nLines + 10000 );
+
+    // create the elementary supergates
+    for ( i = 0; i < pLib->nVarsMax; i++ )
+    {
+        // get a new gate
+        pGate = (Map_Super_t *)Extra_MmFixedEntryFetch( pLib->mmSupers );
+        memset( pGate, 0, sizeof(Map_Super_t) );
+        // assign the elementary variable, the truth table, and the delays
+        pGate->Num = i;
+        // set the truth table
+        pGate->uTruth[0] = pLib->uTruths[i][0];
+        pGate->uTruth[1] = pLib->uTruths[i][1];
+        // set the arrival times of all input to non-existent delay
+        for ( k = 0; k < pLib->nVarsMax; k++ )
+        {
+            pGate->tDelaysR[k].Rise = pGate->tDelaysR[k].Fall = MAP_NO_VAR;
+            pGate->tDelaysF[k].Rise = pGate->tDelaysF[k].Fall = MAP_NO_VAR;
+        }
+        // set an existent arrival time for rise and fall
+        pGate->tDelaysR[i].Rise = 0.0;
+        pGate->tDelaysF[i].Fall = 0.0;
+        // set the gate
+        pLib->ppSupers[i] = pGate;
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the supergate library from file.]
@@ -394,7 +439,7 @@ int Map_LibraryReadFileTreeStr( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib,
     char pBuffer[5000];
     Map_Super_t * pGate;
     char * pTemp = 0, * pLibName;
-    int nCounter, k, i;
+    int nCounter, k;
     int RetValue, nPos = 0;
 
     // skip empty and comment lines
@@ -454,32 +499,8 @@ int Map_LibraryReadFileTreeStr( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib,
         return 0;
     }
 
-    // allocate room for supergate pointers
-    pLib->ppSupers = ABC_ALLOC( Map_Super_t *, pLib->nLines + 10000 );
-
-    // create the elementary supergates
-    for ( i = 0; i < pLib->nVarsMax; i++ )
-    {
-        // get a new gate
-        pGate = (Map_Super_t *)Extra_MmFixedEntryFetch( pLib->mmSupers );
-        memset( pGate, 0, sizeof(Map_Super_t) );
-        // assign the elementary variable, the truth table, and the delays
-        pGate->Num = i;
-        // set the truth table
-        pGate->uTruth[0] = pLib->uTruths[i][0];
-        pGate->uTruth[1] = pLib->uTruths[i][1];
-        // set the arrival times of all input to non-existent delay
-        for ( k = 0; k < pLib->nVarsMax; k++ )
-        {
-            pGate->tDelaysR[k].Rise = pGate->tDelaysR[k].Fall = MAP_NO_VAR;
-            pGate->tDelaysF[k].Rise = pGate->tDelaysF[k].Fall = MAP_NO_VAR;
-        }
-        // set an existent arrival time for rise and fall
-        pGate->tDelaysR[i].Rise = 0.0;
-        pGate->tDelaysF[i].Fall = 0.0;
-        // set the gate
-        pLib->ppSupers[i] = pGate;
-    }
+    // allocate room for supergate pointers and create the elementary supergates
+    Map_LibraryStartSupers( pLib );
 
     // read the lines
     nCounter = pLib->nVarsMax;
@@ -565,12 +586,249 @@ int Map_LibraryReadTree( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, char *
     return Map_LibraryDeriveGateInfo( pLib, tExcludeGate );
 }
 
+/**Function*************************************************************
 
+  Synopsis    [Writes the supergate library into a binary image.]
+
+  Description [The image starts with the number of variables, supergates,
+  and lines. Each line is represented by the name of the root gate, the
+  flags (supergate, excluded), the fanin numbers, and the formula. The 
+  lines are followed by the derived info of the lines (except elementary
+  ones) stored in contiguous arrays: the truth tables, the N-canonical 
+  forms, the areas, the pin-to-pin delays, and the phases with the number 
+  of gates. The arrays are aligned at four bytes and use the native byte 
+  order. When the image is read back, the supergates are restored without 
+  deriving truth tables and delays and without canonicization.]
+               
+  SideEffects []
 
+  SeeAlso     []
 
+***********************************************************************/
+#define MAP_BIN_DELAY_NUM(nVars)  (2 + 4 * (nVars))
 
+Vec_Str_t * Map_LibraryWriteBinStr( Map_SuperLib_t * pLib )
+{
+    Vec_Str_t * vOut;
+    Map_HashEntry_t * pEnt;
+    Map_Super_t * pGate;
+    int nDelays = MAP_BIN_DELAY_NUM(pLib->nVarsMax);
+    int nGates = pLib->nLines - pLib->nVarsMax;
+    unsigned * pTruths = ABC_CALLOC( unsigned, 2 * nGates );
+    unsigned * pCanons = ABC_CALLOC( unsigned, 2 * nGates );
+    float * pAreas = ABC_CALLOC( float, nGates );
+    float * pDelays = ABC_CALLOC( float, nDelays * nGates ), * pDelay;
+    unsigned char * pPhases = ABC_CALLOC( unsigned char, 8 * nGates );
+    int i, k;
+
+    // collect the canonical forms of the supergates from the table
+    for ( i = 0; i < pLib->tTableC->nBins; i++ )
+        for ( pEnt = pLib->tTableC->pBins[i]; pEnt; pEnt = pEnt->pNext )
+            for ( pGate = pEnt->pGates; pGate; pGate = pGate->pNext )
+            {
+                pCanons[2*(pGate->Num - pLib->nVarsMax)+0] = pEnt->uTruth[0];
+                pCanons[2*(pGate->Num - pLib->nVarsMax)+1] = pEnt->uTruth[1];
+            }
+
+    // write the lines
+    vOut = Vec_StrAlloc( 100 * pLib->nLines );
+    Vec_StrPutI_ne( vOut, pLib->nVarsMax );
+    Vec_StrPutI_ne( vOut, pLib->nSupersReal );
+    Vec_StrPutI_ne( vOut, pLib->nLines );
+    for ( i = pLib->nVarsMax; i < pLib->nLines; i++ )
+    {
+        pGate = pLib->ppSupers[i];
+        Vec_StrPutS( vOut, Mio_GateReadName(pGate->pRoot) );
+        Vec_StrPutC( vOut, (char)(pGate->fSuper | (pGate->fExclude << 1)) );
+        Vec_StrPutC( vOut, (char)pGate->nFanins );
+        for ( k = 0; k < (int)pGate->nFanins; k++ )
+            Vec_StrPutI( vOut, pGate->pFanins[k]->Num );
+        Vec_StrPutS( vOut, pGate->pFormula ? pGate->pFormula : (char *)"" );
+    }
+    while ( Vec_StrSize(vOut) % 4 )
+        Vec_StrPush( vOut, 0 );
+
+    // write the derived info
+    for ( i = 0; i < nGates; i++ )
+    {
+        pGate = pLib->ppSupers[pLib->nVarsMax + i];
+        pTruths[2*i+0] = pGate->uTruth[0];
+        pTruths[2*i+1] = pGate->uTruth[1];
+        pAreas[i]      = pGate->Area;
+        pDelay         = pDelays + nDelays * i;
+        *pDelay++      = pGate->tDelayMax.Rise;
+        *pDelay++      = pGate->tDelayMax.Fall;
+        for ( k = 0; k < pLib->nVarsMax; k++ )
+        {
+            *pDelay++ = pGate->tDelaysR[k].Rise;
+            *pDelay++ = pGate->tDelaysR[k].Fall;
+            *pDelay++ = pGate->tDelaysF[k].Rise;
+            *pDelay++ = pGate->tDelaysF[k].Fall;
+        }
+        pPhases[8*i+0] = (unsigned char)pGate->nPhases;
+        pPhases[8*i+1] = (unsigned char)pGate->nGates;
+        memcpy( pPhases + 8*i+2, pGate->uPhases, 4 );
+    }
+    Vec_StrPushBuffer( vOut, (char *)pTruths, sizeof(unsigned) * 2 * nGates );
+    Vec_StrPushBuffer( vOut, (char *)pCanons, sizeof(unsigned) * 2 * nGates );
+    Vec_StrPushBuffer( vOut, (char *)pAreas,  sizeof(float) * nGates );
+    Vec_StrPushBuffer( vOut, (char *)pDelays, sizeof(float) * nDelays * nGates );
+    Vec_StrPushBuffer( vOut, (char *)pPhases, 8 * nGates );
+    ABC_FREE( pTruths );
+    ABC_FREE( pCanons );
+    ABC_FREE( pAreas );
+    ABC_FREE( pDelays );
+    ABC_FREE( pPhases );
+    return vOut;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the supergate library from a binary image.]
+
+  Description [The image is produced by Map_LibraryWriteBinStr() for the 
+  same genlib library and should start at the address aligned at four 
+  bytes. The supergates are added to the table of canonical forms in the 
+  same order as in Map_LibraryDeriveGateInfo(), which makes the resulting 
+  library identical to the one derived from the text file. Every read is
+  bounded by the size of the image, so a truncated or corrupted image is
+  rejected instead of being read past its end.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Map_LibraryReadBinName( Vec_Str_t * vStr, int * pPos )
+{
+    char * pName, * pStop;
+    if ( *pPos >= Vec_StrSize(vStr) )
+        return NULL;
+    pName = Vec_StrEntryP( vStr, *pPos );
+    pStop = (char *)memchr( pName, 0, Vec_StrSize(vStr) - *pPos );
+    if ( pStop == NULL )
+        return NULL;
+    *pPos += (int)(pStop - pName) + 1;
+    return pName;
+}
+static int Map_LibraryReadBinNum( Vec_Str_t * vStr, int * pPos )
+{
+    unsigned char ch;
+    unsigned Val = 0;
+    int i = 0;
+    do
+    {
+        if ( *pPos >= Vec_StrSize(vStr) || i == 5 )
+            return -1;
+        ch = (unsigned char)Vec_StrEntry( vStr, (*pPos)++ );
+        Val |= (unsigned)(ch & 0x7f) << (7 * i++);
+    }
+    while ( ch & 0x80 );
+    return (int)Val;
+}
+int Map_LibraryReadBinStr( Map_SuperLib_t * pLib, Mio_Library_t * pGenlib, Vec_Str_t * vStr )
+{
+    Map_Super_t * pGate;
+    unsigned * pTruths, * pCanons;
+    float * pAreas, * pDelays, * pDelay;
+    unsigned char * pPhases;
+    char * pName;
+    int i, k, Num, Flags, nCounter, nDelays, nGates, nPos = 0;
+
+    pLib->pGenlib     = pGenlib;
+    if ( Vec_StrSize(vStr) < 12 )
+        return 0;
+    pLib->nVarsMax    = Vec_StrGetI_ne( vStr, &nPos );
+    pLib->nSupersReal = Vec_StrGetI_ne( vStr, &nPos );
+    pLib->nLines      = Vec_StrGetI_ne( vStr, &nPos );
+    if ( pLib->nVarsMax < 2 || pLib->nVarsMax > 6 || pLib->nLines <= pLib->nVarsMax || pLib->nLines > 10000000 )
+        return 0;
+    Map_LibraryStartSupers( pLib );
 
+    // read the lines
+    for ( i = pLib->nVarsMax; i < pLib->nLines; i++ )
+    {
+        pGate = (Map_Super_t *)Extra_MmFixedEntryFetch( pLib->mmSupers );
+        memset( pGate, 0, sizeof(Map_Super_t) );
+        pGate->Num = i;
+        pLib->ppSupers[i] = pGate;
+        if ( (pName = Map_LibraryReadBinName( vStr, &nPos )) == NULL )
+            return 0;
+        pGate->pRoot = Mio_LibraryReadGateByName( pGenlib, pName, NULL );
+        if ( pGate->pRoot == NULL || nPos + 2 > Vec_StrSize(vStr) )
+            return 0;
+        Flags = Vec_StrGetC( vStr, &nPos );
+        pGate->fSuper    = Flags & 1;
+        pGate->fExclude  = (Flags >> 1) & 1;
+        pGate->nFanins   = Vec_StrGetC( vStr, &nPos );
+        pGate->nFanLimit = s_MapFanoutLimits[ Mio_GateReadPinNum(pGate->pRoot) ];
+        if ( pGate->nFanins != (unsigned)Mio_GateReadPinNum(pGate->pRoot) )
+            return 0;
+        for ( k = 0; k < (int)pGate->nFanins; k++ )
+        {
+            Num = Map_LibraryReadBinNum( vStr, &nPos );
+            if ( Num < 0 || Num >= i )
+                return 0;
+            pGate->pFanins[k] = pLib->ppSupers[Num];
+        }
+        if ( (pName = Map_LibraryReadBinName( vStr, &nPos )) == NULL )
+            return 0;
+        if ( pName[0] )
+        {
+            pGate->pFormula = Extra_MmFlexEntryFetch( pLib->mmForms, strlen(pName)+1 );
+            strcpy( pGate->pFormula, pName );
+        }
+    }
+    pLib->nSupersAll = pLib->nLines;
+    // count the number of real supergates
+    nCounter = 0;
+    for ( k = 0; k < pLib->nLines; k++ )
+        nCounter += pLib->ppSupers[k]->fSuper;
+    if ( nCounter != pLib->nSupersReal )
+        return 0;
 
+    // find the derived info
+    nPos    = (nPos + 3) / 4 * 4;
+    nDelays = MAP_BIN_DELAY_NUM(pLib->nVarsMax);
+    nGates  = pLib->nLines - pLib->nVarsMax;
+    if ( nPos + (4 * (2 + 2 + 1 + nDelays) + 8) * nGates != Vec_StrSize(vStr) )
+        return 0;
+    pTruths = (unsigned *)Vec_StrEntryP( vStr, nPos );
+    pCanons = pTruths + 2 * nGates;
+    pAreas  = (float *)(pCanons + 2 * nGates);
+    pDelays = pAreas + nGates;
+    pPhases = (unsigned char *)(pDelays + nDelays * nGates);
+
+    // set the derived info
+    for ( i = 0; i < nGates; i++ )
+    {
+        pGate = pLib->ppSupers[pLib->nVarsMax + i];
+        pGate->uTruth[0] = pTruths[2*i+0];
+        pGate->uTruth[1] = pTruths[2*i+1];
+        pGate->Area      = pAreas[i];
+        pDelay           = pDelays + nDelays * i;
+        pGate->tDelayMax.Rise = *pDelay++;
+        pGate->tDelayMax.Fall = *pDelay++;
+        for ( k = 0; k < pLib->nVarsMax; k++ )
+        {
+            pGate->tDelaysR[k].Rise  = *pDelay++;
+            pGate->tDelaysR[k].Fall  = *pDelay++;
+            pGate->tDelaysF[k].Rise  = *pDelay++;
+            pGate->tDelaysF[k].Fall  = *pDelay++;
+            pGate->tDelaysF[k].Worst = MAP_MAX( pGate->tDelaysF[k].Fall, pGate->tDelaysF[k].Rise );
+            pGate->tDelaysR[k].Worst = MAP_MAX( pGate->tDelaysR[k].Fall, pGate->tDelaysR[k].Rise );
+        }
+        pGate->nPhases = pPhases[8*i+0];
+        pGate->nGates  = pPhases[8*i+1];
+        memcpy( pGate->uPhases, pPhases + 8*i+2, 4 );
+        // add the supergate into the table by its N-canonical form
+        if ( pGate->fSuper && !pGate->fExclude )
+            Map_SuperTableInsertC( pLib->tTableC, pCanons + 2*i, pGate );
+    }
+    // sort the gates in each line
+    Map_SuperTableSortSupergatesByDelay( pLib->tTableC, pLib->nSupersAll );
+    return 1;
+}
 
 /**Function*************************************************************
 
@@ -90,23 +90,22 @@ void Abc_SclFindWindow( Abc_Obj_t * pPivot, Vec_Int_t ** pvNodes, Vec_Int_t ** p
 
 /**Function*************************************************************
 
-  Synopsis    [Returns 1 if the node can be improved.]
+  Synopsis    [Finds the best smaller cell of the node.]
 
-  Description [Updated the node to have a new gate.]
+  Description [Returns the best cell or -1 if the node cannot be improved.
+  The cells are tried without changing the network, so the procedure can
+  be called with a thread-private manager.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_SclCheckImprovement( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap )
+int Abc_SclFindBestDnsize( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap, float * pGainBest )
 {
-    Abc_Obj_t * pTemp;
     SC_Cell * pCellOld, * pCellNew;
     float dGain, dGainBest;
-    int i, k, gateBest;
-    abctime clk;
-clk = Abc_Clock();
+    int i, gateBest;
 //    printf( "%d -> %d\n", Vec_IntSize(vNodes), Vec_IntSize(vEvals) );
     // save old gate, timing, fanin load
     pCellOld = Abc_SclObjCell( pObj );
@@ -122,13 +121,14 @@ clk = Abc_Clock();
             continue;
         if ( i > Notches )
             break;
-        // set new cell
-        Abc_SclObjSetCell( pObj, pCellNew );
+        // try new cell
+        p->pTryObj  = pObj;
+        p->pTryCell = pCellNew;
         Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
         // recompute timing
         Abc_SclTimeCone( p, vNodes );
         // set old cell
-        Abc_SclObjSetCell( pObj, pCellOld );
+        p->pTryObj  = NULL;
         Abc_SclLoadRestore( p, pObj );
         // evaluate gain
         dGain = Abc_SclEvalPerformLegal( p, vEvals, p->MaxDelay0 );
@@ -141,23 +141,63 @@ clk = Abc_Clock();
             gateBest = pCellNew->Id;
         }
     } 
-    // put back old cell and timing
-    Abc_SclObjSetCell( pObj, pCellOld );
+    // put back old timing
     Abc_SclConeRestore( p, vNodes );
+    *pGainBest = dGainBest;
+    return gateBest;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the node to have a new gate.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclApplyDnsize( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, int gateBest )
+{
+    Abc_Obj_t * pTemp;
+    SC_Cell * pCellOld = Abc_SclObjCell( pObj );
+    SC_Cell * pCellNew = SC_LibCell( p->pLib, gateBest );
+    int k;
+    Abc_SclObjSetCell( pObj, pCellNew );
+    p->SumArea += Abc_SclObjAreaDelta( pObj, pCellOld, pCellNew );
+//    printf( "%f   %f -> %f\n", pCellNew->area - pCellOld->area, p->SumArea - (pCellNew->area - pCellOld->area), p->SumArea );
+//    printf( "%6d  %20s -> %20s  %f -> %f\n", Abc_ObjId(pObj), pCellOld->pName, pCellNew->pName, pCellOld->area, pCellNew->area );
+    // mark used nodes with the current trav ID
+    Abc_NtkForEachObjVec( vNodes, p->pNtk, pTemp, k )
+        Abc_NodeSetTravIdCurrent( pTemp );
+    // update load and timing...
+    Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
+    Abc_SclTimeIncInsert( p, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the node can be improved.]
+
+  Description [Updated the node to have a new gate.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclCheckImprovement( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap )
+{
+    float dGainBest;
+    int gateBest;
+    abctime clk;
+clk = Abc_Clock();
+    gateBest = Abc_SclFindBestDnsize( p, pObj, vNodes, vEvals, Notches, DelayGap, &dGainBest );
 p->timeSize += Abc_Clock() - clk;
     if ( gateBest >= 0 )
     {
-        pCellNew = SC_LibCell( p->pLib, gateBest );
-        Abc_SclObjSetCell( pObj, pCellNew );
-        p->SumArea += Abc_SclObjAreaDelta( pObj, pCellOld, pCellNew );
-//        printf( "%f   %f -> %f\n", pCellNew->area - pCellOld->area, p->SumArea - (pCellNew->area - pCellOld->area), p->SumArea );
-//        printf( "%6d  %20s -> %20s  %f -> %f\n", Abc_ObjId(pObj), pCellOld->pName, pCellNew->pName, pCellOld->area, pCellNew->area );
-        // mark used nodes with the current trav ID
-        Abc_NtkForEachObjVec( vNodes, p->pNtk, pTemp, k )
-            Abc_NodeSetTravIdCurrent( pTemp );
-        // update load and timing...
-        Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
-        Abc_SclTimeIncInsert( p, pObj );
+        Abc_SclApplyDnsize( p, pObj, vNodes, gateBest );
         return 1;
     }
     return 0;
@@ -197,6 +237,91 @@ int Abc_SclCheckOverlap( Abc_Ntk_t * pNtk, Vec_Int_t * vNodes )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Downsizes a batch of nodes using several threads.]
+
+  Description [Takes the next batch of nodes from the queue and finds
+  their windows. The nodes whose windows do not overlap with the windows
+  updated in this round are evaluated in parallel. The improvements are
+  then applied in the queue order, skipping the nodes whose windows
+  overlap with the windows updated earlier in the batch. Since timing is
+  not updated until the end of the round, the result is the same as when
+  the nodes are processed one at a time. Returns the number of changes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclDnsizeBatch( SC_Man * p, SC_SizePars * pPars, Vec_Int_t * vTryLater, int * pnAttempt, int * pnOverlap )
+{
+    int nBatchSize = 64 * pPars->nProcs;
+    Vec_Int_t * vBatch = Vec_IntAlloc( nBatchSize );
+    Vec_Int_t * vMap   = Vec_IntAlloc( nBatchSize );
+    Vec_Int_t * vObjs  = Vec_IntAlloc( nBatchSize );
+    Vec_Wec_t * vWins  = Vec_WecAlloc( nBatchSize );
+    Vec_Wec_t * vCones = Vec_WecAlloc( nBatchSize );
+    Vec_Wec_t * vEvals = Vec_WecAlloc( nBatchSize );
+    Vec_Int_t * vGates = Vec_IntAlloc( nBatchSize );
+    Vec_Flt_t * vGains = Vec_FltAlloc( nBatchSize );
+    Vec_Int_t * vNodes = Vec_IntAlloc( 100 );
+    Vec_Int_t * vEval  = Vec_IntAlloc( 100 );
+    Abc_Obj_t * pObj;
+    int i, iEval, nChanges = 0;
+    abctime clk = Abc_Clock();
+    // collect the windows
+    while ( Vec_QueSize(p->vNodeByGain) > 0 && Vec_IntSize(vBatch) < nBatchSize )
+    {
+        pObj = Abc_NtkObj( p->pNtk, Vec_QuePop(p->vNodeByGain) );
+        Abc_SclFindWindow( pObj, &vNodes, &vEval );
+        Vec_IntPush( vBatch, Abc_ObjId(pObj) );
+        Vec_IntAppend( Vec_WecPushLevel(vWins), vNodes );
+        if ( Abc_SclCheckOverlap( p->pNtk, vNodes ) )
+        {
+            Vec_IntPush( vMap, -1 );
+            continue;
+        }
+        Vec_IntPush( vMap, Vec_IntSize(vObjs) );
+        Vec_IntPush( vObjs, Abc_ObjId(pObj) );
+        Vec_IntAppend( Vec_WecPushLevel(vCones), vNodes );
+        Vec_IntAppend( Vec_WecPushLevel(vEvals), vEval );
+    }
+    p->timeCone += Abc_Clock() - clk;
+    // evaluate the nodes
+    clk = Abc_Clock();
+    Abc_SclEvalCandidates( p, vObjs, vCones, vEvals, Abc_SclFindBestDnsize, pPars->Notches, pPars->DelayGap, pPars->nProcs, vGates, vGains );
+    p->timeSize += Abc_Clock() - clk;
+    // apply the improvements in the original order
+    Abc_NtkForEachObjVec( vBatch, p->pNtk, pObj, i )
+    {
+        (*pnAttempt)++;
+        if ( Abc_SclCheckOverlap( p->pNtk, Vec_WecEntry(vWins, i) ) )
+        {
+            (*pnOverlap)++;
+            Vec_IntPush( vTryLater, Abc_ObjId(pObj) );
+            continue;
+        }
+        iEval = Vec_IntEntry( vMap, i );
+        assert( iEval >= 0 );
+        if ( Vec_IntEntry(vGates, iEval) < 0 )
+            continue;
+        Abc_SclApplyDnsize( p, pObj, Vec_WecEntry(vWins, i), Vec_IntEntry(vGates, iEval) );
+        nChanges++;
+    }
+    Vec_IntFree( vBatch );
+    Vec_IntFree( vMap );
+    Vec_IntFree( vObjs );
+    Vec_WecFree( vWins );
+    Vec_WecFree( vCones );
+    Vec_WecFree( vEvals );
+    Vec_IntFree( vGates );
+    Vec_FltFree( vGains );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vEval );
+    return nChanges;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Print cumulative statistics.]
@@ -255,7 +380,8 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         printf( "UseWL =%2d. ",           pPars->fUseWireLoads );
         printf( "Target =%5d ps. ",       pPars->DelayUser );
         printf( "DelayGap =%3d ps. ",     pPars->DelayGap );
-        printf( "Timeout =%4d sec",       pPars->TimeOut   );
+        printf( "Timeout =%4d sec. ",     pPars->TimeOut   );
+        printf( "Threads =%3d",           pPars->nProcs    );
         printf( "\n" );
     }
 
@@ -282,6 +408,11 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             Abc_NtkIncrementTravId( pNtk );
             while ( Vec_QueSize(p->vNodeByGain) > 0 )
             {
+                if ( pPars->nProcs > 1 && p->pFuncFanin == NULL )
+                {
+                    nChanges += Abc_SclDnsizeBatch( p, pPars, vTryLater, &nAttempt, &nOverlap );
+                    continue;
+                }
                 clk = Abc_Clock();
                 pObj = Abc_NtkObj( p->pNtk, Vec_QuePop(p->vNodeByGain) );
                 Abc_SclFindWindow( pObj, &vNodes, &vEvals );
@@ -33,6 +33,11 @@
 #include <math.h>
 #include "misc/vec/vec.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define SCL_LIB_USE_SSE
+#include <emmintrin.h>
+#endif
+
 ABC_NAMESPACE_HEADER_START
 
 
@@ -92,6 +97,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nProcs;           // the number of threads
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -174,6 +180,9 @@ struct SC_Timing_
     SC_Surface     pFallTrans;
     SC_Surface     pRisePower;     // -- Used to compute internal power
     SC_Surface     pFallPower;
+    float *        pFlat;          // -- the four timing surfaces in one array (see Abc_SclLibFlatten)
+    int            nFlat0;         // -- the number of slew indexes in the flat array
+    int            nFlat1;         // -- the number of load indexes in the flat array
 };
 
 struct SC_Timings_ 
@@ -413,6 +422,7 @@ static inline void Abc_SclTimingFree( SC_Timing * p )
     Abc_SclSurfaceFree( &p->pFallTrans );
     Abc_SclSurfaceFree( &p->pRisePower );
     Abc_SclSurfaceFree( &p->pFallPower );
+    ABC_FREE( p->pFlat );
     ABC_FREE( p->related_pin );
     ABC_FREE( p->when_text );
     ABC_FREE( p );
@@ -586,8 +596,122 @@ static inline float Scl_LibLookup( SC_Surface * p, float slew, float load )
 
     return p0 + sfrac * (p1 - p0);      // <<== multiply result with K factor here 
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Lookup in the flattened timing surfaces.]
+
+  Description [Looks up all four timing surfaces of the arc at once:
+  cell_rise and rise_transition at (SlewR, LoadR), cell_fall and 
+  fall_transition at (SlewF, LoadF). The flat array (see Abc_SclLibFlatten)
+  holds the slew indexes, the load indexes and, for each point of the grid,
+  the values of the four surfaces in the above order. The interpolation
+  is the same as in Scl_LibLookup() and gives the same results.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Scl_LibFlatIndexOffset( int nIndex )
+{
+    return (nIndex + 3) & ~3;
+}
+static inline int Scl_LibLookupFlatIndex( float * pIndex, int nIndex, float Value )
+{
+    int i;
+    for ( i = 1; i < nIndex-1; i++ )
+        if ( pIndex[i] > Value )
+            break;
+    return i-1;
+}
+static inline void Scl_LibLookupFlat( SC_Timing * pTime, float SlewR, float LoadR, float SlewF, float LoadF, float * pRes )
+{
+    float * pIndex0 = pTime->pFlat;
+    float * pIndex1 = pIndex0 + Scl_LibFlatIndexOffset(pTime->nFlat0);
+    float * pData   = pIndex1 + Scl_LibFlatIndexOffset(pTime->nFlat1);
+    int sR = Scl_LibLookupFlatIndex( pIndex0, pTime->nFlat0, SlewR );
+    int sF = Scl_LibLookupFlatIndex( pIndex0, pTime->nFlat0, SlewF );
+    int lR = Scl_LibLookupFlatIndex( pIndex1, pTime->nFlat1, LoadR );
+    int lF = Scl_LibLookupFlatIndex( pIndex1, pTime->nFlat1, LoadF );
+    float * pDataR  = pData + 4 * (sR * pTime->nFlat1 + lR);
+    float * pDataF  = pData + 4 * (sF * pTime->nFlat1 + lF);
+    int Step = 4 * pTime->nFlat1;
+#ifdef SCL_LIB_USE_SSE
+    // the lanes are (cell_rise, cell_fall, rise_transition, fall_transition)
+    __m128 MaskF = _mm_castsi128_ps( _mm_setr_epi32(0, -1, 0, -1) );
+    __m128 Slew  = _mm_setr_ps( SlewR, SlewF, SlewR, SlewF );
+    __m128 Load  = _mm_setr_ps( LoadR, LoadF, LoadR, LoadF );
+    __m128 S0    = _mm_setr_ps( pIndex0[sR],   pIndex0[sF],   pIndex0[sR],   pIndex0[sF]   );
+    __m128 S1    = _mm_setr_ps( pIndex0[sR+1], pIndex0[sF+1], pIndex0[sR+1], pIndex0[sF+1] );
+    __m128 L0    = _mm_setr_ps( pIndex1[lR],   pIndex1[lF],   pIndex1[lR],   pIndex1[lF]   );
+    __m128 L1    = _mm_setr_ps( pIndex1[lR+1], pIndex1[lF+1], pIndex1[lR+1], pIndex1[lF+1] );
+    __m128 SFrac = _mm_div_ps( _mm_sub_ps(Slew, S0), _mm_sub_ps(S1, S0) );
+    __m128 LFrac = _mm_div_ps( _mm_sub_ps(Load, L0), _mm_sub_ps(L1, L0) );
+    __m128 D00   = _mm_or_ps( _mm_andnot_ps(MaskF, _mm_loadu_ps(pDataR)),          _mm_and_ps(MaskF, _mm_loadu_ps(pDataF))          );
+    __m128 D01   = _mm_or_ps( _mm_andnot_ps(MaskF, _mm_loadu_ps(pDataR+4)),        _mm_and_ps(MaskF, _mm_loadu_ps(pDataF+4))        );
+    __m128 D10   = _mm_or_ps( _mm_andnot_ps(MaskF, _mm_loadu_ps(pDataR+Step)),     _mm_and_ps(MaskF, _mm_loadu_ps(pDataF+Step))     );
+    __m128 D11   = _mm_or_ps( _mm_andnot_ps(MaskF, _mm_loadu_ps(pDataR+Step+4)),   _mm_and_ps(MaskF, _mm_loadu_ps(pDataF+Step+4))   );
+    __m128 P0    = _mm_add_ps( D00, _mm_mul_ps(LFrac, _mm_sub_ps(D01, D00)) );
+    __m128 P1    = _mm_add_ps( D10, _mm_mul_ps(LFrac, _mm_sub_ps(D11, D10)) );
+    _mm_storeu_ps( pRes, _mm_add_ps(P0, _mm_mul_ps(SFrac, _mm_sub_ps(P1, P0))) );
+#else
+    int k;
+    for ( k = 0; k < 4; k++ )
+    {
+        int fFall = k & 1, s = fFall ? sF : sR, l = fFall ? lF : lR;
+        float * pD = (fFall ? pDataF : pDataR) + k;
+        float sfrac = ((fFall ? SlewF : SlewR) - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
+        float lfrac = ((fFall ? LoadF : LoadR) - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+        float p0 = pD[0]    + lfrac * (pD[4] - pD[0]);
+        float p1 = pD[Step] + lfrac * (pD[Step+4] - pD[Step]);
+        pRes[k] = p0 + sfrac * (p1 - p0);
+    }
+#endif
+}
+static inline void Scl_LibPinArrivalFlat( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pArrOut, SC_Pair * pSlewOut )
+{
+    float Res[4];
+    if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
+    {
+        Scl_LibLookupFlat( pTime, pSlewIn->rise, pLoad->rise, pSlewIn->fall, pLoad->fall, Res );
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + Res[0] );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->fall + Res[1] );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Res[2] );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Res[3] );
+    }
+    if (pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non)
+    {
+        Scl_LibLookupFlat( pTime, pSlewIn->fall, pLoad->rise, pSlewIn->rise, pLoad->fall, Res );
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->fall + Res[0] );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->rise + Res[1] );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Res[2] );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Res[3] );
+    }
+}
+static inline void Scl_LibPinDepartureFlat( SC_Timing * pTime, SC_Pair * pDepIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pDepOut )
+{
+    float Res[4];
+    if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
+    {
+        Scl_LibLookupFlat( pTime, pSlewIn->rise, pLoad->rise, pSlewIn->fall, pLoad->fall, Res );
+        pDepIn->rise  = Abc_MaxFloat( pDepIn->rise,  pDepOut->rise + Res[0] );
+        pDepIn->fall  = Abc_MaxFloat( pDepIn->fall,  pDepOut->fall + Res[1] );
+    }
+    if (pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non)
+    {
+        Scl_LibLookupFlat( pTime, pSlewIn->fall, pLoad->rise, pSlewIn->rise, pLoad->fall, Res );
+        pDepIn->fall  = Abc_MaxFloat( pDepIn->fall,  pDepOut->rise + Res[0] );
+        pDepIn->rise  = Abc_MaxFloat( pDepIn->rise,  pDepOut->fall + Res[1] );
+    }
+}
 static inline void Scl_LibPinArrival( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pArrOut, SC_Pair * pSlewOut )
 {
+    if ( pTime->pFlat )
+    {
+        Scl_LibPinArrivalFlat( pTime, pArrIn, pSlewIn, pLoad, pArrOut, pSlewOut );
+        return;
+    }
     if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
     {
         pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->rise, pLoad->rise) );
@@ -605,6 +729,11 @@ static inline void Scl_LibPinArrival( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pa
 }
 static inline void Scl_LibPinDeparture( SC_Timing * pTime, SC_Pair * pDepIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pDepOut )
 {
+    if ( pTime->pFlat )
+    {
+        Scl_LibPinDepartureFlat( pTime, pDepIn, pSlewIn, pLoad, pDepOut );
+        return;
+    }
     if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
     {
         pDepIn->rise  = Abc_MaxFloat( pDepIn->rise,  pDepOut->rise + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->rise, pLoad->rise) );
@@ -813,10 +942,12 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 
 /*=== sclLiberty.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int fSkipMultiOuts );
+extern SC_Lib *      Abc_SclReadLibertyCache( char * pFileName, char * pCacheDir, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int fSkipMultiOuts );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
 extern SC_Lib *      Abc_SclReadFromFile( char * pFileName );
+extern Vec_Str_t *    Abc_SclWriteToStr( SC_Lib * p );
 extern void          Abc_SclWriteScl( char * pFileName, SC_Lib * p );
 extern void          Abc_SclWriteLiberty( char * pFileName, SC_Lib * p );
 extern SC_Lib *      Abc_SclMergeLibraries( SC_Lib * pLib1, SC_Lib * pLib2, int fUsePrefix );
@@ -830,6 +961,7 @@ extern void          Abc_SclLinkCells( SC_Lib * p );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
 extern void          Abc_SclLibNormalize( SC_Lib * p );
+extern void          Abc_SclLibFlatten( SC_Lib * p );
 extern SC_Cell *     Abc_SclFindInvertor( SC_Lib * p, int fFindBuff );
 extern SC_Cell *     Abc_SclFindSmallestGate( SC_Cell * p, float CinMin );
 extern SC_WireLoad * Abc_SclFindWireLoadModel( SC_Lib * p, float Area );
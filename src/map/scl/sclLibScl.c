@@ -416,6 +416,8 @@ SC_Lib * Abc_SclReadFromStr( Vec_Str_t * vOut )
     // hash gates by name
     Abc_SclHashCells( p );
     Abc_SclLinkCells( p );
+    // derive the flat timing tables
+    Abc_SclLibFlatten( p );
     return p;
 }
 SC_Lib * Abc_SclReadFromFile( char * pFileName )
@@ -633,11 +635,16 @@ static void Abc_SclWriteLibrary( Vec_Str_t * vOut, SC_Lib * p, int nExtra, int f
     Vec_StrPutI( vOut, n_valid_cells + nExtra );
     Abc_SclWriteLibraryCellsOnly( vOut, p, fUsePrefix ? 1 : 0 );
 }
-void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
+Vec_Str_t * Abc_SclWriteToStr( SC_Lib * p )
 {
     Vec_Str_t * vOut;
     vOut = Vec_StrAlloc( 10000 );
     Abc_SclWriteLibrary( vOut, p, 0, 0 );
+    return vOut;
+}
+void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
+{
+    Vec_Str_t * vOut = Abc_SclWriteToStr( p );
     if ( Vec_StrSize(vOut) > 0 )
     {
         FILE * pFile = fopen( pFileName, "wb" );
@@ -792,6 +792,85 @@ void Abc_SclLibNormalize( SC_Lib * p )
             Abc_SclLibNormalizeSurfaceIndex( &pTiming->pFallPower, Time, Load );
         }
     }
+    Abc_SclLibFlatten( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the flat representation of the timing surfaces.]
+
+  Description [For each timing arc whose four surfaces (cell_rise, cell_fall,
+  rise_transition, fall_transition) share the same 2D grid, stores the 
+  slew indexes, the load indexes and the interleaved values of the four 
+  surfaces in one array, which is used by Scl_LibLookupFlat() to evaluate 
+  the arc with one vector operation. The index arrays are padded to 
+  a multiple of four entries. The arcs that do not have this form 
+  (scalar or 1D tables, different grids) are left to Scl_LibLookup().
+  Should be called again after the surfaces are changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SclLibFlattenCheck( SC_Timing * pTiming )
+{
+    SC_Surface * pSurfs[4] = { &pTiming->pCellRise, &pTiming->pCellFall, &pTiming->pRiseTrans, &pTiming->pFallTrans };
+    SC_Surface * p = pSurfs[0];
+    int n0 = Vec_FltSize(&p->vIndex0);
+    int n1 = Vec_FltSize(&p->vIndex1);
+    int i, k;
+    if ( n0 < 2 || n1 < 2 )
+        return 0;
+    for ( i = 0; i < n0-1; i++ )
+        if ( Vec_FltEntry(&p->vIndex0, i) == Vec_FltEntry(&p->vIndex0, i+1) )
+            return 0;
+    for ( i = 0; i < n1-1; i++ )
+        if ( Vec_FltEntry(&p->vIndex1, i) == Vec_FltEntry(&p->vIndex1, i+1) )
+            return 0;
+    for ( k = 0; k < 4; k++ )
+    {
+        if ( !Vec_FltEqual(&pSurfs[k]->vIndex0, &p->vIndex0) || !Vec_FltEqual(&pSurfs[k]->vIndex1, &p->vIndex1) )
+            return 0;
+        if ( Vec_PtrSize(&pSurfs[k]->vData) != n0 )
+            return 0;
+        for ( i = 0; i < n0; i++ )
+            if ( Vec_FltSize((Vec_Flt_t *)Vec_PtrEntry(&pSurfs[k]->vData, i)) != n1 )
+                return 0;
+    }
+    return 1;
+}
+void Abc_SclLibFlatten( SC_Lib * p )
+{
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pTimings;
+    SC_Timing * pTiming;
+    int i, k, m, n, s, l, f;
+    SC_LibForEachCell( p, pCell, i )
+    SC_CellForEachPinOut( pCell, pPin, k )
+    SC_PinForEachRTiming( pPin, pTimings, m )
+    Vec_PtrForEachEntry( SC_Timing *, &pTimings->vTimings, pTiming, n )
+    {
+        SC_Surface * pSurfs[4] = { &pTiming->pCellRise, &pTiming->pCellFall, &pTiming->pRiseTrans, &pTiming->pFallTrans };
+        float * pIndex0, * pIndex1, * pData;
+        ABC_FREE( pTiming->pFlat );
+        pTiming->nFlat0 = pTiming->nFlat1 = 0;
+        if ( !Abc_SclLibFlattenCheck(pTiming) )
+            continue;
+        pTiming->nFlat0 = Vec_FltSize(&pTiming->pCellRise.vIndex0);
+        pTiming->nFlat1 = Vec_FltSize(&pTiming->pCellRise.vIndex1);
+        pTiming->pFlat  = ABC_CALLOC( float, Scl_LibFlatIndexOffset(pTiming->nFlat0) + Scl_LibFlatIndexOffset(pTiming->nFlat1) + 4 * pTiming->nFlat0 * pTiming->nFlat1 );
+        pIndex0 = pTiming->pFlat;
+        pIndex1 = pIndex0 + Scl_LibFlatIndexOffset(pTiming->nFlat0);
+        pData   = pIndex1 + Scl_LibFlatIndexOffset(pTiming->nFlat1);
+        memcpy( pIndex0, Vec_FltArray(&pTiming->pCellRise.vIndex0), sizeof(float) * pTiming->nFlat0 );
+        memcpy( pIndex1, Vec_FltArray(&pTiming->pCellRise.vIndex1), sizeof(float) * pTiming->nFlat1 );
+        for ( s = 0; s < pTiming->nFlat0; s++ )
+        for ( l = 0; l < pTiming->nFlat1; l++ )
+        for ( f = 0; f < 4; f++ )
+            *pData++ = Vec_FltEntry( (Vec_Flt_t *)Vec_PtrEntry(&pSurfs[f]->vData, s), l );
+    }
 }
 
 /**Function*************************************************************
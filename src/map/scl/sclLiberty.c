@@ -1893,6 +1893,119 @@ SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, S
     return pLib;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reads Liberty library through the cache of compiled libraries.]
+
+  Description [The cache is a directory with the binary SCL images of the 
+  libraries parsed earlier. Each image is stored in file "<hash>.scl", where 
+  the hash is computed from the contents of the Liberty file and from the 
+  parsing options (the dont_use list and skipping multi-output cells). 
+  The image is written by Abc_CacheSave() and contains the library in the
+  SCL format.
+  When the image is present, it is memory-mapped and the library is read 
+  from the mapped pages without parsing the Liberty file. Otherwise, the 
+  Liberty file is parsed and the image is added to the cache.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define SCL_CACHE_MAGIC    "SCLC"
+#define SCL_CACHE_VERSION  1
+
+static char * Scl_LibertyCacheName( char * pCacheDir, char * pFileName, SC_DontUse dont_use, int fSkipMultiOuts, word * pHash )
+{
+    char * pContents;
+    long nContents = Scl_LibertyFileSize( pFileName );
+    word Hash = ABC_CACHE_HASH_START;
+    int i, Version = SCL_CACHE_VERSION;
+    if ( nContents == 0 )
+        return NULL;
+    pContents = Scl_LibertyFileContents( pFileName, &nContents );
+    if ( pContents == NULL )
+        return NULL;
+    Hash = Abc_CacheHash( pContents, nContents, Hash );
+    ABC_FREE( pContents );
+    for ( i = 0; i < dont_use.size; i++ )
+        Hash = Abc_CacheHash( dont_use.dont_use_list[i], (ABC_INT64_T)strlen(dont_use.dont_use_list[i]) + 1, Hash );
+    Hash = Abc_CacheHash( (char *)&fSkipMultiOuts, sizeof(int), Hash );
+    Hash = Abc_CacheHash( (char *)&Version, sizeof(int), Hash );
+    *pHash = Hash;
+    return Abc_CacheFileName( pCacheDir, Hash, "scl" );
+}
+static SC_Lib * Scl_LibertyCacheLoad( char * pCacheName, word Hash )
+{
+    SC_Lib * pLib = NULL;
+    Vec_Str_t vOut;
+    char * pContents;
+    ABC_INT64_T nFileSize = 0;
+    pContents = Abc_CacheMap( pCacheName, SCL_CACHE_MAGIC, SCL_CACHE_VERSION, Hash, &nFileSize );
+    if ( pContents == NULL )
+        return NULL;
+    vOut.pArray = pContents + ABC_CACHE_HEADER;
+    vOut.nSize  = vOut.nCap = (int)(nFileSize - ABC_CACHE_HEADER);
+    pLib = Abc_SclReadFromStr( &vOut );
+    Abc_FileUnmap( pContents, nFileSize );
+    return pLib;
+}
+static void Scl_LibertyCacheSave( char * pCacheDir, char * pCacheName, word Hash, Vec_Str_t * vStr )
+{
+    if ( !Abc_CacheSave( pCacheDir, pCacheName, SCL_CACHE_MAGIC, SCL_CACHE_VERSION, Hash, Vec_StrArray(vStr), Vec_StrSize(vStr) ) )
+        printf( "Cannot write library cache \"%s\".\n", pCacheName );
+}
+SC_Lib * Abc_SclReadLibertyCache( char * pFileName, char * pCacheDir, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int fSkipMultiOuts )
+{
+    SC_Lib * pLib;
+    Scl_Tree_t * p;
+    Vec_Str_t * vStr;
+    abctime clk = Abc_Clock();
+    word Hash = 0;
+    char * pCacheName;
+    Scl_LibertyFixFileName( pFileName );
+    pCacheName = Scl_LibertyCacheName( pCacheDir, pFileName, dont_use, fSkipMultiOuts, &Hash );
+    if ( pCacheName == NULL )
+        return NULL;
+    pLib = Scl_LibertyCacheLoad( pCacheName, Hash );
+    if ( pLib )
+    {
+        pLib->pFileName = Abc_UtilStrsav( pFileName );
+        Abc_SclLibNormalize( pLib );
+        if ( fVerbose )
+        {
+            printf( "Library \"%s\" from \"%s\" has %d cells (read from cache \"%s\").  ", pLib->pName, pFileName, SC_LibCellNum(pLib), pCacheName );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        ABC_FREE( pCacheName );
+        return pLib;
+    }
+    // parse the library and add it to the cache
+    p = Scl_LibertyParse( pFileName, fVeryVerbose );
+    if ( p == NULL )
+    {
+        ABC_FREE( pCacheName );
+        return NULL;
+    }
+    vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose, dont_use, fSkipMultiOuts );
+    Scl_LibertyStop( p, fVeryVerbose );
+    if ( vStr == NULL )
+    {
+        ABC_FREE( pCacheName );
+        return NULL;
+    }
+    pLib = Abc_SclReadFromStr( vStr );
+    if ( pLib != NULL )
+    {
+        Scl_LibertyCacheSave( pCacheDir, pCacheName, Hash, vStr );
+        pLib->pFileName = Abc_UtilStrsav( pFileName );
+        Abc_SclLibNormalize( pLib );
+    }
+    Vec_StrFree( vStr );
+    ABC_FREE( pCacheName );
+    return pLib;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Experiments with Liberty parsing.]
@@ -404,8 +404,8 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
         }
         p->nEstNodes++;
     }
-    // get the library cell
-    pCell = Abc_SclObjCell( pObj );
+    // get the library cell (or the cell being tried at this node)
+    pCell = pObj == p->pTryObj ? p->pTryCell : Abc_SclObjCell( pObj );
     // compute for each fanin
     Abc_ObjForEachFanin( pObj, pFanin, k )
     {
@@ -486,6 +486,141 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Evaluates candidate gate sizes on several threads.]
+
+  Description [Each thread owns a private copy of the loads, arrival times
+  and slews. Before evaluating a node, the thread copies the entries of
+  the node's timing cone and the fanins of the cone from the manager, so
+  the manager is only read while the threads run. The cell being tried
+  is kept in the private manager (pTryObj/pTryCell) rather than written
+  into the network. For each node in vObjs, vCones and vEvals give the
+  nodes to recompute and to evaluate, as expected by pFuncEval. The best
+  gate and its gain are returned in vGates and vGains. The result does
+  not depend on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct SC_EvalTask_ SC_EvalTask;
+struct SC_EvalTask_
+{
+    SC_Man *       p;             // the shared manager
+    SC_Man *       pThr;          // the thread-private manager
+    Vec_Int_t *    vObjs;         // the nodes to evaluate
+    Vec_Wec_t *    vCones;        // the nodes to recompute for each node
+    Vec_Wec_t *    vEvals;        // the nodes to evaluate for each node
+    Vec_Int_t *    vGates;        // the best gate of each node
+    Vec_Flt_t *    vGains;        // the best gain of each node
+    int          (*pFuncEval)(SC_Man *, Abc_Obj_t *, Vec_Int_t *, Vec_Int_t *, int, int, float *);
+    int            Notches;
+    int            DelayGap;
+    int            iTask;         // the first node of this task
+    int            nTasks;        // the stride between the nodes
+};
+static SC_Man * Abc_SclManThreadStart( SC_Man * p )
+{
+    SC_Man * pThr = ABC_ALLOC( SC_Man, 1 );
+    *pThr = *p;
+    pThr->pLoads   = ABC_CALLOC( SC_Pair, p->nObjs );
+    pThr->pTimes   = ABC_CALLOC( SC_Pair, p->nObjs );
+    pThr->pSlews   = ABC_CALLOC( SC_Pair, p->nObjs );
+    pThr->vLoads2  = Vec_FltAlloc( 100 );
+    pThr->vLoads3  = Vec_FltAlloc( 100 );
+    pThr->vTimes2  = Vec_FltAlloc( 100 );
+    pThr->vTimes3  = Vec_FltAlloc( 100 );
+    pThr->vThreads = NULL;
+    return pThr;
+}
+static void Abc_SclManThreadSync( SC_Man * pThr, SC_Man * p )
+{
+    SC_Man Temp = *pThr;
+    // take the current parameters of the manager but keep the private storage
+    *pThr = *p;
+    pThr->pLoads   = Temp.pLoads;
+    pThr->pTimes   = Temp.pTimes;
+    pThr->pSlews   = Temp.pSlews;
+    pThr->vLoads2  = Temp.vLoads2;
+    pThr->vLoads3  = Temp.vLoads3;
+    pThr->vTimes2  = Temp.vTimes2;
+    pThr->vTimes3  = Temp.vTimes3;
+    pThr->vThreads = NULL;
+    pThr->pTryObj  = NULL;
+    pThr->pTryCell = NULL;
+}
+static inline void Abc_SclManThreadCopyObj( SC_Man * pThr, SC_Man * p, int iObj )
+{
+    pThr->pLoads[iObj] = p->pLoads[iObj];
+    pThr->pTimes[iObj] = p->pTimes[iObj];
+    pThr->pSlews[iObj] = p->pSlews[iObj];
+}
+static int Abc_SclEvalTask( void * pArg )
+{
+    SC_EvalTask * t = (SC_EvalTask *)pArg;
+    Abc_Obj_t * pObj, * pTemp, * pFanin;
+    Vec_Int_t * vCone, * vEvals;
+    float dGain;
+    int i, k, j, Gate;
+    for ( i = t->iTask; i < Vec_IntSize(t->vObjs); i += t->nTasks )
+    {
+        pObj   = Abc_NtkObj( t->p->pNtk, Vec_IntEntry(t->vObjs, i) );
+        vCone  = Vec_WecEntry( t->vCones, i );
+        vEvals = Vec_WecEntry( t->vEvals, i );
+        // bring the timing of the cone and its fanins into the private copy
+        Abc_NtkForEachObjVec( vCone, t->p->pNtk, pTemp, k )
+        {
+            Abc_SclManThreadCopyObj( t->pThr, t->p, Abc_ObjId(pTemp) );
+            Abc_ObjForEachFanin( pTemp, pFanin, j )
+                Abc_SclManThreadCopyObj( t->pThr, t->p, Abc_ObjId(pFanin) );
+        }
+        Gate = t->pFuncEval( t->pThr, pObj, vCone, vEvals, t->Notches, t->DelayGap, &dGain );
+        Vec_IntWriteEntry( t->vGates, i, Gate );
+        Vec_FltWriteEntry( t->vGains, i, dGain );
+    }
+    return 1;
+}
+void Abc_SclEvalCandidates( SC_Man * p, Vec_Int_t * vObjs, Vec_Wec_t * vCones, Vec_Wec_t * vEvals, int (*pFuncEval)(SC_Man *, Abc_Obj_t *, Vec_Int_t *, Vec_Int_t *, int, int, float *), int Notches, int DelayGap, int nProcs, Vec_Int_t * vGates, Vec_Flt_t * vGains )
+{
+    Util_PoolGroup_t * pGroup;
+    SC_EvalTask * pTasks;
+    int i, nTasks = Abc_MinInt( nProcs, Vec_IntSize(vObjs) );
+    assert( p->pFuncFanin == NULL );
+    Vec_IntFill( vGates, Vec_IntSize(vObjs), -1 );
+    Vec_FltFill( vGains, Vec_IntSize(vObjs), 0 );
+    if ( nTasks == 0 )
+        return;
+    if ( p->vThreads == NULL )
+        p->vThreads = Vec_PtrAlloc( nProcs );
+    while ( Vec_PtrSize(p->vThreads) < nTasks )
+        Vec_PtrPush( p->vThreads, Abc_SclManThreadStart(p) );
+    pTasks = ABC_CALLOC( SC_EvalTask, nTasks );
+    for ( i = 0; i < nTasks; i++ )
+    {
+        pTasks[i].p         = p;
+        pTasks[i].pThr      = (SC_Man *)Vec_PtrEntry( p->vThreads, i );
+        pTasks[i].vObjs     = vObjs;
+        pTasks[i].vCones    = vCones;
+        pTasks[i].vEvals    = vEvals;
+        pTasks[i].vGates    = vGates;
+        pTasks[i].vGains    = vGains;
+        pTasks[i].pFuncEval = pFuncEval;
+        pTasks[i].Notches   = Notches;
+        pTasks[i].DelayGap  = DelayGap;
+        pTasks[i].iTask     = i;
+        pTasks[i].nTasks    = nTasks;
+        Abc_SclManThreadSync( pTasks[i].pThr, p );
+    }
+    pGroup = Util_PoolGroupStart( nTasks, 0 );
+    for ( i = 0; i < nTasks; i++ )
+        Util_PoolGroupAdd( pGroup, Abc_SclEvalTask, pTasks + i );
+    Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
+    ABC_FREE( pTasks );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Incremental timing update.]
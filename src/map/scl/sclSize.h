@@ -83,6 +83,10 @@ struct SC_Man_
     Vec_Wec_t *    vLevels;
     Vec_Int_t *    vChanged; 
     int            nIncUpdates;
+    // parallel evaluation of gate sizes
+    Abc_Obj_t *    pTryObj;       // the node whose cell is being tried
+    SC_Cell *      pTryCell;      // the cell tried at this node
+    Vec_Ptr_t *    vThreads;      // thread-private timing managers
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
@@ -249,10 +253,30 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
         pObj->iData = i;
     return p;
 }
+static inline void Abc_SclManFreeThreads( SC_Man * p )
+{
+    SC_Man * pThr;
+    int i;
+    if ( p->vThreads == NULL )
+        return;
+    Vec_PtrForEachEntry( SC_Man *, p->vThreads, pThr, i )
+    {
+        Vec_FltFreeP( &pThr->vLoads2 );
+        Vec_FltFreeP( &pThr->vLoads3 );
+        Vec_FltFreeP( &pThr->vTimes2 );
+        Vec_FltFreeP( &pThr->vTimes3 );
+        ABC_FREE( pThr->pLoads );
+        ABC_FREE( pThr->pTimes );
+        ABC_FREE( pThr->pSlews );
+        ABC_FREE( pThr );
+    }
+    Vec_PtrFreeP( &p->vThreads );
+}
 static inline void Abc_SclManFree( SC_Man * p )
 {
     Abc_Obj_t * pObj;
     int i;
+    Abc_SclManFreeThreads( p );
     // set CI/CO ids
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         pObj->iData = 0;
@@ -629,6 +653,7 @@ extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc
 extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath );
 extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
+extern void          Abc_SclEvalCandidates( SC_Man * p, Vec_Int_t * vObjs, Vec_Wec_t * vCones, Vec_Wec_t * vEvals, int (*pFuncEval)(SC_Man *, Abc_Obj_t *, Vec_Int_t *, Vec_Int_t *, int, int, float *), int Notches, int DelayGap, int nProcs, Vec_Int_t * vGates, Vec_Flt_t * vGains );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
@@ -638,6 +663,7 @@ extern void          Abc_SclPowerPerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int n
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
 /*=== sclUpsize.c ===============================================================*/
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
+extern int           Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec_Int_t * vEvals, int Notches, int DelayGap, float * pGainBest );
 extern void          Abc_SclUpsizePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars, void * pFuncFanin );
 /*=== sclUtil.c ===============================================================*/
 extern void          Abc_SclMioGates2SclGates( SC_Lib * pLib, Abc_Ntk_t * p );
@@ -263,9 +263,10 @@ void Abc_SclFindNodesToUpdate( Abc_Obj_t * pPivot, Vec_Int_t ** pvNodes, Vec_Int
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Finds the best cell of the node.]
 
-  Description []
+  Description [The cells are tried without changing the network, so the
+  procedure can be called with a thread-private manager.]
                
   SideEffects []
 
@@ -291,13 +292,14 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
             continue;
         if ( k > Notches )
             break;
-        // set new cell
-        Abc_SclObjSetCell( pObj, pCellNew );
+        // try new cell
+        p->pTryObj  = pObj;
+        p->pTryCell = pCellNew;
         Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
         // recompute timing
         Abc_SclTimeCone( p, vRecalcs );
         // set old cell
-        Abc_SclObjSetCell( pObj, pCellOld );
+        p->pTryObj  = NULL;
         Abc_SclLoadRestore( p, pObj );
         // save best gain
         dGain = Abc_SclEvalPerform( p, vEvals );
@@ -315,8 +317,7 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
     }
 //    printf( "Best = %.2f   ", dGainBest );
 //    printf( "\n" );
-    // put back old cell and timing
-    Abc_SclObjSetCell( pObj, pCellOld );
+    // put back old timing
     Abc_SclConeRestore( p, vRecalcs );
     *pGainBest = dGainBest;
     return gateBest;
@@ -593,7 +594,7 @@ void Abc_SclObjMarkFanFans( Abc_Obj_t * pObj, Vec_Ptr_t * vNodes )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf )
+int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf, int nProcs )
 {
     SC_Cell * pCellOld, * pCellNew;
     Vec_Int_t * vRecalcs, * vEvals;
@@ -606,6 +607,44 @@ int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notch
     vRecalcs = Vec_IntAlloc( 100 );
     vEvals = Vec_IntAlloc( 100 );
     Vec_QueClear( p->vNodeByGain );
+    if ( nProcs > 1 && p->pFuncFanin == NULL )
+    {
+        // collect the windows first because they are found using the node marks
+        Vec_Int_t * vObjs  = Vec_IntAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Wec_t * vCones = Vec_WecAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Wec_t * vEvals2 = Vec_WecAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Int_t * vGates = Vec_IntAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Flt_t * vGains = Vec_FltAlloc( Vec_IntSize(vPathNodes) );
+        Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
+        {
+            assert( pObj->fMarkB == 0 );
+            iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
+            if ( iIterLast >= 0 && iIterLast + 5 > iIter )
+                continue;
+            Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
+            Vec_IntPush( vObjs, Abc_ObjId(pObj) );
+            Vec_IntAppend( Vec_WecPushLevel(vCones), vRecalcs );
+            Vec_IntAppend( Vec_WecPushLevel(vEvals2), vEvals );
+        }
+        // evaluate the nodes in parallel and remember savings in the original order
+        Abc_SclEvalCandidates( p, vObjs, vCones, vEvals2, Abc_SclFindBestCell, Notches, DelayGap, nProcs, vGates, vGains );
+        Abc_NtkForEachObjVec( vObjs, p->pNtk, pObj, i )
+        {
+            gateBest = Vec_IntEntry( vGates, i );
+            if ( gateBest < 0 )
+                continue;
+            assert( Vec_FltEntry(vGains, i) > 0.0 );
+            Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), Vec_FltEntry(vGains, i) );
+            Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), gateBest );
+            Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
+        }
+        Vec_IntFree( vObjs );
+        Vec_WecFree( vCones );
+        Vec_WecFree( vEvals2 );
+        Vec_IntFree( vGates );
+        Vec_FltFree( vGains );
+    }
+    else
     Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
     {
         assert( pObj->fMarkB == 0 );
@@ -883,7 +922,8 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         printf( "UseWL =%2d. ",           pPars->fUseWireLoads );
         printf( "Target =%5d ps. ",       pPars->DelayUser );
         printf( "DelayGap =%3d ps. ",     pPars->DelayGap );
-        printf( "Timeout =%4d sec",       pPars->TimeOut  );
+        printf( "Timeout =%4d sec. ",     pPars->TimeOut  );
+        printf( "Threads =%3d",           pPars->nProcs   );
         printf( "\n" );
     }
     // increase window for larger networks
@@ -916,7 +956,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             if ( pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0 )
                 nUpsizes = Abc_SclFindBypasses( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, pPars->fVeryVerbose );
             else
-                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0) );
+                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0), pPars->nProcs );
             p->timeSize += Abc_Clock() - clk;
 
             // unmark critical path
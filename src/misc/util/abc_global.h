@@ -394,6 +394,19 @@ extern int Gia_ManToBridgeAbsNetlist( FILE * pFile, void * p, int pkg_type );
 extern char * vnsprintf(const char* format, va_list args);
 extern char * nsprintf(const char* format, ...);
 
+// memory-mapped files
+extern char * Abc_FileMap( char * pFileName, ABC_INT64_T * pnFileSize );
+extern void   Abc_FileUnmap( char * pContents, ABC_INT64_T nFileSize );
+extern ABC_INT64_T Abc_FileSize64( char * pFileName );
+
+// cache of binary images
+#define ABC_CACHE_HEADER       20
+#define ABC_CACHE_HASH_START   ABC_CONST(0xCBF29CE484222325)
+extern word   Abc_CacheHash( char * pData, ABC_INT64_T nData, word Hash );
+extern char * Abc_CacheFileName( char * pCacheDir, word Hash, char * pExt );
+extern char * Abc_CacheMap( char * pCacheName, char * pMagic, int Version, word Hash, ABC_INT64_T * pnFileSize );
+extern int    Abc_CacheSave( char * pCacheDir, char * pCacheName, char * pMagic, int Version, word Hash, char * pData, int nData );
+
 static inline void Abc_Print( int level, const char * format, ... )
 {
     extern ABC_DLL int Abc_FrameIsBridgeMode();
@@ -556,7 +569,18 @@ extern unsigned Abc_Random( int fReset );
 extern word     Abc_RandomW( int fReset );
 
 // pthreads
-extern void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
+extern int  Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
+typedef struct Util_PoolGroup_t_ Util_PoolGroup_t;
+extern Util_PoolGroup_t * Util_PoolGroupStart( int nProcs, int TimeOut );
+extern Util_PoolGroup_t * Util_PoolGroupStartThreads( int TimeOut );
+extern void Util_PoolGroupAdd( Util_PoolGroup_t * p, int (*pFunc)(void *), void * pData );
+extern int  Util_PoolGroupWait( Util_PoolGroup_t * p );
+extern void Util_PoolGroupCancel( Util_PoolGroup_t * p );
+extern int  Util_PoolGroupIsCanceled( Util_PoolGroup_t * p );
+extern void Util_PoolGroupStop( Util_PoolGroup_t * p );
+extern void Util_PoolSetThreadMax( int nThreads );
+extern int  Util_PoolThreadMax();
+extern void Util_PoolStop();
 
 ABC_NAMESPACE_HEADER_END
 
@@ -46,11 +46,14 @@
 #include <windows.h>
 #include <process.h>
 #include <io.h>
+#include <direct.h>
 #else
 #include <unistd.h>
+#include <sys/mman.h>
 #endif
 
 #include "abc_global.h"
+#include "utilSignal.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -240,6 +243,166 @@ char* nsprintf(const char* format, ...)
     return ret;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [The mapping is private and writable, so the reader can 
+  patch the buffer in place (for example, when terminating signal names)
+  without affecting the file; only the touched pages are copied. 
+  Returns NULL if the file cannot be mapped, in which case the caller 
+  should fall back on reading the file into a heap buffer.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Abc_FileMap( char * pFileName, ABC_INT64_T * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    void * pContents;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size == 0 || (ABC_INT64_T)Stat.st_size != (ABC_INT64_T)(size_t)Stat.st_size )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    *pnFileSize = (ABC_INT64_T)Stat.st_size;
+    return (char *)pContents;
+#else
+    return NULL;
+#endif
+}
+void Abc_FileUnmap( char * pContents, ABC_INT64_T nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, (size_t)nFileSize );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the 64-bit size of the file.]
+
+  Description [Returns -1 if the file does not exist.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+ABC_INT64_T Abc_FileSize64( char * pFileName )
+{
+#if defined(_MSC_VER)
+    struct _stati64 Stat;
+    if ( _stati64( pFileName, &Stat ) == -1 )
+        return -1;
+#else
+    struct stat Stat;
+    if ( stat( pFileName, &Stat ) == -1 )
+        return -1;
+#endif
+    return (ABC_INT64_T)Stat.st_size;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cache of binary images.]
+
+  Description [The cache is a directory with the binary images derived
+  earlier (for example, the compiled libraries). Each image is stored in
+  file "<hash>.<ext>", where the hash is computed by the caller using
+  Abc_CacheHash(), starting from ABC_CACHE_HASH_START. The image starts
+  with the header (4-byte magic string, 4-byte version, 8-byte hash,
+  4-byte size), followed by the data.
+  Abc_CacheMap() returns the memory-mapped image if its header matches,
+  or NULL otherwise; the caller reads the data starting at offset
+  ABC_CACHE_HEADER and unmaps the image with Abc_FileUnmap().
+  Abc_CacheSave() writes the image into a temporary file and renames it,
+  so that concurrent readers never see a partial image. Returns 1 on
+  success.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Abc_CacheHash( char * pData, ABC_INT64_T nData, word Hash )
+{
+    ABC_INT64_T i;
+    for ( i = 0; i < nData; i++ )
+        Hash = (Hash ^ (unsigned char)pData[i]) * ABC_CONST(0x100000001B3);
+    return Hash;
+}
+char * Abc_CacheFileName( char * pCacheDir, word Hash, char * pExt )
+{
+    char * pName = ABC_ALLOC( char, strlen(pCacheDir) + strlen(pExt) + 20 );
+    sprintf( pName, "%s/%08x%08x.%s", pCacheDir, (unsigned)(Hash >> 32), (unsigned)Hash, pExt );
+    return pName;
+}
+char * Abc_CacheMap( char * pCacheName, char * pMagic, int Version, word Hash, ABC_INT64_T * pnFileSize )
+{
+    ABC_INT64_T nFileSize = 0;
+    char * pContents = Abc_FileMap( pCacheName, &nFileSize );
+    if ( pContents == NULL )
+        return NULL;
+    if ( nFileSize < ABC_CACHE_HEADER || strncmp(pContents, pMagic, 4) || *(int *)(pContents + 4) != Version || 
+         *(word *)(pContents + 8) != Hash || *(int *)(pContents + 16) != nFileSize - ABC_CACHE_HEADER )
+    {
+        Abc_FileUnmap( pContents, nFileSize );
+        return NULL;
+    }
+    *pnFileSize = nFileSize;
+    return pContents;
+}
+int Abc_CacheSave( char * pCacheDir, char * pCacheName, char * pMagic, int Version, word Hash, char * pData, int nData )
+{
+    char * pTemp = NULL;
+    FILE * pFile;
+    int fd, RetValue = 1;
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    _mkdir( pCacheDir );
+#else
+    mkdir( pCacheDir, 0755 );
+#endif
+    fd = Util_SignalTmpFile( pCacheName, ".tmp", &pTemp );
+    if ( fd == -1 || (pFile = fdopen(fd, "wb")) == NULL )
+    {
+        ABC_FREE( pTemp );
+        return 0;
+    }
+    RetValue &= fwrite( pMagic, 1, 4, pFile ) == 4;
+    RetValue &= fwrite( &Version, 4, 1, pFile ) == 1;
+    RetValue &= fwrite( &Hash, 8, 1, pFile ) == 1;
+    RetValue &= fwrite( &nData, 4, 1, pFile ) == 1;
+    RetValue &= fwrite( pData, 1, nData, pFile ) == (size_t)nData;
+    RetValue &= fclose( pFile ) == 0;
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    if ( RetValue )
+        remove( pCacheName );
+#else
+    chmod( pTemp, 0644 );
+#endif
+    if ( !RetValue || rename( pTemp, pCacheName ) )
+    {
+        remove( pTemp );
+        RetValue = 0;
+    }
+    ABC_FREE( pTemp );
+    return RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -23,22 +23,6 @@
 #include <stdlib.h>
 #include <assert.h>
 
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include <windows.h>
-#include <time.h>
-// nanosleep implementation for Windows
-static inline int nanosleep(const struct timespec *req, struct timespec *rem) {
-    LARGE_INTEGER li;
-    li.QuadPart = -((LONGLONG)req->tv_sec * 10000000 + req->tv_nsec / 100);
-    HANDLE timer = CreateWaitableTimer(NULL, TRUE, NULL);
-    if (!timer) return -1;
-    SetWaitableTimer(timer, &li, 0, NULL, NULL, 0);
-    WaitForSingleObject(timer, INFINITE);
-    CloseHandle(timer);
-    return 0;
-}
-#endif
-
 #ifdef ABC_USE_PTHREADS
 
 #if defined(_WIN32) && !defined(__MINGW32__)
@@ -47,30 +31,6 @@ static inline int nanosleep(const struct timespec *req, struct timespec *rem) {
 #include <pthread.h>
 #endif
 
-#ifdef __cplusplus
-#include <atomic>
-using namespace std;
-#else
-#ifndef _WIN32
-#include <stdatomic.h>
-#else
-// MSVC doesn't have stdatomic.h, use Interlocked functions instead
-#define atomic_bool volatile LONG
-#define atomic_int volatile LONG
-#define atomic_store(obj, val) InterlockedExchange((LONG*)obj, val)
-#define atomic_load(obj) (*(volatile LONG*)obj)
-#define atomic_compare_exchange_strong(obj, expected, desired) \
-    (InterlockedCompareExchange((LONG*)obj, desired, *expected) == *expected ? \
-     (*expected = desired, 1) : (*expected = *(volatile LONG*)obj, 0))
-#define atomic_store_explicit(obj, val, order) InterlockedExchange((LONG*)obj, val)
-#define atomic_load_explicit(obj, order) (*(volatile LONG*)obj)
-#define memory_order_acquire 0
-#define memory_order_release 0
-#define memory_order_seq_cst 0
-#endif
-#include <stdbool.h>
-#endif
-
 #endif
 
 #include "misc/vec/vec.h"
@@ -81,139 +41,452 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define PAR_THR_MAX 100
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+#ifndef ABC_USE_PTHREADS
+
+// without pthreads, the tasks are performed by the thread adding them
+struct Util_PoolGroup_t_
+{
+    int          fCanceled;   // the group is canceled
+    abctime      Deadline;    // the time when the group expires (0 = no limit)
+    int          nSkipped;    // the number of tasks skipped
+};
+
+void Util_PoolSetThreadMax( int nThreads )   {}
+int  Util_PoolThreadMax()                    { return 1; }
+void Util_PoolStop()                         {}
+
+Util_PoolGroup_t * Util_PoolGroupStart( int nProcs, int TimeOut )
+{
+    Util_PoolGroup_t * p = ABC_CALLOC( Util_PoolGroup_t, 1 );
+    p->Deadline = TimeOut > 0 ? Abc_Clock() + (abctime)TimeOut * CLOCKS_PER_SEC : 0;
+    return p;
+}
+Util_PoolGroup_t * Util_PoolGroupStartThreads( int TimeOut )
+{
+    return Util_PoolGroupStart( 1, TimeOut );
+}
+void Util_PoolGroupAdd( Util_PoolGroup_t * p, int (*pFunc)(void *), void * pData )
+{
+    if ( Util_PoolGroupIsCanceled(p) )
+        p->nSkipped++;
+    else
+        pFunc( pData );
+}
+int  Util_PoolGroupWait( Util_PoolGroup_t * p )      { return p->nSkipped;  }
+void Util_PoolGroupCancel( Util_PoolGroup_t * p )    { p->fCanceled = 1;    }
+int  Util_PoolGroupIsCanceled( Util_PoolGroup_t * p ){ return p->fCanceled || (p->Deadline && Abc_Clock() > p->Deadline); }
+void Util_PoolGroupStop( Util_PoolGroup_t * p )      { ABC_FREE( p );       }
+
+#else // pthreads are used
+
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Process-wide pool of worker threads.]
+
+  Description [The pool is started on demand and grows up to the largest
+  number of threads requested by the task groups, but never above the
+  limit set by Util_PoolSetThreadMax(). Each worker owns a deque of tasks.
+  The tasks added by a worker go to its own deque, while the tasks added
+  by other threads are distributed among the deques. A worker takes the
+  most recent task from its own deque and, when its deque is empty,
+  steals the oldest task from the deque of another worker. Idle workers
+  sleep on a condition variable rather than polling.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-
-#ifndef ABC_USE_PTHREADS
-
-void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
+typedef struct Util_PoolTask_t_ Util_PoolTask_t;
+struct Util_PoolTask_t_
+{
+    int       (*pFunc)(void *);  // the user function
+    void *      pData;           // the user data
+    Util_PoolGroup_t * pGroup;   // the group of this task
+};
+typedef struct Util_PoolDeque_t_ Util_PoolDeque_t;
+struct Util_PoolDeque_t_
+{
+    Util_PoolTask_t * pTasks;    // the circular buffer of tasks
+    int          nCap;           // the buffer size
+    int          iHead;          // the oldest task
+    int          nSize;          // the number of tasks
+};
+struct Util_PoolGroup_t_
 {
-    void * pData; int i;
-    Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
-        pUserFunc( pData );
+    int          nPending;       // the number of tasks added but not finished
+    int          nSkipped;       // the number of tasks skipped
+    int          fCanceled;      // the group is canceled
+    abctime      Deadline;       // the time when the group expires (0 = no limit)
+    pthread_cond_t Done;         // signaled when the last task is finished or a task is added
+    Vec_Ptr_t *  vThreads;       // the threads of the tasks (NULL if the tasks run in the pool)
+};
+typedef struct Util_PoolThread_t_ Util_PoolThread_t;
+struct Util_PoolThread_t_
+{
+    Util_PoolTask_t Task;        // the task of this thread
+    pthread_t    Thread;         // the thread
+};
+typedef struct Util_Pool_t_ Util_Pool_t;
+struct Util_Pool_t_
+{
+    pthread_mutex_t Mutex;       // protects everything below
+    pthread_cond_t  Work;        // signaled when tasks are added
+    int          fStarted;       // the condition variable is initialized
+    int          fStop;          // the workers should quit
+    int          nThreads;       // the number of workers
+    int          nThreadsMax;    // the largest number of workers
+    int          nTasks;         // the number of queued tasks
+    int          iNext;          // the next deque to receive a task
+    pthread_t    Threads[PAR_THR_MAX];
+    Util_PoolDeque_t Deques[PAR_THR_MAX];
+};
+static Util_Pool_t s_Pool = { PTHREAD_MUTEX_INITIALIZER };
+
+static int Util_PoolWorkerId()
+{
+    pthread_t Self = pthread_self();
+    int i;
+    for ( i = 0; i < s_Pool.nThreads; i++ )
+        if ( pthread_equal( s_Pool.Threads[i], Self ) )
+            return i;
+    return -1;
 }
-
-#else // pthreads are used
-
-#define PAR_THR_MAX 100
-typedef struct Util_ThData_t_
+static void Util_PoolDequePush( Util_PoolDeque_t * p, Util_PoolTask_t * pTask )
 {
-    void *       pUserData;
-    int        (*pUserFunc)(void *);
-    int          iThread;
-    int          nTimeOut;
-    atomic_bool  fWorking;
-} Util_ThData_t;
-
-void * Util_Thread( void * pArg )
+    if ( p->nSize == p->nCap )
+    {
+        int i, nCapNew = p->nCap ? 2 * p->nCap : 16;
+        Util_PoolTask_t * pTasks = ABC_ALLOC( Util_PoolTask_t, nCapNew );
+        for ( i = 0; i < p->nSize; i++ )
+            pTasks[i] = p->pTasks[(p->iHead + i) % p->nCap];
+        ABC_FREE( p->pTasks );
+        p->pTasks = pTasks;
+        p->nCap   = nCapNew;
+        p->iHead  = 0;
+    }
+    p->pTasks[(p->iHead + p->nSize++) % p->nCap] = *pTask;
+}
+static Util_PoolTask_t Util_PoolDequePopTail( Util_PoolDeque_t * p )
 {
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
-
-    Util_ThData_t * pThData = (Util_ThData_t *)pArg;
-    while ( 1 )
+    assert( p->nSize > 0 );
+    return p->pTasks[(p->iHead + --p->nSize) % p->nCap];
+}
+static Util_PoolTask_t Util_PoolDequePopHead( Util_PoolDeque_t * p )
+{
+    Util_PoolTask_t Task;
+    assert( p->nSize > 0 );
+    Task = p->pTasks[p->iHead];
+    p->iHead = (p->iHead + 1) % p->nCap;
+    p->nSize--;
+    return Task;
+}
+// takes the task for the given worker (or for a non-worker thread if iWorker is -1)
+static Util_PoolTask_t Util_PoolTake( int iWorker )
+{
+    int k, nDeques = Abc_MaxInt( s_Pool.nThreads, 1 );
+    assert( s_Pool.nTasks > 0 );
+    s_Pool.nTasks--;
+    if ( iWorker >= 0 && s_Pool.Deques[iWorker].nSize > 0 )
+        return Util_PoolDequePopTail( s_Pool.Deques + iWorker );
+    for ( k = 1; k <= nDeques; k++ )
+    {
+        Util_PoolDeque_t * pDeque = s_Pool.Deques + (Abc_MaxInt(iWorker, 0) + k) % nDeques;
+        if ( pDeque->nSize > 0 )
+            return Util_PoolDequePopHead( pDeque );
+    }
+    assert( 0 );
+    return s_Pool.Deques[0].pTasks[0];
+}
+// takes the most recent queued task of the given group (returns 0 if there is none)
+static int Util_PoolTakeGroup( Util_PoolGroup_t * pGroup, Util_PoolTask_t * pTask )
+{
+    Util_PoolDeque_t * pDeque;
+    int i, k, n;
+    for ( i = 0; i < s_Pool.nThreads; i++ )
     {
-        while ( !atomic_load_explicit((atomic_bool *)&pThData->fWorking, memory_order_acquire) )
-            nanosleep(&pause_duration, NULL);
-        if ( pThData->pUserData == NULL )
+        pDeque = s_Pool.Deques + i;
+        for ( k = pDeque->nSize - 1; k >= 0; k-- )
         {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
+            if ( pDeque->pTasks[(pDeque->iHead + k) % pDeque->nCap].pGroup != pGroup )
+                continue;
+            *pTask = pDeque->pTasks[(pDeque->iHead + k) % pDeque->nCap];
+            for ( n = k + 1; n < pDeque->nSize; n++ )
+                pDeque->pTasks[(pDeque->iHead + n - 1) % pDeque->nCap] = pDeque->pTasks[(pDeque->iHead + n) % pDeque->nCap];
+            pDeque->nSize--;
+            s_Pool.nTasks--;
+            return 1;
         }
-        pThData->pUserFunc( pThData->pUserData );
-        atomic_store_explicit(&pThData->fWorking, false, memory_order_release);
     }
-    assert( 0 );
+    return 0;
+}
+// runs the task with the mutex released
+static void Util_PoolRun( Util_PoolTask_t * pTask )
+{
+    Util_PoolGroup_t * pGroup = pTask->pGroup;
+    int fSkip = pGroup->fCanceled || (pGroup->Deadline && Abc_Clock() > pGroup->Deadline);
+    pthread_mutex_unlock( &s_Pool.Mutex );
+    if ( !fSkip )
+        pTask->pFunc( pTask->pData );
+    pthread_mutex_lock( &s_Pool.Mutex );
+    pGroup->nSkipped += fSkip;
+    if ( --pGroup->nPending == 0 )
+        pthread_cond_broadcast( &pGroup->Done );
+}
+static void * Util_PoolWorker( void * pArg )
+{
+    int iWorker = (int)(ABC_PTRINT_T)pArg;
+    Util_PoolTask_t Task;
+    pthread_mutex_lock( &s_Pool.Mutex );
+    while ( 1 )
+    {
+        while ( !s_Pool.fStop && s_Pool.nTasks == 0 )
+            pthread_cond_wait( &s_Pool.Work, &s_Pool.Mutex );
+        if ( s_Pool.fStop )
+            break;
+        Task = Util_PoolTake( iWorker );
+        Util_PoolRun( &Task );
+    }
+    pthread_mutex_unlock( &s_Pool.Mutex );
     return NULL;
 }
-
-void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
+// runs the task of a group with its own threads
+static void * Util_PoolThread( void * pArg )
 {
-    //abctime clkStart = Abc_Clock();
-    Util_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
-    Vec_Ptr_t * vStack = NULL;
-    int i, status;
-    fflush( stdout );
-    if ( nProcs <= 2 ) {
-        void * pData; int i;
-        Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
-            pUserFunc( pData );
-        return;
+    Util_PoolThread_t * pThread = (Util_PoolThread_t *)pArg;
+    pthread_mutex_lock( &s_Pool.Mutex );
+    Util_PoolRun( &pThread->Task );
+    pthread_mutex_unlock( &s_Pool.Mutex );
+    return NULL;
+}
+// makes sure there are enough workers (the mutex should be locked)
+static void Util_PoolReserve( int nThreads )
+{
+    int status;
+    if ( !s_Pool.fStarted )
+    {
+        pthread_cond_init( &s_Pool.Work, NULL );
+        if ( s_Pool.nThreadsMax == 0 )
+            s_Pool.nThreadsMax = PAR_THR_MAX;
+        s_Pool.fStarted = 1;
     }
-    // subtract manager thread
-    nProcs--;
-    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
+    nThreads = Abc_MinInt( nThreads, s_Pool.nThreadsMax );
+    while ( s_Pool.nThreads < nThreads )
     {
-        ThData[i].pUserData = NULL;
-        ThData[i].pUserFunc = pUserFunc;
-        ThData[i].iThread   = i;
-        ThData[i].nTimeOut  = TimeOut;
-        atomic_store_explicit(&ThData[i].fWorking, false, memory_order_release);
-        status = pthread_create( WorkerThread + i, NULL, Util_Thread, (void *)(ThData + i) );  assert( status == 0 );
+        status = pthread_create( s_Pool.Threads + s_Pool.nThreads, NULL, Util_PoolWorker, (void *)(ABC_PTRINT_T)s_Pool.nThreads );
+        assert( status == 0 );
+        s_Pool.nThreads++;
     }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the largest number of worker threads in the process.]
+
+  Description [The workers that are already running are not stopped.
+  A non-positive number restores the default limit. The limit is set
+  by the command "set maxthreads <num>".]
+
+  SideEffects []
 
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
+  SeeAlso     []
 
-    // look at the threads
-    vStack = Vec_PtrDup( (Vec_Ptr_t *)vData );
-    while ( Vec_PtrSize(vStack) > 0 )
+***********************************************************************/
+void Util_PoolSetThreadMax( int nThreads )
+{
+    pthread_mutex_lock( &s_Pool.Mutex );
+    s_Pool.nThreadsMax = nThreads > 0 ? Abc_MinInt(nThreads, PAR_THR_MAX) : PAR_THR_MAX;
+    pthread_mutex_unlock( &s_Pool.Mutex );
+}
+int Util_PoolThreadMax()
+{
+    return s_Pool.nThreadsMax ? s_Pool.nThreadsMax : PAR_THR_MAX;
+}
+void Util_PoolStop()
+{
+    int i, nThreads;
+    pthread_mutex_lock( &s_Pool.Mutex );
+    if ( !s_Pool.fStarted )
     {
-        for ( i = 0; i < nProcs; i++ )
-        {
-            if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-                continue;
-            ThData[i].pUserData = Vec_PtrPop( vStack );
-            atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
-            break;
-        }
+        pthread_mutex_unlock( &s_Pool.Mutex );
+        return;
+    }
+    s_Pool.fStop = 1;
+    pthread_cond_broadcast( &s_Pool.Work );
+    nThreads = s_Pool.nThreads;
+    pthread_mutex_unlock( &s_Pool.Mutex );
+    for ( i = 0; i < nThreads; i++ )
+        pthread_join( s_Pool.Threads[i], NULL );
+    for ( i = 0; i < nThreads; i++ )
+        ABC_FREE( s_Pool.Deques[i].pTasks );
+    pthread_cond_destroy( &s_Pool.Work );
+    memset( s_Pool.Deques, 0, sizeof(s_Pool.Deques) );
+    s_Pool.fStarted = s_Pool.fStop = s_Pool.nThreads = s_Pool.nTasks = s_Pool.iNext = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Task groups.]
+
+  Description [A group collects the tasks whose completion is awaited
+  together. The pool is extended to (nProcs - 1) workers, because the
+  thread waiting for the group also performs the tasks of this group
+  (but not those of other groups). If TimeOut (in seconds) is positive,
+  the tasks not started before the time is over are skipped. Canceling
+  the group skips the tasks not yet started; the running tasks can poll
+  Util_PoolGroupIsCanceled() to quit early. The tasks of a group started
+  by Util_PoolGroupStartThreads() run on their own threads rather than
+  in the pool, so they are not limited by "set maxthreads" and they run
+  concurrently with each other and with the caller. This is needed for
+  the engines that run in the background or wait for each other.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_PoolGroup_t * Util_PoolGroupStart( int nProcs, int TimeOut )
+{
+    Util_PoolGroup_t * p = ABC_CALLOC( Util_PoolGroup_t, 1 );
+    p->Deadline = TimeOut > 0 ? Abc_Clock() + (abctime)TimeOut * CLOCKS_PER_SEC : 0;
+    pthread_cond_init( &p->Done, NULL );
+    pthread_mutex_lock( &s_Pool.Mutex );
+    Util_PoolReserve( Abc_MaxInt(nProcs - 1, 1) );
+    pthread_mutex_unlock( &s_Pool.Mutex );
+    return p;
+}
+Util_PoolGroup_t * Util_PoolGroupStartThreads( int TimeOut )
+{
+    Util_PoolGroup_t * p = ABC_CALLOC( Util_PoolGroup_t, 1 );
+    p->Deadline = TimeOut > 0 ? Abc_Clock() + (abctime)TimeOut * CLOCKS_PER_SEC : 0;
+    p->vThreads = Vec_PtrAlloc( 4 );
+    pthread_cond_init( &p->Done, NULL );
+    return p;
+}
+void Util_PoolGroupAdd( Util_PoolGroup_t * p, int (*pFunc)(void *), void * pData )
+{
+    Util_PoolTask_t Task = { pFunc, pData, p };
+    int iWorker, status;
+    if ( p->vThreads )
+    {
+        Util_PoolThread_t * pThread = ABC_CALLOC( Util_PoolThread_t, 1 );
+        pThread->Task = Task;
+        pthread_mutex_lock( &s_Pool.Mutex );
+        p->nPending++;
+        Vec_PtrPush( p->vThreads, pThread );
+        pthread_mutex_unlock( &s_Pool.Mutex );
+        status = pthread_create( &pThread->Thread, NULL, Util_PoolThread, (void *)pThread );
+        assert( status == 0 );
+        return;
     }
-    Vec_PtrFree( vStack );    
-    
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
+    pthread_mutex_lock( &s_Pool.Mutex );
+    if ( (iWorker = Util_PoolWorkerId()) == -1 )
+        iWorker = s_Pool.iNext++ % s_Pool.nThreads;
+    Util_PoolDequePush( s_Pool.Deques + iWorker, &Task );
+    s_Pool.nTasks++;
+    p->nPending++;
+    pthread_cond_signal( &s_Pool.Work );
+    // wake up the thread waiting for this group, so that it can take the task
+    pthread_cond_broadcast( &p->Done );
+    pthread_mutex_unlock( &s_Pool.Mutex );
+}
+int Util_PoolGroupWait( Util_PoolGroup_t * p )
+{
+    Util_PoolThread_t * pThread;
+    Util_PoolTask_t Task;
+    int i, nSkipped;
+    pthread_mutex_lock( &s_Pool.Mutex );
+    while ( p->nPending > 0 )
     {
-        if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-            i = -1; // Start from the beginning again
-        nanosleep(&pause_duration, NULL);
+        if ( p->vThreads == NULL && Util_PoolTakeGroup( p, &Task ) )
+            Util_PoolRun( &Task );
+        else
+            pthread_cond_wait( &p->Done, &s_Pool.Mutex );
     }
-
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
+    nSkipped = p->nSkipped;
+    pthread_mutex_unlock( &s_Pool.Mutex );
+    if ( p->vThreads )
     {
-        ThData[i].pUserData = NULL;
-        atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
+        Vec_PtrForEachEntry( Util_PoolThread_t *, p->vThreads, pThread, i )
+        {
+            pthread_join( pThread->Thread, NULL );
+            ABC_FREE( pThread );
+        }
+        Vec_PtrClear( p->vThreads );
     }
-
-    // Join threads
-    for ( i = 0; i < nProcs; i++ )
-        pthread_join( WorkerThread[i], NULL );
-
-    //if ( fVerbose )
-    //    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );    
+    return nSkipped;
+}
+void Util_PoolGroupCancel( Util_PoolGroup_t * p )
+{
+    pthread_mutex_lock( &s_Pool.Mutex );
+    p->fCanceled = 1;
+    pthread_mutex_unlock( &s_Pool.Mutex );
+}
+int Util_PoolGroupIsCanceled( Util_PoolGroup_t * p )
+{
+    int fCanceled;
+    pthread_mutex_lock( &s_Pool.Mutex );
+    fCanceled = p->fCanceled;
+    pthread_mutex_unlock( &s_Pool.Mutex );
+    return fCanceled || (p->Deadline && Abc_Clock() > p->Deadline);
+}
+void Util_PoolGroupStop( Util_PoolGroup_t * p )
+{
+    assert( p->nPending == 0 );
+    assert( p->vThreads == NULL || Vec_PtrSize(p->vThreads) == 0 );
+    if ( p->vThreads )
+        Vec_PtrFree( p->vThreads );
+    pthread_cond_destroy( &p->Done );
+    ABC_FREE( p );
 }
 
 #endif // pthreads are used
 
+/**Function*************************************************************
+
+  Synopsis    [Applies the user function to the entries of the array.]
+
+  Description [The entries are processed by the tasks of the pool using
+  at most nProcs threads (including the calling thread). If TimeOut (in
+  seconds) is positive, it is the deadline for the whole call: the
+  entries not started before the time is over are skipped, so the caller
+  should keep the input of the entries that have no result. The tasks
+  that are running are expected to enforce their own timeout. Returns
+  the number of entries skipped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
+{
+    Util_PoolGroup_t * pGroup;
+    void * pData; int i, nSkipped = 0;
+    fflush( stdout );
+    if ( nProcs <= 2 ) {
+        abctime Deadline = TimeOut > 0 ? Abc_Clock() + (abctime)TimeOut * CLOCKS_PER_SEC : 0;
+        Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
+            if ( Deadline && Abc_Clock() > Deadline )
+                nSkipped++;
+            else
+                pUserFunc( pData );
+        return nSkipped;
+    }
+    pGroup = Util_PoolGroupStart( nProcs, TimeOut );
+    Vec_PtrForEachEntryReverse( void *, (Vec_Ptr_t *)vData, pData, i )
+        Util_PoolGroupAdd( pGroup, pUserFunc, pData );
+    nSkipped = Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
+    return nSkipped;
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
@@ -0,0 +1,390 @@
+/**CFile****************************************************************
+
+  FileName    [vecMemMt.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Resizable arrays.]
+
+  Synopsis    [Concurrent hashed array of memory pieces.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: vecMemMt.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__vec__vecMemMt_h
+#define ABC__misc__vec__vecMemMt_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/vec/vec.h"
+
+ABC_NAMESPACE_HEADER_START
+
+/*
+   This is a version of the hashed Vec_Mem_t (see Vec_MemHashInsert)
+   that can be used by several threads at the same time.
+
+   The entries are stored in the embedded Vec_Mem_t, so that they can be
+   read with Vec_MemReadEntry(&p->Mem, i) by the code written for Vec_Mem_t.
+   The array of page pointers is allocated once and never moves, so reading
+   an entry does not require synchronization.
+
+   The hash table is split into shards selected by the hash key. Each shard
+   is an open-addressing table of entry IDs. Lookups do not take locks: the
+   entry is copied into the memory before its ID is published in the table.
+   Insertions lock one shard. When a shard grows, the new table is published
+   and the old one is kept until the store is freed, because other threads
+   may still be reading it. A lookup in the old table may miss the entries
+   added later, which is harmless, because the insertion repeats the lookup
+   under the lock.
+
+   The entry IDs are the order of insertion. If several threads insert at
+   the same time, the IDs depend on the thread schedule. The IDs are taken
+   from a separate counter, and the number of entries is advanced in the
+   order of IDs after the entry is copied, so the entries below
+   Vec_MemMtEntryNum() can always be read.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+// the atomic operations are only available with the compilers providing atomic builtins;
+// otherwise, the store can only be used by one thread
+#if defined(__GNUC__) || defined(__clang__)
+#define Vec_MemMtLoad( pVar )                   __atomic_load_n( pVar, __ATOMIC_ACQUIRE )
+#define Vec_MemMtStore( pVar, Value )           __atomic_store_n( pVar, Value, __ATOMIC_RELEASE )
+#define Vec_MemMtFetchAdd( pVar, Value )        __atomic_fetch_add( pVar, Value, __ATOMIC_ACQ_REL )
+#define Vec_MemMtLockTry( pVar )                (!__atomic_exchange_n( pVar, 1, __ATOMIC_ACQUIRE ))
+#define Vec_MemMtUnlock( pVar )                 __atomic_store_n( pVar, 0, __ATOMIC_RELEASE )
+#else
+#define Vec_MemMtLoad( pVar )                   (*(pVar))
+#define Vec_MemMtStore( pVar, Value )           (*(pVar) = (Value))
+#define Vec_MemMtFetchAdd( pVar, Value )        ((*(pVar) += (Value)) - (Value))
+#define Vec_MemMtLockTry( pVar )                (*(pVar) == 0 ? (*(pVar) = 1) : 0)
+#define Vec_MemMtUnlock( pVar )                 (*(pVar) = 0)
+#endif
+
+#define VEC_MEM_MT_PAGES   (1 << 16)   // the max number of pages
+#define VEC_MEM_MT_TABLE   (1 << 10)   // the starting size of the shard table
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Vec_MemMtShard_t_  Vec_MemMtShard_t;
+struct Vec_MemMtShard_t_
+{
+    int *            pTable;      // entry IDs (the first int is the table mask)
+    int              nUsed;       // the number of entries in the table
+    int              Lock;        // the lock taken by the writers
+    Vec_Ptr_t *      vRetired;    // the tables replaced by the larger ones
+};
+
+typedef struct Vec_MemMt_t_       Vec_MemMt_t;
+struct Vec_MemMt_t_
+{
+    Vec_Mem_t        Mem;         // memory pieces
+    int              nShardsLog;  // log2 of the number of shards
+    int              nReserved;   // the number of entry IDs given out
+    int              LockPages;   // the lock taken when allocating pages
+    Vec_MemMtShard_t * pShards;   // hash table shards
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates the concurrent memory vector.]
+
+  Description [Entry size is in terms of 8-byte words. Page size is log2
+  of the number of entries on one page. The number of shards is 2^nShardsLog.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int * Vec_MemMtTableAlloc( int nSize )
+{
+    int * pTable = ABC_ALLOC( int, nSize + 1 );
+    memset( pTable + 1, 0xFF, sizeof(int) * nSize );
+    pTable[0] = nSize - 1;
+    return pTable;
+}
+static inline Vec_MemMt_t * Vec_MemMtAlloc( int nEntrySize, int LogPageSze, int nShardsLog )
+{
+    Vec_MemMt_t * p = ABC_CALLOC( Vec_MemMt_t, 1 );
+    int i;
+    Vec_MemAlloc_( &p->Mem, nEntrySize, LogPageSze );
+    p->Mem.nPageAlloc = VEC_MEM_MT_PAGES;
+    p->Mem.ppPages    = ABC_CALLOC( word *, p->Mem.nPageAlloc );
+    p->nShardsLog     = nShardsLog;
+    p->pShards        = ABC_CALLOC( Vec_MemMtShard_t, 1 << nShardsLog );
+    for ( i = 0; i < (1 << nShardsLog); i++ )
+    {
+        p->pShards[i].pTable   = Vec_MemMtTableAlloc( VEC_MEM_MT_TABLE );
+        p->pShards[i].vRetired = Vec_PtrAlloc( 0 );
+    }
+    return p;
+}
+static inline void Vec_MemMtFree( Vec_MemMt_t * p )
+{
+    int i;
+    if ( p == NULL )
+        return;
+    for ( i = 0; i <= p->Mem.iPage; i++ )
+        ABC_FREE( p->Mem.ppPages[i] );
+    ABC_FREE( p->Mem.ppPages );
+    for ( i = 0; i < (1 << p->nShardsLog); i++ )
+    {
+        ABC_FREE( p->pShards[i].pTable );
+        Vec_PtrFreeFree( p->pShards[i].vRetired );
+    }
+    ABC_FREE( p->pShards );
+    ABC_FREE( p );
+}
+static inline int Vec_MemMtEntryNum( Vec_MemMt_t * p )
+{
+    return Vec_MemMtLoad( &p->Mem.nEntries );
+}
+static inline Vec_Mem_t * Vec_MemMtMem( Vec_MemMt_t * p )
+{
+    return &p->Mem;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the hash key of the entry.]
+
+  Description [The lower bits select the shard, the upper bits select
+  the place in the shard table.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Vec_MemMtHashKey( Vec_MemMt_t * p, word * pEntry )
+{
+    word Key = 0;
+    int i;
+    for ( i = 0; i < p->Mem.nEntrySize; i++ )
+        Key = (Key ^ pEntry[i]) * ABC_CONST(0x9E3779B97F4A7C15);
+    return (unsigned)(Key >> 32) ^ (unsigned)Key;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the entry in the shard table.]
+
+  Description [Returns the entry ID or -1 if the entry is not found.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Vec_MemMtLookupTable( Vec_MemMt_t * p, int * pTable, unsigned Key, word * pEntry )
+{
+    int Mask = pTable[0], i = (Key >> p->nShardsLog) & Mask, Id;
+    for ( ; (Id = Vec_MemMtLoad(pTable + 1 + i)) != -1; i = (i + 1) & Mask )
+        if ( !memcmp( Vec_MemReadEntry(&p->Mem, Id), pEntry, sizeof(word) * p->Mem.nEntrySize ) )
+            return Id;
+    return -1;
+}
+static inline int Vec_MemMtLookup( Vec_MemMt_t * p, word * pEntry )
+{
+    unsigned Key = Vec_MemMtHashKey( p, pEntry );
+    Vec_MemMtShard_t * pShard = p->pShards + (Key & ((1 << p->nShardsLog) - 1));
+    return Vec_MemMtLookupTable( p, Vec_MemMtLoad(&pShard->pTable), Key, pEntry );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Inserts the entry while holding the lock of its shard.]
+
+  Description [Returns the entry ID.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Vec_MemMtLock( int * pLock )
+{
+    while ( !Vec_MemMtLockTry(pLock) )
+        while ( Vec_MemMtLoad(pLock) )
+            ;
+}
+static inline word * Vec_MemMtEntryNew( Vec_MemMt_t * p, int * pId )
+{
+    int Id = Vec_MemMtFetchAdd( &p->nReserved, 1 );
+    int iPage = Id >> p->Mem.LogPageSze;
+    assert( iPage < p->Mem.nPageAlloc );
+    if ( Vec_MemMtLoad(p->Mem.ppPages + iPage) == NULL )
+    {
+        Vec_MemMtLock( &p->LockPages );
+        if ( p->Mem.ppPages[iPage] == NULL )
+        {
+            Vec_MemMtStore( p->Mem.ppPages + iPage, ABC_ALLOC(word, p->Mem.nEntrySize * (1 << p->Mem.LogPageSze)) );
+            p->Mem.iPage = Abc_MaxInt( p->Mem.iPage, iPage );
+        }
+        Vec_MemMtUnlock( &p->LockPages );
+    }
+    *pId = Id;
+    return p->Mem.ppPages[iPage] + p->Mem.nEntrySize * (Id & p->Mem.PageMask);
+}
+static inline void Vec_MemMtEntryPublish( Vec_MemMt_t * p, int Id )
+{
+    // the entries are published in the order of IDs after their data is written
+    while ( Vec_MemMtLoad(&p->Mem.nEntries) != Id )
+        ;
+    Vec_MemMtStore( &p->Mem.nEntries, Id + 1 );
+}
+static inline void Vec_MemMtResize( Vec_MemMt_t * p, Vec_MemMtShard_t * pShard )
+{
+    int * pTable = pShard->pTable, * pTableNew = Vec_MemMtTableAlloc( 2 * (pTable[0] + 1) );
+    int i, k, Id;
+    for ( i = 0; i <= pTable[0]; i++ )
+    {
+        if ( (Id = pTable[1 + i]) == -1 )
+            continue;
+        k = (Vec_MemMtHashKey(p, Vec_MemReadEntry(&p->Mem, Id)) >> p->nShardsLog) & pTableNew[0];
+        while ( pTableNew[1 + k] != -1 )
+            k = (k + 1) & pTableNew[0];
+        pTableNew[1 + k] = Id;
+    }
+    Vec_PtrPush( pShard->vRetired, pTable );
+    Vec_MemMtStore( &pShard->pTable, pTableNew );
+}
+static inline int Vec_MemMtInsertLocked( Vec_MemMt_t * p, Vec_MemMtShard_t * pShard, unsigned Key, word * pEntry )
+{
+    int * pTable, i, Id = Vec_MemMtLookupTable( p, pShard->pTable, Key, pEntry );
+    if ( Id >= 0 )
+        return Id;
+    if ( 2 * (pShard->nUsed + 1) > pShard->pTable[0] + 1 )
+        Vec_MemMtResize( p, pShard );
+    memcpy( Vec_MemMtEntryNew(p, &Id), pEntry, sizeof(word) * p->Mem.nEntrySize );
+    Vec_MemMtEntryPublish( p, Id );
+    pTable = pShard->pTable;
+    for ( i = (Key >> p->nShardsLog) & pTable[0]; pTable[1 + i] != -1; i = (i + 1) & pTable[0] )
+        ;
+    Vec_MemMtStore( pTable + 1 + i, Id );
+    pShard->nUsed++;
+    return Id;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Inserts the entry.]
+
+  Description [Returns the ID of the new or the existing entry.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Vec_MemMtInsert( Vec_MemMt_t * p, word * pEntry )
+{
+    unsigned Key = Vec_MemMtHashKey( p, pEntry );
+    Vec_MemMtShard_t * pShard = p->pShards + (Key & ((1 << p->nShardsLog) - 1));
+    int Id = Vec_MemMtLookupTable( p, Vec_MemMtLoad(&pShard->pTable), Key, pEntry );
+    if ( Id >= 0 )
+        return Id;
+    Vec_MemMtLock( &pShard->Lock );
+    Id = Vec_MemMtInsertLocked( p, pShard, Key, pEntry );
+    Vec_MemMtUnlock( &pShard->Lock );
+    return Id;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Inserts several entries.]
+
+  Description [The entries are stored one after another in pEntries.
+  Their IDs are returned in pIds. The entries are looked up without
+  locking. The missing ones are inserted shard by shard, taking the lock
+  of each shard once.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Vec_MemMtInsertBatch( Vec_MemMt_t * p, word * pEntries, int nEntries, int * pIds )
+{
+    unsigned * pKeys = ABC_ALLOC( unsigned, nEntries );
+    int i, s, nMisses = 0, nShards = 1 << p->nShardsLog;
+    for ( i = 0; i < nEntries; i++ )
+    {
+        word * pEntry = pEntries + i * p->Mem.nEntrySize;
+        pKeys[i] = Vec_MemMtHashKey( p, pEntry );
+        pIds[i]  = Vec_MemMtLookupTable( p, Vec_MemMtLoad(&p->pShards[pKeys[i] & (nShards - 1)].pTable), pKeys[i], pEntry );
+        nMisses += (pIds[i] == -1);
+    }
+    for ( s = 0; nMisses > 0 && s < nShards; s++ )
+    {
+        int fLocked = 0;
+        for ( i = 0; i < nEntries; i++ )
+        {
+            if ( pIds[i] != -1 || (int)(pKeys[i] & (nShards - 1)) != s )
+                continue;
+            if ( !fLocked )
+                Vec_MemMtLock( &p->pShards[s].Lock ), fLocked = 1;
+            pIds[i] = Vec_MemMtInsertLocked( p, p->pShards + s, pKeys[i], pEntries + i * p->Mem.nEntrySize );
+            nMisses--;
+        }
+        if ( fLocked )
+            Vec_MemMtUnlock( &p->pShards[s].Lock );
+    }
+    assert( nMisses == 0 );
+    ABC_FREE( pKeys );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates the concurrent memory vector for truth tables.]
+
+  Description [Similar to Vec_MemAllocForTT(): the constant-0 function
+  and the (complemented) elementary variable get IDs 0 and 1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Vec_MemMt_t * Vec_MemMtAllocForTT( int nVars, int fCompl )
+{
+    int Value, nWords = (nVars <= 6 ? 1 : (1 << (nVars - 6)));
+    word * uTruth = ABC_ALLOC( word, nWords );
+    Vec_MemMt_t * p = Vec_MemMtAlloc( nWords, 12, 4 );
+    memset( uTruth, 0x00, sizeof(word) * nWords );
+    Value = Vec_MemMtInsert( p, uTruth ); assert( Value == 0 );
+    memset( uTruth, fCompl ? 0x55 : 0xAA, sizeof(word) * nWords );
+    Value = Vec_MemMtInsert( p, uTruth ); assert( Value == 1 );
+    ABC_FREE( uTruth );
+    return p;
+}
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
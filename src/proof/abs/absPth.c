@@ -60,6 +60,7 @@ typedef struct Abs_ThData_t_
 pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
 static volatile int g_nRunIds = 0;             // the number of the last prover instance
 static volatile int g_fAbstractionProved = 0;  // set to 1 when prover successed to prove
+static Util_PoolGroup_t * g_pGroup = NULL;     // the group of the threads running the prover
 
 // call back procedure for PDR
 int Abs_CallBackToStop( int RunId ) { assert( RunId <= g_nRunIds ); return RunId < g_nRunIds; }
@@ -83,7 +84,7 @@ int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 
 /**Function*************************************************************
 
-  Synopsis    [Create one thread]
+  Synopsis    [Runs the prover on its own thread.]
 
   Description []
                
@@ -92,7 +93,7 @@ int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
   SeeAlso     []
 
 ***********************************************************************/
-void * Abs_ProverThread( void * pArg )
+int Abs_ProverTask( void * pArg )
 {
     Abs_ThData_t * pThData = (Abs_ThData_t *)pArg;
     Pdr_Par_t Pars, * pPars = &Pars;
@@ -124,10 +125,7 @@ void * Abs_ProverThread( void * pArg )
     // free memory
     Aig_ManStop( pThData->pAig );
     ABC_FREE( pThData );
-    // quit this thread
-    pthread_exit( NULL );
-    assert(0);
-    return NULL;
+    return 1;
 }
 void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
 {
@@ -136,7 +134,6 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     Ssw_Pars_t Pars, * pPars = &Pars;
     Aig_Man_t * pAig, * pTemp;
     Gia_Man_t * pAbs;
-    pthread_t ProverThread;
     int status;
     // disable verbosity
 //    fVerbose = 0;
@@ -171,10 +168,11 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
     pThData->RunId = ++g_nRunIds;
     status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
-    // create thread
+    // start the task
     if ( fVerbose )  Abc_Print( 1, "\nTrying to prove abstraction %d.\n", pThData->RunId );
-    status = pthread_create( &ProverThread, NULL, Abs_ProverThread, pThData );
-    assert( status == 0 );
+    if ( g_pGroup == NULL )
+        g_pGroup = Util_PoolGroupStartThreads( 0 );
+    Util_PoolGroupAdd( g_pGroup, Abs_ProverTask, pThData );
 }
 void Gia_GlaProveCancel( int fVerbose )
 {
@@ -182,6 +180,12 @@ void Gia_GlaProveCancel( int fVerbose )
     status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
     g_nRunIds++;
     status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    // the prover notices the new run ID and quits
+    if ( g_pGroup == NULL )
+        return;
+    Util_PoolGroupWait( g_pGroup );
+    Util_PoolGroupStop( g_pGroup );
+    g_pGroup = NULL;
 }
 int Gia_GlaProveCheck( int fVerbose )
 {
@@ -1153,7 +1153,7 @@ void Cec_ManLSCorrespondenceBmc( Gia_Man_t * pAig, Cec_ParCor_t * pPars, int nPr
         else if ( pPars->fUseCSat )
             vCexStore = Tas_ManSolveMiterNc( pSrm, pPars->nBTLimit, &vStatus, 0 );
         else
-            vCexStore = Cec_ManSatSolveMiter( pSrm, pParsSat, &vStatus );
+            vCexStore = Cec_ManSatSolveMiterPar( pSrm, pParsSat, 0, 0, &vStatus, pPars->nProcs );
         // refine classes with these counter-examples
         if ( Vec_IntSize(vCexStore) )
         {
@@ -1474,10 +1474,8 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
         clk2 = Abc_Clock();
         if ( fPersist )
             vCexStore = Cec_DynSrmSolve( pDynSrm, pPars->nBTLimit, &vStatus );
-        else if ( pPars->fUseCSat )
-            vCexStore = Cbs_ManSolveMiterNc( pSrm, pPars->nBTLimit, &vStatus, 0, 0 );
         else
-            vCexStore = Cec_ManSatSolveMiter( pSrm, pParsSat, &vStatus );
+            vCexStore = Cec_ManSatSolveMiterPar( pSrm, pParsSat, pPars->fUseCSat, pPars->nBTLimit, &vStatus, pPars->nProcs );
         if ( pSrm )
             Gia_ManStop( pSrm );
         clkSat += Abc_Clock() - clk2;
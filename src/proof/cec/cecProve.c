@@ -54,6 +54,7 @@ extern int Ssw_RarSimulateGia( Gia_Man_t * p, Ssw_RarPars_t * pPars );
 extern int Bmcg_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars );
 
 typedef struct Par_Share_t_ Par_Share_t;
+typedef struct Par_Bus_t_ Par_Bus_t;
 typedef struct Par_ThData_t_ Par_ThData_t;
 typedef struct Wlc_Ntk_t_ Wlc_Ntk_t;
 struct Cec_ScorrStop_t_;
@@ -62,10 +63,10 @@ static int Cec_SProveCallback( void * pUser, int fSolved, unsigned Result );
 static Gia_Man_t * Cec_GiaScorrOld( Gia_Man_t * p, int nTimeOut, Par_Share_t * pShare, struct Cec_ScorrStop_t_ * pStopOut );
 static Gia_Man_t * Cec_GiaScorrNew( Gia_Man_t * p, int nTimeOut, Par_Share_t * pShare, struct Cec_ScorrStop_t_ * pStopOut );
 #ifdef ABC_USE_PTHREADS
-static void Cec_GiaInitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int nTimeOut, int nTimeOutU, Wlc_Ntk_t * pWlc, const char * pUfarArgs, int fVerbose, pthread_t * WorkerThread, Par_Share_t * pShare, int * pEngines, int StageId, int NetId, struct Cec_SproveTrace_t_ * pTrace );
-static void Cec_GiaStopThreads( Par_ThData_t * ThData, pthread_t * WorkerThread, int nWorkers );
+static Util_PoolGroup_t * Cec_GiaInitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int nTimeOut, int nTimeOutU, Wlc_Ntk_t * pWlc, const char * pUfarArgs, int fVerbose, Par_Share_t * pShare, int * pEngines, int StageId, int NetId, struct Cec_SproveTrace_t_ * pTrace );
+static void Cec_GiaStopThreads( Par_ThData_t * ThData, int nWorkers );
+static int Cec_GiaWaitThreads( Util_PoolGroup_t * pGroup, Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int RetValue, int * pRetEngine );
 #endif
-static int Cec_GiaWaitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int RetValue, int * pRetEngine );
 
 extern int Ufar_ProveWithTimeout( Wlc_Ntk_t * pNtk, int nTimeOut, int fVerbose, int (*pFuncStop)(int), int RunId, const char * pArgs );
 
@@ -89,18 +90,28 @@ int Cec_GiaReplayTest( Gia_Man_t * p, Wlc_Ntk_t * pWlc, char * pFileName, int fV
 typedef struct Cec_SproveTrace_t_ Cec_SproveTrace_t;
 typedef struct Cec_SproveStage_t_ Cec_SproveStage_t;
 typedef struct Cec_SprovePlan_t_ Cec_SprovePlan_t;
+// the facts exchanged by the engines while they run; the safe depth holds
+// for all networks, while the lemmas refer to the flops of one network
+struct Par_Bus_t_
+{
+    pthread_mutex_t    Mutex;
+    int                nSafeDepth;   // the number of frames where the outputs cannot fail
+    int                iSafeEngine;  // the engine that reached this depth
+    Vec_Int_t *        vLemmas;      // lemmas as (network, size, flop literals of an unreachable cube)
+    int                nLemmas;      // the number of lemmas published
+    int                nImported;    // the number of lemmas imported by the engines
+};
 struct Par_Share_t_
 {
     volatile int       fSolved;
     volatile unsigned  Result;
     volatile int       iEngine;
+    Par_Bus_t *        pBus;
 };
 typedef struct Par_ThData_t_
 {
     Gia_Man_t * p;
     int         iEngine;
-    int         fWorking;
-    int         fStop;
     int         nTimeOut;
     int         Result;
     int         fVerbose;
@@ -111,10 +122,9 @@ typedef struct Par_ThData_t_
     int         StageId;
     int         NetId;
     int         StopReason;
+    int         iLemma;
     Par_Share_t * pShare;
     Cec_SproveTrace_t * pTrace;
-    pthread_mutex_t Mutex;
-    pthread_cond_t  Cond;
 } Par_ThData_t;
 typedef struct Cec_ScorrStop_t_
 {
@@ -242,6 +252,83 @@ static int Cec_SProveCallback( void * pUser, int fSolved, unsigned Result )
     }
     return pShare->fSolved != 0;
 }
+static int Cec_SProveDepth( void * pUser, int nSafe )
+{
+    Par_ThData_t * pThData = (Par_ThData_t *)pUser;
+    Par_Bus_t * pBus = pThData->pShare ? pThData->pShare->pBus : NULL;
+    int status;
+    if ( pBus == NULL )
+        return nSafe;
+    status = pthread_mutex_lock( &pBus->Mutex );
+    assert( status == 0 );
+    if ( pBus->nSafeDepth < nSafe )
+    {
+        pBus->nSafeDepth  = nSafe;
+        pBus->iSafeEngine = pThData->iEngine;
+    }
+    nSafe = pBus->nSafeDepth;
+    status = pthread_mutex_unlock( &pBus->Mutex );
+    assert( status == 0 );
+    return nSafe;
+}
+static int Cec_SProveLemmas( void * pUser, int nSafe, Vec_Int_t * vCubes )
+{
+    Par_ThData_t * pThData = (Par_ThData_t *)pUser;
+    Par_Bus_t * pBus = pThData->pShare ? pThData->pShare->pBus : NULL;
+    int i, nLits, status, nCubes = 0;
+    Cec_SProveDepth( pUser, nSafe );
+    if ( pBus == NULL || vCubes == NULL )
+        return 0;
+    status = pthread_mutex_lock( &pBus->Mutex );
+    assert( status == 0 );
+    for ( i = pThData->iLemma; i < Vec_IntSize(pBus->vLemmas); i += nLits + 2 )
+    {
+        nLits = Vec_IntEntry( pBus->vLemmas, i + 1 );
+        if ( Vec_IntEntry(pBus->vLemmas, i) != pThData->NetId )
+            continue;
+        Vec_IntPush( vCubes, nLits );
+        Vec_IntPushArray( vCubes, Vec_IntEntryP(pBus->vLemmas, i + 2), nLits );
+        nCubes++;
+    }
+    pThData->iLemma = Vec_IntSize(pBus->vLemmas);
+    pBus->nImported += nCubes;
+    status = pthread_mutex_unlock( &pBus->Mutex );
+    assert( status == 0 );
+    return nCubes;
+}
+static void Cec_SproveBusAddFlopEquivs( Par_Bus_t * pBus, Gia_Man_t * p, int NetId )
+{
+    Gia_Obj_t * pObj, * pRepr;
+    int i, iFlop, fCompl, status;
+    if ( pBus == NULL || p->pReprs == NULL || Gia_ManRegNum(p) == 0 )
+        return;
+    Gia_ManSetPhase( p );
+    status = pthread_mutex_lock( &pBus->Mutex );
+    assert( status == 0 );
+    Gia_ManForEachRo( p, pObj, i )
+    {
+        pRepr = Gia_ObjReprObj( p, Gia_ObjId(p, pObj) );
+        if ( pRepr == NULL )
+            continue;
+        fCompl = Gia_ObjPhase(pObj) ^ Gia_ObjPhase(pRepr);
+        if ( Gia_ObjIsConst0(pRepr) )
+        {
+            // the flop is constant: the opposite value is unreachable
+            Vec_IntPushThree( pBus->vLemmas, NetId, 1, Abc_Var2Lit(i, fCompl) );
+            pBus->nLemmas++;
+        }
+        else if ( Gia_ObjIsRo(p, pRepr) )
+        {
+            // the flops are equivalent: the two cubes where they differ are unreachable
+            iFlop = Gia_ObjCioId(pRepr) - Gia_ManPiNum(p);
+            Vec_IntPushFour( pBus->vLemmas, NetId, 2, Abc_Var2Lit(i, 0), Abc_Var2Lit(iFlop, !fCompl) );
+            Vec_IntPushFour( pBus->vLemmas, NetId, 2, Abc_Var2Lit(i, 1), Abc_Var2Lit(iFlop, fCompl) );
+            pBus->nLemmas += 2;
+        }
+    }
+    status = pthread_mutex_unlock( &pBus->Mutex );
+    assert( status == 0 );
+}
 
 static inline const char * Cec_SproveNetName( int NetId )
 {
@@ -740,6 +827,9 @@ static Gia_Man_t * Cec_SproveRunReduce( Gia_Man_t * pInput, Cec_SproveStage_t *
         StopReason = 2;
     else if ( Stop.fStoppedByTimeout )
         StopReason = 3;
+    // the classes of an interrupted run are not proved
+    if ( StopReason == 1 && pStage->ReduceType == PAR_ENGINE_SCORR1 )
+        Cec_SproveBusAddFlopEquivs( pShare->pBus, pInput, pStage->ReduceNetIn );
     if ( pClkUsed )
         *pClkUsed = Abc_Clock() - clk;
     if ( pTrace && pTrace->fActive )
@@ -766,21 +856,23 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
 {
     abctime clkTotal = Abc_Clock(), clkStage = 0;
     Par_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
     Par_ThData_t UifData[1];
-    pthread_t UifThread[1];
+    Util_PoolGroup_t * pGroup = NULL, * pUifGroup = NULL;
     Par_Share_t Share;
+    Par_Bus_t Bus;
     Cec_SproveTrace_t Trace;
     Gia_Man_t * pScorr = NULL, * pScorr2 = NULL;
     int UifEngines[1] = { PAR_ENGINE_UFAR };
-    int i, RetValue = -1, RetEngine = -1, fThreadsStarted = 0, fUifStarted = 0;
+    int i, RetValue = -1, RetEngine = -1;
     (void)fVeryVerbose;
     memset( &Share, 0, sizeof(Par_Share_t) );
+    memset( &Bus, 0, sizeof(Par_Bus_t) );
     memset( &Trace, 0, sizeof(Cec_SproveTrace_t) );
+    pthread_mutex_init( &Bus.Mutex, NULL );
+    Bus.vLemmas = Vec_IntAlloc( 100 );
+    Share.pBus = &Bus;
     memset( ThData, 0, sizeof(ThData) );
-    memset( WorkerThread, 0, sizeof(WorkerThread) );
     memset( UifData, 0, sizeof(UifData) );
-    memset( UifThread, 0, sizeof(UifThread) );
     Abc_CexFreeP( &p->pCexComb );
     Abc_CexFreeP( &p->pCexSeq );
     if ( !fSilent && fVerbose )
@@ -793,9 +885,8 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
     {
         Cec_SproveTraceWrite( &Trace, "START kind=ufar mode=persistent timeout=%d t=%llu",
             pPlan->nTimeOutUif, Cec_SproveClockToMs( Cec_SproveTraceTime(&Trace) ) );
-        Cec_GiaInitThreads( UifData, 1, p, pPlan->nTimeOutUif, pPlan->nTimeOutUif, pWlc, pPlan->pUfarArgs, fVerbose,
-            UifThread, &Share, UifEngines, 0, SPROVE_NET_ORIG, &Trace );
-        fUifStarted = 1;
+        pUifGroup = Cec_GiaInitThreads( UifData, 1, p, pPlan->nTimeOutUif, pPlan->nTimeOutUif, pWlc, pPlan->pUfarArgs, fVerbose,
+            &Share, UifEngines, 0, SPROVE_NET_ORIG, &Trace );
     }
     for ( i = 0; i < pPlan->nStages; i++ )
     {
@@ -817,9 +908,8 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
             }
             Cec_SproveTraceWrite( &Trace, "START kind=round stage=%d net=%s timeout=%d t=%llu",
                 pStage->Id, Cec_SproveNetName(pStage->RoundNet), pStage->RoundTimeout, Cec_SproveClockToMs( Cec_SproveTraceTime(&Trace) ) );
-            Cec_GiaInitThreads( ThData, pStage->nRoundEngines, pRoundNet, pStage->RoundTimeout, pStage->RoundTimeout, pWlc, pPlan->pUfarArgs, fVerbose,
-                fThreadsStarted ? NULL : WorkerThread, &Share, pStage->RoundEngines, pStage->Id, pStage->RoundNet, &Trace );
-            fThreadsStarted = 1;
+            pGroup = Cec_GiaInitThreads( ThData, pStage->nRoundEngines, pRoundNet, pStage->RoundTimeout, pStage->RoundTimeout, pWlc, pPlan->pUfarArgs, fVerbose,
+                &Share, pStage->RoundEngines, pStage->Id, pStage->RoundNet, &Trace );
         }
         if ( pStage->fHasReduce )
         {
@@ -835,7 +925,7 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
         }
         if ( pStage->fHasRound )
         {
-            RetValue = Cec_GiaWaitThreads( ThData, pStage->nRoundEngines, p, RetValue, &RetEngine );
+            RetValue = Cec_GiaWaitThreads( pGroup, ThData, pStage->nRoundEngines, p, RetValue, &RetEngine );
             Cec_SproveTakeSharedResult( &Share, &RetValue, &RetEngine );
             Cec_SproveTraceWrite( &Trace, "STOP kind=round stage=%d net=%s result=%s winner=%s t=%llu",
                 pStage->Id, Cec_SproveNetName(pStage->RoundNet), Cec_SproveResultName(RetValue),
@@ -852,18 +942,16 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
             }
         }
     }
-    if ( fUifStarted )
+    if ( pUifGroup )
     {
-        RetValue = Cec_GiaWaitThreads( UifData, 1, p, RetValue, &RetEngine );
+        RetValue = Cec_GiaWaitThreads( pUifGroup, UifData, 1, p, RetValue, &RetEngine );
         Cec_SproveTakeSharedResult( &Share, &RetValue, &RetEngine );
         Cec_SproveTraceWrite( &Trace, "STOP kind=ufar mode=persistent result=%s winner=%s t=%llu",
             Cec_SproveResultName(RetValue), RetEngine == PAR_ENGINE_UFAR ? "ufar" : "other",
             Cec_SproveClockToMs( Cec_SproveTraceTime(&Trace) ) );
     }
-    if ( fThreadsStarted )
-        Cec_GiaStopThreads( ThData, WorkerThread, pPlan->Stages[0].nRoundEngines );
-    if ( fUifStarted )
-        Cec_GiaStopThreads( UifData, UifThread, 1 );
+    Cec_GiaStopThreads( ThData, PAR_THR_MAX );
+    Cec_GiaStopThreads( UifData, 1 );
     Gia_ManStopP( &pScorr2 );
     Gia_ManStopP( &pScorr );
     if ( !fSilent )
@@ -883,10 +971,17 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
         Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
         fflush( stdout );
     }
+    if ( !fSilent && fVerbose )
+        printf( "Shared facts: safe depth = %d (%s)   lemmas = %d   imported = %d.\n",
+            Bus.nSafeDepth, Bus.nSafeDepth ? Cec_SolveEngineName(Bus.iSafeEngine) : "none", Bus.nLemmas, Bus.nImported );
+    Cec_SproveTraceWrite( &Trace, "BUS depth=%d engine=%s lemmas=%d imported=%d",
+        Bus.nSafeDepth, Bus.nSafeDepth ? Cec_SolveEngineName(Bus.iSafeEngine) : "none", Bus.nLemmas, Bus.nImported );
     Cec_SproveTraceWrite( &Trace, "FINAL result=%s winner=%s total=%llu",
         Cec_SproveResultName(RetValue), RetEngine >= 0 ? Cec_SolveEngineName(RetEngine) : "none",
         Cec_SproveClockToMs( Abc_Clock() - clkTotal ) );
     Cec_SproveTraceClose( &Trace );
+    Vec_IntFree( Bus.vLemmas );
+    pthread_mutex_destroy( &Bus.Mutex );
     return RetValue;
 }
 
@@ -950,6 +1045,7 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose, Par
         {
             pPars->pFuncProgress = Cec_SProveCallback;
             pPars->pProgress     = (void *)pThData;
+            pPars->pFuncDepth    = Cec_SProveDepth;
         }
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         Cec_CopyGiaNameToAig( p, pAig );
@@ -967,6 +1063,7 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose, Par
         {
             pPars->pFuncProgress = Cec_SProveCallback;
             pPars->pProgress     = (void *)pThData;
+            pPars->pFuncLemmas   = Cec_SProveLemmas;
         }
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         Cec_CopyGiaNameToAig( p, pAig );
@@ -985,6 +1082,7 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose, Par
         {
             pPars->pFuncProgress = Cec_SProveCallback;
             pPars->pProgress     = (void *)pThData;
+            pPars->pFuncDepth    = Cec_SProveDepth;
         }
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         Cec_CopyGiaNameToAig( p, pAig );
@@ -1003,6 +1101,7 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose, Par
         {
             pPars->pFuncProgress = Cec_SProveCallback;
             pPars->pProgress     = (void *)pThData;
+            pPars->pFuncLemmas   = Cec_SProveLemmas;
         }
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         Cec_CopyGiaNameToAig( p, pAig );
@@ -1137,88 +1236,21 @@ Gia_Man_t * Cec_GiaScorrNew( Gia_Man_t * p, int nTimeOut, Par_Share_t * pShare,
   SeeAlso     []
 
 ***********************************************************************/
-void * Cec_GiaProveWorkerThread( void * pArg )
+int Cec_GiaProveWorkerTask( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    int status, Result;
-    status = pthread_mutex_lock( &pThData->Mutex );
-    assert( status == 0 );
-    while ( 1 )
-    {
-        while ( !pThData->fWorking && !pThData->fStop )
-        {
-            status = pthread_cond_wait( &pThData->Cond, &pThData->Mutex );
-            assert( status == 0 );
-        }
-        if ( pThData->fStop )
-            break;
-        status = pthread_mutex_unlock( &pThData->Mutex );
-        assert( status == 0 );
-        Result = Cec_GiaProveOne( pThData->p, pThData->iEngine, pThData->nTimeOut, pThData->fVerbose, pThData );
-        status = pthread_mutex_lock( &pThData->Mutex );
-        assert( status == 0 );
-        pThData->Result = Result;
-        pThData->fWorking = 0;
-        status = pthread_cond_broadcast( &pThData->Cond );
-        assert( status == 0 );
-    }
-    status = pthread_mutex_unlock( &pThData->Mutex );
-    assert( status == 0 );
-    return NULL;
-}
-static void Cec_GiaStartThreads( Par_ThData_t * ThData, int nWorkers )
-{
-    int i, status;
-    for ( i = 0; i < nWorkers; i++ )
-    {
-        status = pthread_mutex_lock( &ThData[i].Mutex );
-        assert( status == 0 );
-        assert( !ThData[i].fStop );
-        assert( !ThData[i].fWorking );
-        ThData[i].fWorking = 1;
-        status = pthread_cond_signal( &ThData[i].Cond );
-        assert( status == 0 );
-        status = pthread_mutex_unlock( &ThData[i].Mutex );
-        assert( status == 0 );
-    }
+    pThData->Result = Cec_GiaProveOne( pThData->p, pThData->iEngine, pThData->nTimeOut, pThData->fVerbose, pThData );
+    return 1;
 }
-static void Cec_GiaInitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int nTimeOut, int nTimeOutU, Wlc_Ntk_t * pWlc, const char * pUfarArgs, int fVerbose, pthread_t * WorkerThread, Par_Share_t * pShare, int * pEngines, int StageId, int NetId, Cec_SproveTrace_t * pTrace )
+// starts the engines on their own threads, because they run concurrently and exchange facts
+static Util_PoolGroup_t * Cec_GiaInitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int nTimeOut, int nTimeOutU, Wlc_Ntk_t * pWlc, const char * pUfarArgs, int fVerbose, Par_Share_t * pShare, int * pEngines, int StageId, int NetId, Cec_SproveTrace_t * pTrace )
 {
-    int i, status;
+    Util_PoolGroup_t * pGroup;
+    int i;
     assert( nWorkers <= PAR_THR_MAX );
+    pGroup = Util_PoolGroupStartThreads( 0 );
     for ( i = 0; i < nWorkers; i++ )
     {
-        if ( WorkerThread )
-        {
-            ThData[i].p = Gia_ManDup( p );
-            Cec_CopyGiaName( p, ThData[i].p );
-            ThData[i].iEngine = pEngines[i];
-            ThData[i].fWorking = 0;
-            ThData[i].fStop    = 0;
-            ThData[i].nTimeOut = nTimeOut;
-            ThData[i].Result   = -1;
-            ThData[i].fVerbose = fVerbose;
-            ThData[i].nTimeOutU= nTimeOutU;
-            ThData[i].pWlc     = pWlc;
-            ThData[i].pUfarArgs= pUfarArgs;
-            ThData[i].WorkerId = i;
-            ThData[i].StageId  = StageId;
-            ThData[i].NetId    = NetId;
-            ThData[i].StopReason = 0;
-            ThData[i].pShare   = pShare;
-            ThData[i].pTrace   = pTrace;
-            status = pthread_mutex_init( &ThData[i].Mutex, NULL );
-            assert( status == 0 );
-            status = pthread_cond_init( &ThData[i].Cond, NULL );
-            assert( status == 0 );
-            status = pthread_create( WorkerThread + i, NULL, Cec_GiaProveWorkerThread, (void *)(ThData + i) );
-            assert( status == 0 );
-            continue;
-        }
-        status = pthread_mutex_lock( &ThData[i].Mutex );
-        assert( status == 0 );
-        assert( !ThData[i].fStop );
-        assert( !ThData[i].fWorking );
         Gia_ManStopP( &ThData[i].p );
         ThData[i].p = Gia_ManDup( p );
         Cec_CopyGiaName( p, ThData[i].p );
@@ -1233,56 +1265,32 @@ static void Cec_GiaInitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t *
         ThData[i].StageId  = StageId;
         ThData[i].NetId    = NetId;
         ThData[i].StopReason = 0;
+        ThData[i].iLemma   = 0;
         ThData[i].pShare   = pShare;
         ThData[i].pTrace   = pTrace;
-        status = pthread_mutex_unlock( &ThData[i].Mutex );
-        assert( status == 0 );
+        Util_PoolGroupAdd( pGroup, Cec_GiaProveWorkerTask, (void *)(ThData + i) );
     }
-    Cec_GiaStartThreads( ThData, nWorkers );
+    return pGroup;
 }
-static void Cec_GiaStopThreads( Par_ThData_t * ThData, pthread_t * WorkerThread, int nWorkers )
+static void Cec_GiaStopThreads( Par_ThData_t * ThData, int nWorkers )
 {
-    int i, status;
-    for ( i = 0; i < nWorkers; i++ )
-    {
-        status = pthread_mutex_lock( &ThData[i].Mutex );
-        assert( status == 0 );
-        ThData[i].fStop = 1;
-        status = pthread_cond_signal( &ThData[i].Cond );
-        assert( status == 0 );
-        status = pthread_mutex_unlock( &ThData[i].Mutex );
-        assert( status == 0 );
-    }
+    int i;
     for ( i = 0; i < nWorkers; i++ )
-    {
-        status = pthread_join( WorkerThread[i], NULL );
-        assert( status == 0 );
         Gia_ManStopP( &ThData[i].p );
-        status = pthread_cond_destroy( &ThData[i].Cond );
-        assert( status == 0 );
-        status = pthread_mutex_destroy( &ThData[i].Mutex );
-        assert( status == 0 );
-    }
 }
-static int Cec_GiaWaitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int RetValue, int * pRetEngine )
+static int Cec_GiaWaitThreads( Util_PoolGroup_t * pGroup, Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int RetValue, int * pRetEngine )
 {
-    int i, status, fWorking;
+    int i;
+    Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
     for ( i = 0; i < nWorkers; i++ )
     {
-        status = pthread_mutex_lock( &ThData[i].Mutex );
-        assert( status == 0 );
-        fWorking = ThData[i].fWorking;
-        if ( RetValue == -1 && !fWorking && ThData[i].Result != -1 )
-        {
-            RetValue = ThData[i].Result;
-            *pRetEngine = ThData[i].iEngine;
-            if ( !p->pCexSeq && ThData[i].p->pCexSeq )
-                p->pCexSeq = Abc_CexDup( ThData[i].p->pCexSeq, -1 );
-        }
-        status = pthread_mutex_unlock( &ThData[i].Mutex );
-        assert( status == 0 );
-        if ( fWorking )
-            i = -1;
+        if ( RetValue != -1 || ThData[i].Result == -1 )
+            continue;
+        RetValue = ThData[i].Result;
+        *pRetEngine = ThData[i].iEngine;
+        if ( !p->pCexSeq && ThData[i].p->pCexSeq )
+            p->pCexSeq = Abc_CexDup( ThData[i].p->pCexSeq, -1 );
     }
     return RetValue;
 }
@@ -24,6 +24,7 @@
 #include "bdd/extrab/extraBdd.h"
 #include "base/abc/abc.h"
 #include "map/if/if.h"
+#include "misc/vec/vecHsh.h"
 
 #define USE_GLUCOSE2
 
@@ -105,6 +106,8 @@ struct Cec4_Man_t_
     Vec_Bit_t *      vFails;
     Vec_Bit_t *      vCoDrivers;
     Vec_Int_t *      vPairs;   
+    Vec_Int_t *      vParRepr;       // representatives proved by parallel sweeping
+    Vec_Int_t *      vParTried;      // representatives tried by parallel sweeping
     int              iPosRead;       // candidate reading position
     int              iPosWrite;      // candidate writing position
     int              iLastConst;     // last const node proved
@@ -128,6 +131,9 @@ struct Cec4_Man_t_
     int              nConflicts[2][3];
     int              nGates[2];
     int              nFaster[2];
+    int              nParSat;
+    int              nParUnsat;
+    int              nParUndec;
     abctime          timeCnf;
     abctime          timeGenPats;
     abctime          timeSatSat0;
@@ -140,6 +146,41 @@ struct Cec4_Man_t_
     abctime          timeResimGlo;
     abctime          timeResimLoc;
     abctime          timeStart;
+    abctime          timePar;
+};
+
+// parallel sweeping solves up to CEC4_PAR_TASKS tasks per thread with CEC4_PAR_PAIRS pairs in one round
+#define CEC4_PAR_PAIRS  50
+#define CEC4_PAR_TASKS   2
+
+// task of parallel SAT sweeping
+typedef struct Cec4_ParTask_t_ Cec4_ParTask_t;
+struct Cec4_ParTask_t_
+{
+    Gia_Man_t *      pAig;           // user's AIG (read-only while the tasks run)
+    Cec_ParFra_t *   pPars;          // parameters
+    Vec_Bit_t *      vCoDrivers;     // CO drivers
+    Vec_Int_t *      vParRepr;       // representatives proved in the previous rounds
+    Vec_Int_t *      vPairs;         // candidate pairs (iRepr, iObj)
+    Vec_Int_t *      vStatus;        // solver status of each pair
+    Vec_Int_t *      vCexes;         // counter-examples of disproved pairs (size, CI literals)
+    sat_solver *     pSat;           // SAT solver
+    int *            pMap;           // SAT literal + 1 of each object (owned by the worker)
+    Vec_Int_t *      vMapped;        // objects with SAT literals in pMap (owned by the worker)
+    Vec_Int_t *      vCis;           // CIs with SAT variables
+    Vec_Int_t *      vVarMap;        // CI of each SAT variable
+    Hsh_IntMan_t *   pHash;          // structural hashing of the gates
+    Vec_Int_t *      vHashData;      // fanin literals and the type of each gate
+    Vec_Int_t *      vHashVars;      // SAT variable of each gate
+};
+
+// worker of parallel SAT sweeping
+typedef struct Cec4_ParWorker_t_ Cec4_ParWorker_t;
+struct Cec4_ParWorker_t_
+{
+    Vec_Ptr_t *      vTasks;         // tasks solved by the worker in one round
+    int *            pMap;           // SAT literal + 1 of each object (reused by the tasks)
+    Vec_Int_t *      vMapped;        // objects with SAT literals in pMap
 };
 
 static inline int    Cec4_ObjSatId( Gia_Man_t * p, Gia_Obj_t * pObj )             { return Gia_ObjCopy2Array(p, Gia_ObjId(p, pObj));                                                     }
@@ -222,6 +263,7 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nSatVarMax     =    1000;    // the max number of SAT variables before recycling SAT solver
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
+    pPars->nProcs         =       1;    // the number of threads for SAT sweeping
     pPars->fBMiterInfo    =       0;    // printing BMiter information
 }
 
@@ -305,6 +347,8 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
         abctime timeTotal = Abc_Clock() - p->timeStart;
         abctime timeSat   = p->timeSatSat0 + p->timeSatSat + p->timeSatUnsat0 + p->timeSatUnsat + p->timeSatUndec;
         abctime timeOther = timeTotal - timeSat - p->timeSim - p->timeRefine - p->timeResimLoc - p->timeGenPats;// - p->timeResimGlo;
+        if ( p->timePar )
+        ABC_PRTP( "Par sweeping ", p->timePar,       timeTotal );
         ABC_PRTP( "SAT solving  ", timeSat,          timeTotal );
         ABC_PRTP( "  sat(easy)  ", p->timeSatSat0,   timeTotal );
         ABC_PRTP( "  sat        ", p->timeSatSat,    timeTotal );
@@ -341,6 +385,8 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_IntFreeP( &p->vDisprPairs );
     Vec_BitFreeP( &p->vFails );
     Vec_IntFreeP( &p->vPairs );
+    Vec_IntFreeP( &p->vParRepr );
+    Vec_IntFreeP( &p->vParTried );
     Vec_BitFreeP( &p->vCoDrivers );
     Vec_IntFreeP( &p->vRefClasses );
     Vec_IntFreeP( &p->vRefNodes );
@@ -1858,6 +1904,387 @@ void Cec4_ManSimulateDumpInfo( Cec4_Man_t * pMan )
     Vec_WrdFree( vSims );
     Vec_WrdFree( vSimsPi );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT sweeping.]
+
+  Description [The candidate pairs (iRepr, iObj) are collected in the
+  topological order of iObj and split into tasks of consecutive pairs,
+  so that the pairs of one task share most of their transitive fanin.
+  Each task owns its SAT solver and derives the CNF of the fanin cones
+  from the user's AIG, which is not modified while the tasks are running.
+  The nodes proved equivalent in the previous rounds are merged when the
+  CNF is derived, while the equivalences proved by the task itself are
+  added as clauses. Each round has CEC4_PAR_TASKS tasks per thread. The
+  tasks are assigned to the workers in a fixed order and the results are
+  merged in the order of the tasks, so the outcome does not depend on
+  the scheduling. Each worker reuses one map from the objects to the SAT
+  literals and cleans only its used entries. The counter-examples are
+  collected until half of the patterns are used, and then propagated by
+  the incremental simulation, so only the fanout cones of the changed
+  inputs are resimulated.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec4_ManParHashGate( Cec4_ParTask_t * p, int iLit0, int iLit1, int fXor )
+{
+    int iLitC = p->pMap[0] - 1; // constant 0
+    int iVar, iGate, fCompl = 0;
+    if ( fXor )
+    {
+        fCompl = Abc_LitIsCompl(iLit0) ^ Abc_LitIsCompl(iLit1);
+        iLit0  = Abc_LitRegular(iLit0);
+        iLit1  = Abc_LitRegular(iLit1);
+    }
+    // trivial cases appear after merging the equivalent nodes
+    if ( Abc_Lit2Var(iLit1) == Abc_Lit2Var(iLitC) )
+        ABC_SWAP( int, iLit0, iLit1 );
+    if ( Abc_Lit2Var(iLit0) == Abc_Lit2Var(iLitC) )
+        return fXor ? Abc_LitNotCond(iLit1, fCompl) : (Abc_LitIsCompl(iLit0) ? iLit1 : iLitC);
+    if ( iLit0 == iLit1 )
+        return fXor ? Abc_LitNotCond(iLitC, fCompl) : iLit0;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return iLitC;
+    if ( iLit0 > iLit1 )
+        ABC_SWAP( int, iLit0, iLit1 );
+    Vec_IntPush( p->vHashData, iLit0 );
+    Vec_IntPush( p->vHashData, iLit1 );
+    Vec_IntPush( p->vHashData, fXor );
+    iGate = Hsh_IntManAdd( p->pHash, Vec_IntSize(p->vHashVars) );
+    if ( iGate < Vec_IntSize(p->vHashVars) ) // the gate exists
+    {
+        Vec_IntShrink( p->vHashData, Vec_IntSize(p->vHashData) - 3 );
+        return Abc_Var2Lit( Vec_IntEntry(p->vHashVars, iGate), fCompl );
+    }
+    iVar = sat_solver_addvar( p->pSat );
+    if ( p->pPars->jType < 2 )
+    {
+        if ( fXor )
+            sat_solver_add_xor( p->pSat, iVar, Abc_Lit2Var(iLit0), Abc_Lit2Var(iLit1), 0 );
+        else
+            sat_solver_add_and( p->pSat, iVar, Abc_Lit2Var(iLit0), Abc_Lit2Var(iLit1), Abc_LitIsCompl(iLit0), Abc_LitIsCompl(iLit1), 0 );
+    }
+    if ( p->pPars->jType > 0 )
+    {
+        if ( fXor )
+            sat_solver_set_var_fanin_lit( p->pSat, iVar, iLit1, iLit0 );
+        else
+            sat_solver_set_var_fanin_lit( p->pSat, iVar, iLit0, iLit1 );
+    }
+    Vec_IntPush( p->vHashVars, iVar );
+    return Abc_Var2Lit( iVar, fCompl );
+}
+static int Cec4_ManParObjLit_rec( Cec4_ParTask_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
+    int iRepr = Vec_IntEntry( p->vParRepr, iObj );
+    int iVar, iLit0, iLit1, Lit;
+    if ( p->pMap[iObj] )
+        return p->pMap[iObj] - 1;
+    if ( iRepr >= 0 ) // proved in the previous rounds
+    {
+        Lit = Cec4_ManParObjLit_rec( p, iRepr );
+        Lit = Abc_LitNotCond( Lit, pObj->fPhase ^ Gia_ManObj(p->pAig, iRepr)->fPhase );
+        p->pMap[iObj] = Lit + 1;
+        Vec_IntPush( p->vMapped, iObj );
+        return Lit;
+    }
+    if ( Gia_ObjIsAnd(pObj) )
+    {
+        iLit0 = Abc_LitNotCond( Cec4_ManParObjLit_rec(p, Gia_ObjFaninId0(pObj, iObj)), Gia_ObjFaninC0(pObj) );
+        iLit1 = Abc_LitNotCond( Cec4_ManParObjLit_rec(p, Gia_ObjFaninId1(pObj, iObj)), Gia_ObjFaninC1(pObj) );
+        Lit   = Cec4_ManParHashGate( p, iLit0, iLit1, Gia_ObjIsXor(pObj) );
+        p->pMap[iObj] = Lit + 1;
+        Vec_IntPush( p->vMapped, iObj );
+        return Lit;
+    }
+    else if ( Gia_ObjIsCi(pObj) )
+    {
+        iVar = sat_solver_addvar( p->pSat );
+        Vec_IntPush( p->vCis, iObj );
+        Vec_IntSetEntry( p->vVarMap, iVar, iObj );
+    }
+    else
+    {
+        assert( iObj == 0 );
+        iVar = sat_solver_addvar( p->pSat );
+        Lit  = Abc_Var2Lit( iVar, 1 );
+        sat_solver_addclause( p->pSat, &Lit, 1 );
+    }
+    p->pMap[iObj] = Abc_Var2Lit( iVar, 0 ) + 1;
+    Vec_IntPush( p->vMapped, iObj );
+    return Abc_Var2Lit( iVar, 0 );
+}
+static int Cec4_ManParSolvePair( Cec4_ParTask_t * p, int iRepr, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
+    Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, iRepr );
+    int fCompl = pObj->fPhase ^ pRepr->fPhase;
+    int fEffort = p->vCoDrivers ? Vec_BitEntry(p->vCoDrivers, iObj) || Vec_BitEntry(p->vCoDrivers, iRepr) : 0;
+    // the hard pairs are left to the sequential sweeping, which merges all the nodes proved before
+    int nBTLimit = fEffort ? p->pPars->nBTLimitPo : Abc_MaxInt(1, p->pPars->nBTLimit/10);
+    int iLit0 = Cec4_ManParObjLit_rec( p, iRepr );
+    int iLit1 = Abc_LitNotCond( Cec4_ManParObjLit_rec(p, iObj), fCompl );
+    int status, Lits[2];
+    if ( iLit0 == iLit1 ) // merged structurally
+        return GLUCOSE_UNSAT;
+    if ( p->pPars->jType > 0 )
+    {
+        sat_solver_start_new_round( p->pSat );
+        sat_solver_mark_cone( p->pSat, Abc_Lit2Var(iLit0) );
+        sat_solver_mark_cone( p->pSat, Abc_Lit2Var(iLit1) );
+    }
+    if ( iRepr == 0 )
+    {
+        sat_solver_set_conflict_budget( p->pSat, nBTLimit );
+        return sat_solver_solve( p->pSat, &iLit1, 1 );
+    }
+    Lits[0] = Abc_LitNot( iLit0 );
+    Lits[1] = iLit1;
+    sat_solver_set_conflict_budget( p->pSat, nBTLimit );
+    status = sat_solver_solve( p->pSat, Lits, 2 );
+    if ( status != GLUCOSE_UNSAT )
+        return status;
+    Lits[0] = Abc_LitNot( Lits[0] );
+    Lits[1] = Abc_LitNot( Lits[1] );
+    sat_solver_set_conflict_budget( p->pSat, nBTLimit );
+    return sat_solver_solve( p->pSat, Lits, 2 );
+}
+static void Cec4_ManParMerge( Cec4_ParTask_t * p, int iRepr, int iObj )
+{
+    int fCompl = Gia_ManObj(p->pAig, iObj)->fPhase ^ Gia_ManObj(p->pAig, iRepr)->fPhase;
+    int iLitRepr = Abc_LitNotCond( Cec4_ManParObjLit_rec(p, iRepr), fCompl );
+    int Lits[2] = { iLitRepr, Abc_LitNot(p->pMap[iObj] - 1) };
+    if ( Lits[0] != Abc_LitNot(Lits[1]) )
+    {
+        sat_solver_addclause( p->pSat, Lits, 2 );
+        Lits[0] = Abc_LitNot( Lits[0] );
+        Lits[1] = Abc_LitNot( Lits[1] );
+        sat_solver_addclause( p->pSat, Lits, 2 );
+    }
+    // the fanouts of iObj encoded after this point use the literal of iRepr
+    p->pMap[iObj] = iLitRepr + 1;
+}
+static void Cec4_ManParSolveTask( Cec4_ParTask_t * p )
+{
+    int i, k, iRepr, iObj, iCi, status;
+    assert( Vec_IntSize(p->vMapped) == 0 );
+    p->pSat = sat_solver_start();
+    sat_solver_set_jftr( p->pSat, p->pPars->jType );
+    p->vCis = Vec_IntAlloc( 100 );
+    p->vVarMap = Vec_IntAlloc( 1000 );
+    p->vHashData = Vec_IntAlloc( 3000 );
+    p->vHashVars = Vec_IntAlloc( 1000 );
+    p->pHash = Hsh_IntManStart( p->vHashData, 3, 1000 );
+    Cec4_ManParObjLit_rec( p, 0 );
+    Vec_IntForEachEntryDouble( p->vPairs, iRepr, iObj, i )
+    {
+        status = Cec4_ManParSolvePair( p, iRepr, iObj );
+        Vec_IntPush( p->vStatus, status );
+        if ( status == GLUCOSE_UNSAT )
+            Cec4_ManParMerge( p, iRepr, iObj );
+        if ( status != GLUCOSE_SAT )
+            continue;
+        if ( p->pPars->jType == 0 )
+        {
+            Vec_IntPush( p->vCexes, Vec_IntSize(p->vCis) );
+            Vec_IntForEachEntry( p->vCis, iCi, k )
+                Vec_IntPush( p->vCexes, Abc_Var2Lit(iCi, sat_solver_read_cex_varvalue(p->pSat, Abc_Lit2Var(p->pMap[iCi] - 1))) );
+        }
+        else
+        {
+            int * pCex = sat_solver_read_cex( p->pSat ), iStart = Vec_IntSize(p->vCexes);
+            Vec_IntPush( p->vCexes, 0 );
+            for ( k = 1; k <= pCex[0]; k++ )
+                if ( (iCi = Vec_IntEntry(p->vVarMap, Abc_Lit2Var(pCex[k]))) > 0 )
+                    Vec_IntPush( p->vCexes, Abc_Var2Lit(iCi, !Abc_LitIsCompl(pCex[k])) );
+            Vec_IntWriteEntry( p->vCexes, iStart, Vec_IntSize(p->vCexes) - iStart - 1 );
+        }
+    }
+    sat_solver_stop( p->pSat );
+    Vec_IntFree( p->vCis );
+    Vec_IntFree( p->vVarMap );
+    Vec_IntFree( p->vHashData );
+    Vec_IntFree( p->vHashVars );
+    Hsh_IntManStop( p->pHash );
+    // clean only the entries used by this task, so that the map is reused by the next task
+    Vec_IntForEachEntry( p->vMapped, iObj, i )
+        p->pMap[iObj] = 0;
+    Vec_IntClear( p->vMapped );
+}
+static int Cec4_ManParWorkerTask( void * pArg )
+{
+    Cec4_ParWorker_t * p = (Cec4_ParWorker_t *)pArg;
+    Cec4_ParTask_t * pTask;
+    int i;
+    Vec_PtrForEachEntry( Cec4_ParTask_t *, p->vTasks, pTask, i )
+    {
+        pTask->pMap    = p->pMap;
+        pTask->vMapped = p->vMapped;
+        Cec4_ManParSolveTask( pTask );
+    }
+    return 1;
+}
+static Vec_Ptr_t * Cec4_ManParCollectTasks( Cec4_Man_t * pMan, int nTasks )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Vec_Ptr_t * vTasks = Vec_PtrAlloc( nTasks );
+    Cec4_ParTask_t * pTask = NULL;
+    Gia_Obj_t * pObj;
+    int i, iRepr;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( (iRepr = Gia_ObjRepr(p, i)) == GIA_VOID || Gia_ObjProved(p, i) || Gia_ObjFailed(p, i) )
+            continue;
+        if ( pMan->pPars->nLevelMax && Gia_ObjLevel(p, pObj) > pMan->pPars->nLevelMax )
+            continue;
+        if ( Vec_IntEntry(pMan->vParTried, i) == iRepr + 1 )
+            continue;
+        if ( pTask == NULL || Vec_IntSize(pTask->vPairs) == 2 * CEC4_PAR_PAIRS )
+        {
+            if ( Vec_PtrSize(vTasks) == nTasks )
+                break;
+            pTask = ABC_CALLOC( Cec4_ParTask_t, 1 );
+            pTask->pAig       = p;
+            pTask->pPars      = pMan->pPars;
+            pTask->vCoDrivers = pMan->vCoDrivers;
+            pTask->vParRepr   = pMan->vParRepr;
+            pTask->vPairs     = Vec_IntAlloc( 2 * CEC4_PAR_PAIRS );
+            pTask->vStatus    = Vec_IntAlloc( CEC4_PAR_PAIRS );
+            pTask->vCexes     = Vec_IntAlloc( 100 );
+            Vec_PtrPush( vTasks, pTask );
+        }
+        Vec_IntPushTwo( pTask->vPairs, iRepr, i );
+        Vec_IntWriteEntry( pMan->vParTried, i, iRepr + 1 );
+    }
+    return vTasks;
+}
+static void Cec4_ManParResimulate( Gia_Man_t * p, Cec4_Man_t * pMan, Gia_SimInc_t * pInc )
+{
+    abctime clk = Abc_Clock(), clk2;
+    int i, iRepr;
+    // only the fanout cones of the inputs changed by the new patterns are resimulated
+    pMan->nSimulates++;
+    assert( Vec_IntSize(pMan->vRefClasses) == 0 );
+    Gia_SimIncPropagate( pInc, pMan->vRefClasses );
+    Vec_IntForEachEntry( pMan->vRefClasses, iRepr, i )
+        p->pReprs[iRepr].fColorA = 1;
+    clk2 = Abc_Clock();
+    pMan->timeSim += clk2 - clk;
+    Cec4_RefineClasses( p, pMan, pMan->vRefClasses );
+    pMan->timeRefine += Abc_Clock() - clk2;
+    Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+    p->iPatsPi = 0;
+    Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+    pMan->timeResimGlo += Abc_Clock() - clk;
+}
+void Cec4_ManSweepPar( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    Util_PoolGroup_t * pGroup;
+    Gia_SimInc_t * pInc;
+    Cec4_ParTask_t * pTask;
+    Cec4_ParWorker_t * pWorkers;
+    Vec_Ptr_t * vTasks;
+    abctime clk = Abc_Clock();
+    int nWorkers = pMan->pPars->nProcs;
+    int i, k, n, iRepr, iObj, iLit, nLits, iCex, Round;
+    pMan->vParRepr  = Vec_IntStartFull( Gia_ManObjNum(p) );
+    pMan->vParTried = Vec_IntStart( Gia_ManObjNum(p) );
+    pInc = Gia_SimIncStartSims( p, p->vSims, p->nSimWords );
+    pWorkers = ABC_CALLOC( Cec4_ParWorker_t, nWorkers );
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        pWorkers[i].vTasks  = Vec_PtrAlloc( CEC4_PAR_TASKS );
+        pWorkers[i].pMap    = ABC_CALLOC( int, Gia_ManObjNum(p) );
+        pWorkers[i].vMapped = Vec_IntAlloc( 1000 );
+    }
+    pGroup = Util_PoolGroupStart( nWorkers, 0 );
+    for ( Round = 0; ; Round++ )
+    {
+        vTasks = Cec4_ManParCollectTasks( pMan, CEC4_PAR_TASKS * nWorkers );
+        if ( Vec_PtrSize(vTasks) == 0 && p->iPatsPi > 0 )
+        {
+            // the pending patterns may split the classes and produce new candidates
+            Vec_PtrFree( vTasks );
+            Cec4_ManParResimulate( p, pMan, pInc );
+            vTasks = Cec4_ManParCollectTasks( pMan, CEC4_PAR_TASKS * nWorkers );
+        }
+        if ( Vec_PtrSize(vTasks) == 0 )
+        {
+            Vec_PtrFree( vTasks );
+            break;
+        }
+        // the tasks are distributed in a fixed order, so the results do not depend on scheduling
+        for ( i = 0; i < nWorkers; i++ )
+            Vec_PtrClear( pWorkers[i].vTasks );
+        Vec_PtrForEachEntry( Cec4_ParTask_t *, vTasks, pTask, i )
+            Vec_PtrPush( pWorkers[i % nWorkers].vTasks, pTask );
+        for ( i = 0; i < nWorkers && i < Vec_PtrSize(vTasks); i++ )
+            Util_PoolGroupAdd( pGroup, Cec4_ManParWorkerTask, pWorkers + i );
+        Util_PoolGroupWait( pGroup );
+        // merge the results in the order of the tasks
+        Vec_PtrForEachEntry( Cec4_ParTask_t *, vTasks, pTask, i )
+        {
+            iCex = 0;
+            Vec_IntForEachEntryDouble( pTask->vPairs, iRepr, iObj, k )
+            {
+                int status = Vec_IntEntry( pTask->vStatus, k/2 );
+                if ( status == GLUCOSE_UNSAT )
+                {
+                    Vec_IntWriteEntry( pMan->vParRepr, iObj, iRepr );
+                    pMan->nParUnsat++;
+                }
+                else if ( status == GLUCOSE_SAT )
+                {
+                    if ( p->iPatsPi == 64 * p->nSimWords - 2 )
+                        Cec4_ManParResimulate( p, pMan, pInc );
+                    p->iPatsPi++;
+                    nLits = Vec_IntEntry( pTask->vCexes, iCex++ );
+                    for ( n = 0; n < nLits; n++ )
+                    {
+                        iLit = Vec_IntEntry( pTask->vCexes, iCex++ );
+                        if ( Cec4_ObjSimGetInputBit(p, Abc_Lit2Var(iLit)) != Abc_LitIsCompl(iLit) )
+                            Gia_SimIncFlipCiBit( pInc, Gia_ObjCioId(Gia_ManObj(p, Abc_Lit2Var(iLit))), p->iPatsPi );
+                    }
+                    pMan->nParSat++;
+                }
+                else
+                    pMan->nParUndec++;
+            }
+            Vec_IntFree( pTask->vPairs );
+            Vec_IntFree( pTask->vStatus );
+            Vec_IntFree( pTask->vCexes );
+            ABC_FREE( pTask );
+        }
+        Vec_PtrFree( vTasks );
+        // the counter-examples are batched until half of the patterns are used
+        if ( 2 * p->iPatsPi >= 64 * p->nSimWords )
+            Cec4_ManParResimulate( p, pMan, pInc );
+        if ( pMan->pPars->fVerbose )
+            Cec4_ManPrintStats( p, pMan->pPars, pMan, 0 );
+    }
+    Util_PoolGroupStop( pGroup );
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        Vec_PtrFree( pWorkers[i].vTasks );
+        Vec_IntFree( pWorkers[i].vMapped );
+        ABC_FREE( pWorkers[i].pMap );
+    }
+    ABC_FREE( pWorkers );
+    Gia_SimIncStop( pInc );
+    pMan->timePar = Abc_Clock() - clk;
+    if ( pMan->pPars->fVerbose )
+    {
+        printf( "Parallel sweeping with %d threads in %d rounds:  P = %d  D = %d  F = %d  ", 
+            pMan->pPars->nProcs, Round, pMan->nParUnsat, pMan->nParSat, pMan->nParUndec );
+        Abc_PrintTime( 1, "Time", pMan->timePar );
+    }
+}
+
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly )
 {
 
@@ -1945,6 +2372,8 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
+    if ( pPars->nProcs > 1 )
+        Cec4_ManSweepPar( p, pMan );
     pMan->pNew = Cec4_ManStartNew( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -1967,6 +2396,16 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         pRepr = Gia_ObjReprObj( p, i );
         if ( pRepr == NULL )
             continue;
+        if ( pMan->vParRepr && Vec_IntEntry(pMan->vParRepr, i) == Gia_ObjId(p, pRepr) ) // proved by parallel sweeping
+        {
+            if ( pPars->fBMiterInfo ) 
+                Bnd_ManMerge( Gia_ObjId(p, pRepr), i, pObj->fPhase ^ pRepr->fPhase );
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            Gia_ObjSetProved( p, i );
+            if ( Gia_ObjId(p, pRepr) == 0 )
+                pMan->iLastConst = i;
+            continue;
+        }
         if ( 1 ) // select representative based on recent counter-examples
         {
             pRepr = Cec4_ManFindRepr( p, pMan, i );
@@ -1093,7 +1093,7 @@ static void Cec_ManSatSaveOutVals( Cec_ManSat_t * p, Vec_Int_t * vOutLits, Vec_I
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t * Cec_ManSatSolveMiterOutVals( Gia_Man_t * pAig, Cec_ParSat_t * pPars, Vec_Str_t ** pvStatus, Vec_Int_t * vOutLits, Vec_Int_t ** pvOutVals )
+static Vec_Int_t * Cec_ManSatSolveMiterOutValsInt( Gia_Man_t * pAig, Cec_ParSat_t * pPars, Vec_Str_t ** pvStatus, Vec_Int_t * vOutLits, Vec_Int_t ** pvOutVals, int fProgress )
 {
     Bar_Progress_t * pProgress = NULL;
     Vec_Int_t * vCexStore;
@@ -1118,7 +1118,8 @@ Vec_Int_t * Cec_ManSatSolveMiterOutVals( Gia_Man_t * pAig, Cec_ParSat_t * pPars,
     }
     // perform solving
     p = Cec_ManSatCreate( pAig, pPars );
-    pProgress = Bar_ProgressStart( stdout, Gia_ManPoNum(pAig) );
+    if ( fProgress )
+        pProgress = Bar_ProgressStart( stdout, Gia_ManPoNum(pAig) );
     Gia_ManForEachCo( pAig, pObj, i )
     {
         Vec_IntClear( p->vCex );
@@ -1169,11 +1170,108 @@ Vec_Int_t * Cec_ManSatSolveMiterOutVals( Gia_Man_t * pAig, Cec_ParSat_t * pPars,
     return vCexStore;
 }
 
+Vec_Int_t * Cec_ManSatSolveMiterOutVals( Gia_Man_t * pAig, Cec_ParSat_t * pPars, Vec_Str_t ** pvStatus, Vec_Int_t * vOutLits, Vec_Int_t ** pvOutVals )
+{
+    return Cec_ManSatSolveMiterOutValsInt( pAig, pPars, pvStatus, vOutLits, pvOutVals, 1 );
+}
 Vec_Int_t * Cec_ManSatSolveMiter( Gia_Man_t * pAig, Cec_ParSat_t * pPars, Vec_Str_t ** pvStatus )
 {
     return Cec_ManSatSolveMiterOutVals( pAig, pPars, pvStatus, NULL, NULL );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of solving for the POs on several threads.]
+
+  Description [The POs are divided into groups of consecutive outputs.
+  The cone of each group is duplicated with all the PIs, so that the
+  counter-examples refer to the same CI IDs, and solved by a separate
+  solver. If fUseCSat is set, the circuit-based solver is used with
+  nConfs conflicts; otherwise, the SAT solver is used with pPars. The 
+  results are merged in the order of the outputs, so the returned data 
+  has the same format as that of Cec_ManSatSolveMiter().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec_ManSatTask_t_ Cec_ManSatTask_t;
+struct Cec_ManSatTask_t_
+{
+    Gia_Man_t *      pPart;      // the cones of the outputs
+    Cec_ParSat_t *   pPars;      // SAT parameters
+    int              fUseCSat;   // use circuit-based solver
+    int              nConfs;     // conflict limit of circuit-based solver
+    Vec_Str_t *      vStatus;    // the status of the outputs
+    Vec_Int_t *      vCexStore;  // the counter-examples
+};
+static int Cec_ManSatSolveMiterTask( void * pArg )
+{
+    Cec_ManSatTask_t * pTask = (Cec_ManSatTask_t *)pArg;
+    if ( pTask->fUseCSat )
+        pTask->vCexStore = Cbs_ManSolveMiterNc( pTask->pPart, pTask->nConfs, &pTask->vStatus, 0, 0 );
+    else // the progress bar is not shown, because the tasks run concurrently
+        pTask->vCexStore = Cec_ManSatSolveMiterOutValsInt( pTask->pPart, pTask->pPars, &pTask->vStatus, NULL, NULL, 0 );
+    return 1;
+}
+Vec_Int_t * Cec_ManSatSolveMiterPar( Gia_Man_t * pAig, Cec_ParSat_t * pPars, int fUseCSat, int nConfs, Vec_Str_t ** pvStatus, int nProcs )
+{
+    Util_PoolGroup_t * pGroup;
+    Cec_ManSatTask_t * pTasks;
+    Vec_Int_t * vCexStore, * vPos;
+    Vec_Str_t * vStatus;
+    int nPos = Gia_ManPoNum(pAig);
+    int nParts = Abc_MinInt( 4 * nProcs, nPos / 16 );
+    int i, k, iStart, nLits;
+    char Status;
+    assert( Gia_ManRegNum(pAig) == 0 );
+    if ( (nProcs < 2 || nParts < 2) && fUseCSat )
+        return Cbs_ManSolveMiterNc( pAig, nConfs, pvStatus, 0, 0 );
+    if ( nProcs < 2 || nParts < 2 )
+        return Cec_ManSatSolveMiter( pAig, pPars, pvStatus );
+    // duplicate the cones before starting the threads
+    pTasks = ABC_CALLOC( Cec_ManSatTask_t, nParts );
+    vPos   = Vec_IntStartNatural( nPos );
+    for ( i = 0; i < nParts; i++ )
+    {
+        iStart = (int)((ABC_INT64_T)nPos * i / nParts);
+        pTasks[i].pPart = Gia_ManDupCones( pAig, Vec_IntEntryP(vPos, iStart), (int)((ABC_INT64_T)nPos * (i+1) / nParts) - iStart, 0 );
+        pTasks[i].pPars    = pPars;
+        pTasks[i].fUseCSat = fUseCSat;
+        pTasks[i].nConfs   = nConfs;
+    }
+    Vec_IntFree( vPos );
+    pGroup = Util_PoolGroupStart( nProcs, 0 );
+    for ( i = 0; i < nParts; i++ )
+        Util_PoolGroupAdd( pGroup, Cec_ManSatSolveMiterTask, pTasks + i );
+    Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
+    // merge the results in the order of the outputs
+    vStatus   = Vec_StrAlloc( nPos );
+    vCexStore = Vec_IntAlloc( 10000 );
+    for ( i = 0; i < nParts; i++ )
+    {
+        iStart = (int)((ABC_INT64_T)nPos * i / nParts);
+        Vec_StrForEachEntry( pTasks[i].vStatus, Status, k )
+            Vec_StrPush( vStatus, Status );
+        for ( k = 0; k < Vec_IntSize(pTasks[i].vCexStore); )
+        {
+            Vec_IntPush( vCexStore, iStart + Vec_IntEntry(pTasks[i].vCexStore, k++) );
+            Vec_IntPush( vCexStore, nLits = Vec_IntEntry(pTasks[i].vCexStore, k++) );
+            for ( ; nLits > 0; nLits-- )
+                Vec_IntPush( vCexStore, Vec_IntEntry(pTasks[i].vCexStore, k++) );
+        }
+        Vec_StrFree( pTasks[i].vStatus );
+        Vec_IntFree( pTasks[i].vCexStore );
+        Gia_ManStop( pTasks[i].pPart );
+    }
+    ABC_FREE( pTasks );
+    assert( Vec_StrSize(vStatus) == nPos );
+    *pvStatus = vStatus;
+    return vCexStore;
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
@@ -26,17 +26,6 @@
 #include "misc/util/utilTruth.h"
 //#include "bdd/cudd/cuddInt.h"
 
-#ifdef ABC_USE_PTHREADS
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#include <unistd.h>
-#endif
-
-#endif
-
 ABC_NAMESPACE_IMPL_START
 
 
@@ -549,31 +538,19 @@ typedef struct Par_ThData_t_
     int         nVars;
     int         nConfs;
 } Par_ThData_t;
-void * Cec_GiaSplitWorkerThread( void * pArg )
+int Cec_GiaSplitWorkerTask( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->p == NULL )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
-        pThData->fWorking = 0;
-    }
-    assert( 0 );
-    return NULL;
+    assert( pThData->fWorking && pThData->p != NULL );
+    pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
+    pThData->fWorking = 0;
+    return 1;
 }
 int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
     Par_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
+    Util_PoolGroup_t * pGroup;
     Vec_Ptr_t * vStack;
     Cnf_Dat_t * pCnf;
     double Progress = 0;
@@ -612,7 +589,7 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     // create local copy
     vStack = Vec_PtrAlloc( 1000 );
     Vec_PtrPush( vStack, Gia_ManDup(p) );
-    // start threads
+    // each slot solves one cofactor at a time using a task of the thread pool
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].p        = NULL;
@@ -623,8 +600,8 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
         ThData[i].Result   = -1;
         ThData[i].nVars    = -1;
         ThData[i].nConfs   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cec_GiaSplitWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
+    pGroup = Util_PoolGroupStart( nProcs + 1, 0 );
     // look at the threads
     while ( fWorkToDo )
     {
@@ -695,6 +672,7 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
             ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
             ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
             ThData[i].fWorking = 1;
+            Util_PoolGroupAdd( pGroup, Cec_GiaSplitWorkerTask, (void *)(ThData + i) );
         }
         if ( nIterMax && nIter >= nIterMax )
             break;
@@ -702,11 +680,9 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     if ( !fWorkToDo )
         RetValue = 1;
 finish:
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
-        if ( ThData[i].fWorking )
-            i = -1;
-    // stop threads
+    // wait till the tasks finish
+    Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
     for ( i = 0; i < nProcs; i++ )
     {
         assert( !ThData[i].fWorking );
@@ -716,9 +692,6 @@ finish:
             continue;
         Cnf_DataFree( ThData[i].pCnf );
         ThData[i].pCnf = NULL;
-        // stop
-        ThData[i].p = NULL;
-        ThData[i].fWorking = 1;
     }
     // finish
     Cec_GiaSplitClean( vStack );
@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nProcs        =       1;  // the number of threads
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -83,6 +84,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->fBlocking      =       0;  // clause pushing with blocking
     pPars->pFuncProgress  =    NULL;  // progress/termination callback
     pPars->pProgress      =    NULL;  // progress callback data
+    pPars->pFuncLemmas    =    NULL;  // lemma exchange callback
 }
 
 /**Function*************************************************************
@@ -567,6 +569,8 @@ int ZPdr_ManDown( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCube, Pdr_Set_t * pPred,
 
             Vec_VecPush( p->vClauses, l, pCubeMin );   // consume ref
             p->nCubes++;
+            if ( p->pMtDb )
+                Pdr_ManMtExport( p, l, pCubeMin );
             // add clause
             for ( i = 1; i <= l; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
@@ -708,6 +712,8 @@ int ZPdr_ManDown_Exhaustive( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCube, Pdr_Set_
                 Pdr_ManSolverAddClause( p, i, pCubeMin ); 
             Vec_VecPush( p->vClauses, l, pCubeMin );   // consume ref
             p->nCubes++;
+            if ( p->pMtDb )
+                Pdr_ManMtExport( p, l, pCubeMin );
 
             // try to push the original cube farther
             for ( j = l; j < kMax; j++ )
@@ -730,6 +736,8 @@ int ZPdr_ManDown_Exhaustive( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCube, Pdr_Set_
                     Pdr_ManSolverAddClause( p, i, pCubeMinCopy ); 
                 Vec_VecPush( p->vClauses, j, pCubeMinCopy ); 
                 p->nCubes++;
+                if ( p->pMtDb )
+                    Pdr_ManMtExport( p, j, pCubeMinCopy );
             }
 
             // add new clause
@@ -1255,6 +1263,9 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
     int kMax = Vec_PtrSize(p->vSolvers)-1;
     abctime clk;
     p->nBlocks++;
+    // add the lemmas derived by other threads
+    if ( p->pMtDb )
+        Pdr_ManMtImport( p );
     // create first proof obligation
 //    assert( p->pQueue == NULL );
     pThis = Pdr_OblStart( kMax, Prio--, pCube, NULL ); // consume ref
@@ -1268,6 +1279,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             return 0; // SAT
         if ( pThis->iFrame > kMax ) // finished this level
             return 1;
+        if ( p->pMtDb && Pdr_ManMtIsStopped(p) ) // solved by another thread
+            return -1;
         if ( p->nQueLim && p->nQueCur >= p->nQueLim )
         {
             p->nQueLim = p->nQueLim * 3 / 2;
@@ -1347,6 +1360,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            if ( p->pMtDb )
+                Pdr_ManMtExport( p, k, pCubeMin );
             // schedule proof obligation
             if ( (k < kMax || p->pPars->fReuseProofOblig) && !p->pPars->fShortest )
             {
@@ -1382,6 +1397,55 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Exchanges the safe depth and lemmas with other engines.]
+
+  Description [Reports that the outputs cannot fail in the first iFrame
+  frames and imports the lemmas proved by other engines. Each lemma is
+  a cube of flop literals unreachable from the initial state; it is
+  added to all frames as a clause. The lemmas are not imported in the
+  abstraction mode.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManImportLemmas( Pdr_Man_t * p, int iFrame )
+{
+    Vec_Int_t * vCubes = p->pPars->fUseAbs ? NULL : Vec_IntAlloc( 100 );
+    Vec_Int_t * vLits, * vPiLits;
+    Pdr_Set_t * pCube;
+    int i, k, nLits, nSafe = (p->pPars->nFailOuts || p->pPars->nDropOuts) ? 0 : iFrame;
+    p->pPars->pFuncLemmas( p->pPars->pProgress, nSafe, vCubes );
+    if ( vCubes == NULL || Vec_IntSize(vCubes) == 0 )
+    {
+        Vec_IntFreeP( &vCubes );
+        return;
+    }
+    vLits   = Vec_IntAlloc( 100 );
+    vPiLits = Vec_IntAlloc( 0 );
+    for ( i = 0; i < Vec_IntSize(vCubes); i += nLits + 1 )
+    {
+        nLits = Vec_IntEntry( vCubes, i );
+        Vec_IntClear( vLits );
+        for ( k = 0; k < nLits; k++ )
+        {
+            assert( Abc_Lit2Var(Vec_IntEntry(vCubes, i+1+k)) < Aig_ManRegNum(p->pAig) );
+            Vec_IntPush( vLits, Vec_IntEntry(vCubes, i+1+k) );
+        }
+        pCube = Pdr_SetCreate( vLits, vPiLits );
+        for ( k = 1; k <= iFrame; k++ )
+            Pdr_ManSolverAddClause( p, k, pCube );
+        Vec_VecPush( p->vClauses, iFrame, pCube );
+        p->nCubes++;
+    }
+    Vec_IntFree( vPiLits );
+    Vec_IntFree( vLits );
+    Vec_IntFree( vCubes );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1637,6 +1701,10 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         assert( pCube == NULL );
         Pdr_ManSetPropertyOutput( p, iFrame );
         Pdr_ManCreateSolver( p, ++iFrame );
+        if ( p->pPars->pFuncLemmas )
+            Pdr_ManImportLemmas( p, iFrame );
+        if ( p->pMtDb )
+            Pdr_ManMtImport( p );
         if ( fPrintClauses )
         {
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
@@ -1766,6 +1834,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
 ***********************************************************************/
 int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
 {
+    Aig_Man_t * pAigUsed;
     Pdr_Man_t * p;
     int k, RetValue;
     abctime clk = Abc_Clock();
@@ -1787,8 +1856,14 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
-    p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll && !pPars->fUseAbs )
+        p = Pdr_ManSolveMt( pAig, pPars, &RetValue );
+    else
+    {
+        p = Pdr_ManStart( pAig, pPars, NULL );
+        RetValue = Pdr_ManSolveInt( p );
+    }
+    pAigUsed = p->pAig;
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -1808,6 +1883,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
         Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
     p->tTotal += Abc_Clock() - clk;
     Pdr_ManStop( p );
+    if ( pAigUsed != pAig )
+        Aig_ManStop( pAigUsed );
     pPars->iFrame--;
     // convert all -2 (unknown) entries into -1 (undec)
     if ( pPars->vOutMap )
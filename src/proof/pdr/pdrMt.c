@@ -0,0 +1,393 @@
+/**CFile****************************************************************
+
+  FileName    [pdrMt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Concurrent PDR with shared lemmas.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: pdrMt.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The threads run PDR on their own copies of the AIG, with their own
+// frame solvers and diversified parameters. Each clause derived by a
+// thread is published in the database together with its frame. Other
+// threads add it to their frames after checking that it is inductive
+// relative to their own previous frame, which keeps the frames of each
+// thread monotone and the convergence check sound.
+// The threads do not share the proof obligations. An obligation of one
+// thread is relative to the frames of that thread, and its chain of
+// parents is needed to build the counter-example. Another thread could
+// not block it against its own frames or extend the chain.
+// Each record of vLemmas is (thread, frame, nLits, lit1, lit2, ...).
+
+struct Pdr_MtDb_t_
+{
+    Vec_Int_t *    vLemmas;    // the lemmas published by the threads
+    int            nLemmas;    // the number of lemmas
+    volatile int   fStop;      // the problem is solved by some thread
+    int            iWinner;    // the thread that solved the problem
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;     // protects the lemmas and the winner
+#endif
+};
+
+#ifdef ABC_USE_PTHREADS
+#define PDR_MT_LOCK(p)    pthread_mutex_lock( &(p)->Mutex )
+#define PDR_MT_UNLOCK(p)  pthread_mutex_unlock( &(p)->Mutex )
+#else
+#define PDR_MT_LOCK(p)
+#define PDR_MT_UNLOCK(p)
+#endif
+
+typedef struct Pdr_MtThData_t_ Pdr_MtThData_t;
+struct Pdr_MtThData_t_
+{
+    Pdr_Par_t      Pars;       // the parameters of this thread
+    Pdr_Par_t *    pParsUser;  // the parameters of the user
+    Aig_Man_t *    pAig;       // the AIG solved by this thread
+    Pdr_Man_t *    pMan;       // the PDR manager of this thread
+    Pdr_MtDb_t *   pDb;        // the shared database
+    int            iWorker;    // the number of this thread
+    int            RetValue;   // the result of this thread
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the clause blocked in frames 1..k.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManMtExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_MtDb_t * pDb = p->pMtDb;
+    int i;
+    PDR_MT_LOCK( pDb );
+    Vec_IntPush( pDb->vLemmas, p->iMtWorker );
+    Vec_IntPush( pDb->vLemmas, k );
+    Vec_IntPush( pDb->vLemmas, pCube->nLits );
+    for ( i = 0; i < pCube->nLits; i++ )
+        Vec_IntPush( pDb->vLemmas, pCube->Lits[i] );
+    pDb->nLemmas++;
+    PDR_MT_UNLOCK( pDb );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses published by other threads.]
+
+  Description [A clause blocked by another thread in frames 1..k is
+  added to frames 1..k' of this thread, where k' is the smaller of k and
+  the last frame, if it is not subsumed by the clauses of this thread
+  and if it is inductive relative to frame k'-1. The clauses failing
+  the check are dropped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManMtImport( Pdr_Man_t * p )
+{
+    Pdr_MtDb_t * pDb = p->pMtDb;
+    Vec_Int_t * vNew, * vLits, * vPiLits;
+    Pdr_Set_t * pCube;
+    int i, k, iFrame, nLits, RetValue, kMax = Vec_PtrSize(p->vSolvers)-1;
+    if ( kMax < 1 )
+        return;
+    // copy the new lemmas
+    PDR_MT_LOCK( pDb );
+    vNew = Vec_IntAllocArrayCopy( Vec_IntArray(pDb->vLemmas) + p->iMtLemma, Vec_IntSize(pDb->vLemmas) - p->iMtLemma );
+    p->iMtLemma = Vec_IntSize(pDb->vLemmas);
+    PDR_MT_UNLOCK( pDb );
+    vLits   = Vec_IntAlloc( 100 );
+    vPiLits = Vec_IntAlloc( 0 );
+    for ( i = 0; i < Vec_IntSize(vNew); i += nLits + 3 )
+    {
+        iFrame = Abc_MinInt( Vec_IntEntry(vNew, i+1), kMax );
+        nLits  = Vec_IntEntry( vNew, i+2 );
+        if ( Vec_IntEntry(vNew, i) == p->iMtWorker )
+            continue;
+        Vec_IntClear( vLits );
+        for ( k = 0; k < nLits; k++ )
+            Vec_IntPush( vLits, Vec_IntEntry(vNew, i+3+k) );
+        pCube = Pdr_SetCreate( vLits, vPiLits );
+        if ( Pdr_SetIsInit(pCube, -1) || Pdr_ManCheckContainment(p, iFrame, pCube) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        RetValue = Pdr_ManCheckCube( p, iFrame-1, pCube, NULL, p->pPars->nConfGenLimit, 0, 1 );
+        if ( RetValue != 1 )
+        {
+            Pdr_SetDeref( pCube );
+            if ( RetValue == -1 )
+                break;
+            continue;
+        }
+        for ( k = 1; k <= iFrame; k++ )
+            Pdr_ManSolverAddClause( p, k, pCube );
+        Vec_VecPush( p->vClauses, iFrame, pCube ); // consume ref
+        p->nCubes++;
+        p->nMtImported++;
+    }
+    Vec_IntFree( vPiLits );
+    Vec_IntFree( vLits );
+    Vec_IntFree( vNew );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if another thread has solved the problem.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManMtIsStopped( Pdr_Man_t * p )
+{
+    return p->pMtDb->fStop;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Progress callback of one thread.]
+
+  Description [Stops the thread when another thread has solved the
+  problem. Otherwise, forwards the progress to the user's callback.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ManMtProgress( void * pUser, int fSolved, unsigned Result )
+{
+    Pdr_MtThData_t * pThData = (Pdr_MtThData_t *)pUser;
+    Pdr_Par_t * pPars = pThData->pParsUser;
+    if ( pThData->pDb->fStop )
+        return 1;
+    if ( pPars->pFuncProgress )
+        return pPars->pFuncProgress( pPars->pProgress, 0, Result );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Lemma exchange callback of one thread.]
+
+  Description [Forwards the safe depth and the lemmas to the user's
+  callback together with the user's callback data.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ManMtLemmas( void * pUser, int nSafe, Vec_Int_t * vCubes )
+{
+    Pdr_MtThData_t * pThData = (Pdr_MtThData_t *)pUser;
+    Pdr_Par_t * pPars = pThData->pParsUser;
+    return pPars->pFuncLemmas( pPars->pProgress, nSafe, vCubes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs PDR in one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ManMtWorker( void * pArg )
+{
+    Pdr_MtThData_t * pThData = (Pdr_MtThData_t *)pArg;
+    Pdr_MtDb_t * pDb = pThData->pDb;
+    pThData->RetValue = -1;
+    if ( pDb->fStop )
+        return 0;
+    pThData->pMan = Pdr_ManStart( pThData->pAig, &pThData->Pars, NULL );
+    pThData->pMan->pMtDb     = pDb;
+    pThData->pMan->iMtWorker = pThData->iWorker;
+    pThData->RetValue = Pdr_ManSolveInt( pThData->pMan );
+    if ( pThData->RetValue == 0 || pThData->RetValue == 1 )
+    {
+        PDR_MT_LOCK( pDb );
+        if ( pDb->iWinner == -1 )
+            pDb->iWinner = pThData->iWorker;
+        pDb->fStop = 1;
+        PDR_MT_UNLOCK( pDb );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using several threads.]
+
+  Description [The threads differ in the random seed of the SAT solvers
+  and in the generalization options. The first thread works on the
+  user's AIG, while the other threads work on its copies. Returns the
+  manager of the thread that solved the problem (or of the thread that
+  has explored the most frames if the problem is not solved). The
+  managers of the remaining threads are deleted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Man_t * Pdr_ManSolveMt( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue )
+{
+    Pdr_MtDb_t Db, * pDb = &Db;
+    Pdr_MtThData_t * pThData, * pBest;
+    Util_PoolGroup_t * pGroup;
+    Pdr_Man_t * p;
+    int i;
+    abctime clk = Abc_Clock();
+    memset( pDb, 0, sizeof(Pdr_MtDb_t) );
+    pDb->vLemmas = Vec_IntAlloc( 1000 );
+    pDb->iWinner = -1;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &pDb->Mutex, NULL );
+#endif
+    pThData = ABC_CALLOC( Pdr_MtThData_t, pPars->nProcs );
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        pThData[i].Pars          = *pPars;
+        pThData[i].pParsUser     = pPars;
+        pThData[i].pAig          = i ? Aig_ManDupSimple( pAig ) : pAig;
+        pThData[i].pDb           = pDb;
+        pThData[i].iWorker       = i;
+        pThData[i].RetValue      = -1;
+        // diversify the threads
+        pThData[i].Pars.nRandomSeed += i;
+        pThData[i].Pars.fFlopOrder  ^= (i & 1);
+        pThData[i].Pars.fTwoRounds  ^= ((i >> 1) & 1);
+        // only the first thread exchanges lemmas with other engines
+        pThData[i].Pars.pFuncLemmas   = (i == 0 && pPars->pFuncLemmas) ? Pdr_ManMtLemmas : NULL;
+        pThData[i].Pars.pFuncProgress = Pdr_ManMtProgress;
+        pThData[i].Pars.pProgress     = pThData + i;
+        pThData[i].Pars.fUseBridge    = 0;
+        pThData[i].Pars.fVerbose      = 0;
+        pThData[i].Pars.fVeryVerbose  = 0;
+        pThData[i].Pars.fNotVerbose   = 1;
+        pThData[i].Pars.fSilent       = 1;
+    }
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Running PDR with %d threads.\n", pPars->nProcs );
+    fflush( stdout );
+    pGroup = Util_PoolGroupStart( pPars->nProcs, 0 );
+    for ( i = pPars->nProcs - 1; i >= 0; i-- )
+        Util_PoolGroupAdd( pGroup, Pdr_ManMtWorker, pThData + i );
+    Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
+    // select the thread whose manager is returned
+    if ( pDb->iWinner >= 0 )
+        pBest = pThData + pDb->iWinner;
+    else
+    {
+        pBest = pThData;
+        for ( i = 1; i < pPars->nProcs; i++ )
+            if ( pThData[i].pMan && (pBest->pMan == NULL || pBest->Pars.iFrame < pThData[i].Pars.iFrame) )
+                pBest = pThData + i;
+    }
+    if ( pBest->pMan == NULL ) // the first thread did not start
+    {
+        pBest->pMan = Pdr_ManStart( pBest->pAig, &pBest->Pars, NULL );
+        pBest->pMan->iMtWorker = pBest->iWorker;
+    }
+    // delete the other managers
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        if ( pThData + i == pBest )
+            continue;
+        if ( pThData[i].pMan )
+            Pdr_ManStop( pThData[i].pMan );
+        if ( pThData[i].pAig != pAig )
+            Aig_ManStop( pThData[i].pAig );
+    }
+    // transfer the results to the user's AIG and parameters
+    p = pBest->pMan;
+    p->pMtDb = NULL;
+    if ( p->pAig != pAig )
+    {
+        ABC_FREE( pAig->pSeqModel );
+        pAig->pSeqModel = p->pAig->pSeqModel;
+        p->pAig->pSeqModel = NULL;
+    }
+    pPars->iFrame         = pBest->Pars.iFrame;
+    pPars->nFailOuts      = pBest->Pars.nFailOuts;
+    pPars->nDropOuts      = pBest->Pars.nDropOuts;
+    pPars->nProveOuts     = pBest->Pars.nProveOuts;
+    pPars->timeLastSolved = pBest->Pars.timeLastSolved;
+    p->pPars = pPars;
+    *pRetValue = pBest->RetValue;
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Thread %d finished in frame %d. Lemmas published = %d. Lemmas imported = %d.  ",
+            pBest->iWorker, pPars->iFrame, pDb->nLemmas, p->nMtImported );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    if ( *pRetValue == 1 && !pPars->fSilent )
+    {
+        Pdr_ManReportInvariant( p );
+        Pdr_ManVerifyInvariant( p );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &pDb->Mutex );
+#endif
+    Vec_IntFree( pDb->vLemmas );
+    ABC_FREE( pThData );
+    return p;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
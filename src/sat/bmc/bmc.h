@@ -153,6 +153,7 @@ struct Saig_ParBmc_t_
     int(*pFuncStop)(int);       // callback to terminate
     int(*pFuncProgress)(void *, int, unsigned); // progress/termination callback
     void *      pProgress;      // progress callback data
+    int(*pFuncDepth)(void *, int); // exchanges the safe depth with other engines
 };
 
  
@@ -250,6 +251,8 @@ extern void              Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p );
 extern int               Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
 /*=== bmcBmcAnd.c ==========================================================*/
 extern int               Gia_ManBmcPerform( Gia_Man_t * p, Bmc_AndPar_t * pPars );
+/*=== bmcBmcT.c ==========================================================*/
+extern int               Bmct_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars );
 /*=== bmcCexCare.c ==========================================================*/
 extern Abc_Cex_t *       Bmc_CexCareExtendToObjects( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex_t * pCexCare );
 extern Abc_Cex_t *       Bmc_CexCareMinimize( Aig_Man_t * p, int nRealPis, Abc_Cex_t * pCex, int nTryCexes, int fCheck, int fVerbose );
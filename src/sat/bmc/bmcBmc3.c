@@ -1381,6 +1381,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->timeLastSolved =     0;    // time when the last one was solved
     p->pFuncProgress  =  NULL;    // progress/termination callback
     p->pProgress      =  NULL;    // progress callback data
+    p->pFuncDepth     =  NULL;    // depth exchange callback
 }
 
 /**Function*************************************************************
@@ -1502,7 +1503,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     Abc_Cex_t * pCexNew, * pCexNew0;
     FILE * pLogFile = NULL;
     unsigned * pInfo;
-    int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0;
+    int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0, fUndecided = 0, nSafe = 0;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
     int i, f, k, Lit, status;
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
@@ -1573,6 +1574,10 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     {
         if ( pPars->pFuncProgress && pPars->pFuncProgress( pPars->pProgress, 0, (unsigned)f ) )
             goto finish;
+        // report the frames proved so far and skip the frames proved by other engines
+        // (no depth is reported once an output was left undecided in some frame)
+        if ( pPars->pFuncDepth )
+            nSafe = Abc_MaxInt( nSafe, pPars->pFuncDepth( pPars->pProgress, (pPars->nStart || nJumpFrame || fUndecided || pPars->nFailOuts || pPars->nDropOuts) ? 0 : f ) );
         // stop BMC after exploring all reachable states
         if ( !pPars->nFramesJump && Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
         {
@@ -1620,7 +1625,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
                 Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
             }
         }
-        if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
+        if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) || f < nSafe )
             continue;
         // create CNF upfront
         if ( pPars->fSolveAll )
@@ -1684,7 +1689,10 @@ clkOther += Abc_Clock() - clk2;
                 continue;
             // skip output whose time has run out
             if ( p->pTime4Outs && p->pTime4Outs[i] == 0 )
+            {
+                fUndecided = 1;
                 continue;
+            }
             // add constraints for this output
 clk2 = Abc_Clock();
             Lit = Saig_ManBmcCreateCnf( p, pObj, f );
@@ -1880,6 +1888,7 @@ nTimeSat += clkSatRun;
             {
 nTimeUndec += clkSatRun;
                 assert( status == l_Undef );
+                fUndecided = 1;
                 if ( pPars->nFramesJump )
                 {
                     pPars->nConfLimit = pPars->nConfLimitJump;
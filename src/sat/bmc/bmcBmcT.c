@@ -0,0 +1,553 @@
+/**CFile****************************************************************
+
+  FileName    [bmcBmcT.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [BMC with the CNF template of one frame.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: bmcBmcT.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/cnf/cnf.h"
+#include "sat/bsat/satSolver.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The CNF of the transition relation is computed once. The variables of
+// one frame are numbered so that the current-state variables come first
+// and the next-state variables come right after the last variable of the
+// frame. As a result, the next-state variables of frame f coincide with
+// the current-state variables of frame f+1, and frame f is a copy of the
+// template with all literals shifted by 2*f*nFrameVars.
+//
+// The frames are checked in blocks of nFramesAdd frames. Each thread has
+// its own solver with the frames 0..f, claims the next unchecked block
+// and extends its unrolling up to the end of the block. The units derived
+// by the solvers (including the negated outputs proved unreachable) are
+// shared: since each solver contains all the frames up to its depth, a
+// unit over the variables of these frames holds in all of them.
+
+#define BMCT_CONF_CHUNK 10000
+
+typedef struct Bmct_Man_t_ Bmct_Man_t;
+struct Bmct_Man_t_
+{
+    Bmc_AndPar_t *    pPars;               // parameters
+    Gia_Man_t *       pGia;                // user's AIG
+    // CNF template of one frame
+    Vec_Int_t *       vSlots;              // maps objects into template variables
+    Vec_Int_t *       vClaLits;            // literals of the template clauses
+    Vec_Int_t *       vClaBegs;            // the first literal of each clause
+    int               nFrameVars;          // the number of variables in one frame
+    // shared data
+    Vec_Wec_t *       vUnits;              // shared units by frame
+    Vec_Str_t *       vUnitMarks;          // marks variables with shared units
+    Vec_Str_t *       vBlocks;             // for each block, 1 + thread that checked it
+    int               nBlocksNext;         // the next block to be claimed
+    int               nBlocksDone;         // the number of blocks checked in a row
+    int               nFramesDone;         // the number of frames checked in a row
+    int               iFrameFail;          // the smallest failed frame
+    int               iOutFail;            // the failed output
+    Abc_Cex_t *       pCex;                // the counter-example
+    volatile int      fStop;               // signal when it is time to stop
+    int               nUnits;              // the number of shared units
+    abctime           clkStart;            // starting time
+    abctime           Deadline;            // the time to stop
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t   Mutex;               // protects the shared data
+#endif
+};
+
+typedef struct Bmct_Thr_t_ Bmct_Thr_t;
+struct Bmct_Thr_t_
+{
+    Bmct_Man_t *      p;                   // the manager
+    sat_solver *      pSat;                // the solver of this thread
+    int               iThread;             // the number of this thread
+    int               nFrames;             // the number of frames in the solver
+    int               iTrail;              // the first root-level literal not exported
+    Vec_Int_t *       vCursors;            // the first unit not imported in each frame
+    Vec_Int_t *       vTemp;               // literals of the frame
+    int               nImported;           // the number of units imported
+};
+
+#ifdef ABC_USE_PTHREADS
+#define BMCT_LOCK(p)      pthread_mutex_lock( &(p)->Mutex )
+#define BMCT_UNLOCK(p)    pthread_mutex_unlock( &(p)->Mutex )
+#else
+#define BMCT_LOCK(p)
+#define BMCT_UNLOCK(p)
+#endif
+
+static inline int Bmct_ManBlockBeg( Bmct_Man_t * p, int b ) { return b * Abc_MaxInt(p->pPars->nFramesAdd, 1);                  }
+static inline int Bmct_ManBlockEnd( Bmct_Man_t * p, int b ) { int f = Bmct_ManBlockBeg(p, b+1); return p->pPars->nFramesMax ? Abc_MinInt(f, p->pPars->nFramesMax) : f; }
+static inline int Bmct_ManOutLit( Bmct_Man_t * p, int f, int i ) { return Abc_Var2Lit( f * p->nFrameVars + Vec_IntEntry(p->vSlots, Gia_ObjId(p->pGia, Gia_ManPo(p->pGia, i))), 0 ); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the CNF template of one frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmct_ManBuildTemplate( Bmct_Man_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( pGia, 8, 1, 0, 0, 0 );
+    Gia_Obj_t * pObj;
+    int i, * pLit, iObj, nSlots = 0;
+    pGia->pData = NULL;
+    p->vSlots = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    // current-state variables come first
+    Gia_ManForEachRo( pGia, pObj, i )
+        Vec_IntWriteEntry( p->vSlots, Gia_ObjId(pGia, pObj), nSlots++ );
+    Vec_IntWriteEntry( p->vSlots, 0, nSlots++ );
+    Gia_ManForEachPi( pGia, pObj, i )
+        Vec_IntWriteEntry( p->vSlots, Gia_ObjId(pGia, pObj), nSlots++ );
+    Gia_ManForEachPo( pGia, pObj, i )
+        Vec_IntWriteEntry( p->vSlots, Gia_ObjId(pGia, pObj), nSlots++ );
+    for ( i = 0; i < pCnf->nLiterals; i++ )
+    {
+        iObj = Abc_Lit2Var( pCnf->pClauses[0][i] );
+        if ( Vec_IntEntry(p->vSlots, iObj) == -1 && !Gia_ObjIsRi(pGia, Gia_ManObj(pGia, iObj)) )
+            Vec_IntWriteEntry( p->vSlots, iObj, nSlots++ );
+    }
+    p->nFrameVars = nSlots;
+    // next-state variables are the current-state variables of the next frame
+    Gia_ManForEachRi( pGia, pObj, i )
+        Vec_IntWriteEntry( p->vSlots, Gia_ObjId(pGia, pObj), nSlots + i );
+    // translate the clauses
+    p->vClaLits = Vec_IntAlloc( pCnf->nLiterals + 1 );
+    p->vClaBegs = Vec_IntAlloc( pCnf->nClauses + 2 );
+    Vec_IntPush( p->vClaBegs, 0 );
+    Vec_IntPush( p->vClaLits, Abc_Var2Lit(Vec_IntEntry(p->vSlots, 0), 1) );
+    Vec_IntPush( p->vClaBegs, Vec_IntSize(p->vClaLits) );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+    {
+        for ( pLit = pCnf->pClauses[i]; pLit < pCnf->pClauses[i+1]; pLit++ )
+            Vec_IntPush( p->vClaLits, Abc_Lit2LitV(Vec_IntArray(p->vSlots), *pLit) );
+        Vec_IntPush( p->vClaBegs, Vec_IntSize(p->vClaLits) );
+    }
+    Cnf_DataFree( pCnf );
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmct_Man_t * Bmct_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    Bmct_Man_t * p = ABC_CALLOC( Bmct_Man_t, 1 );
+    p->pPars      = pPars;
+    p->pGia       = pGia;
+    p->vUnits     = Vec_WecAlloc( 1000 );
+    p->vUnitMarks = Vec_StrAlloc( 1000 );
+    p->vBlocks    = Vec_StrAlloc( 1000 );
+    p->iFrameFail = ABC_INFINITY;
+    p->iOutFail   = ABC_INFINITY;
+    p->clkStart   = Abc_Clock();
+    p->Deadline   = pPars->nTimeOut ? p->clkStart + (abctime)pPars->nTimeOut * CLOCKS_PER_SEC : 0;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    Bmct_ManBuildTemplate( p );
+    return p;
+}
+void Bmct_ManStop( Bmct_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    Vec_IntFree( p->vSlots );
+    Vec_IntFree( p->vClaLits );
+    Vec_IntFree( p->vClaBegs );
+    Vec_WecFree( p->vUnits );
+    Vec_StrFree( p->vUnitMarks );
+    Vec_StrFree( p->vBlocks );
+    if ( p->pCex )
+        Abc_CexFree( p->pCex );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the next frame to the solver of the thread.]
+
+  Description [The frame is the template with the literals shifted. The
+  first call also adds the initial state.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmct_ThrAddFrame( Bmct_Thr_t * pThr )
+{
+    Bmct_Man_t * p = pThr->p;
+    int * pLits, * pBegs = Vec_IntArray( p->vClaBegs );
+    int i, Lit, nRegs = Gia_ManRegNum(p->pGia);
+    int Shift = 2 * pThr->nFrames * p->nFrameVars;
+    sat_solver_setnvars( pThr->pSat, (pThr->nFrames + 1) * p->nFrameVars + nRegs );
+    if ( pThr->nFrames == 0 )
+        for ( i = 0; i < nRegs; i++ )
+        {
+            Lit = Abc_Var2Lit( i, 1 );
+            if ( !sat_solver_addclause( pThr->pSat, &Lit, &Lit + 1 ) )
+                assert( 0 );
+        }
+    Vec_IntClear( pThr->vTemp );
+    Vec_IntAppend( pThr->vTemp, p->vClaLits );
+    pLits = Vec_IntArray( pThr->vTemp );
+    for ( i = 0; i < Vec_IntSize(pThr->vTemp); i++ )
+        pLits[i] += Shift;
+    for ( i = 0; i + 1 < Vec_IntSize(p->vClaBegs); i++ )
+        if ( !sat_solver_addclause( pThr->pSat, pLits + pBegs[i], pLits + pBegs[i+1] ) )
+            assert( 0 );
+    pThr->nFrames++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exchanges root-level units with other threads.]
+
+  Description [Exports the root-level literals of the solver that are
+  not yet shared. Imports the shared units over the variables of the
+  frames present in the solver.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmct_ThrExchange( Bmct_Thr_t * pThr )
+{
+    Bmct_Man_t * p = pThr->p;
+    sat_solver * pSat = pThr->pSat;
+    Vec_Int_t * vLevel;
+    int i, k, f, Lit, iVar;
+    BMCT_LOCK( p );
+    for ( i = pThr->iTrail; i < pSat->qtail; i++ )
+    {
+        Lit  = pSat->trail[i];
+        iVar = Abc_Lit2Var( Lit );
+        if ( Vec_StrGetEntry(p->vUnitMarks, iVar) )
+            continue;
+        Vec_StrSetEntry( p->vUnitMarks, iVar, 1 );
+        Vec_WecPush( p->vUnits, iVar / p->nFrameVars, Lit );
+        p->nUnits++;
+    }
+    pThr->iTrail = pSat->qtail;
+    Vec_IntClear( pThr->vTemp );
+    Vec_IntFillExtra( pThr->vCursors, pThr->nFrames, 0 );
+    for ( f = 0; f < pThr->nFrames && f < Vec_WecSize(p->vUnits); f++ )
+    {
+        vLevel = Vec_WecEntry( p->vUnits, f );
+        Vec_IntForEachEntryStart( vLevel, Lit, k, Vec_IntEntry(pThr->vCursors, f) )
+            Vec_IntPush( pThr->vTemp, Lit );
+        Vec_IntWriteEntry( pThr->vCursors, f, Vec_IntSize(vLevel) );
+    }
+    BMCT_UNLOCK( p );
+    Vec_IntForEachEntry( pThr->vTemp, Lit, i )
+        if ( !sat_solver_addclause( pSat, &Lit, &Lit + 1 ) )
+            assert( 0 );
+    pThr->nImported += Vec_IntSize(pThr->vTemp);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks one output in one frame.]
+
+  Description [The solver is called with a limited number of conflicts,
+  so that the units can be exchanged and the termination conditions can
+  be checked between the calls.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmct_ThrSolve( Bmct_Thr_t * pThr, int f, int i )
+{
+    Bmct_Man_t * p = pThr->p;
+    int Lit = Bmct_ManOutLit( p, f, i );
+    int status, nConfStart = sat_solver_nconflicts( pThr->pSat );
+    while ( 1 )
+    {
+        status = sat_solver_solve( pThr->pSat, &Lit, &Lit + 1, BMCT_CONF_CHUNK, 0, 0, 0 );
+        if ( status != l_Undef )
+            return status;
+        if ( p->fStop || f > p->iFrameFail )
+            return l_Undef;
+        if ( p->Deadline && Abc_Clock() > p->Deadline )
+            return l_Undef;
+        if ( p->pPars->nConfLimit && sat_solver_nconflicts(pThr->pSat) - nConfStart >= p->pPars->nConfLimit )
+            return l_Undef;
+        Bmct_ThrExchange( pThr );
+    }
+    return l_Undef;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example from the satisfying assignment.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Bmct_ThrDeriveCex( Bmct_Thr_t * pThr, int f, int i )
+{
+    Bmct_Man_t * p = pThr->p;
+    Gia_Man_t * pGia = p->pGia;
+    Abc_Cex_t * pCex = Abc_CexMakeTriv( Gia_ManRegNum(pGia), Gia_ManPiNum(pGia), Gia_ManPoNum(pGia), f*Gia_ManPoNum(pGia)+i );
+    Gia_Obj_t * pObj; int k, iFrame;
+    for ( iFrame = 0; iFrame <= f; iFrame++ )
+        Gia_ManForEachPi( pGia, pObj, k )
+            if ( sat_solver_var_value(pThr->pSat, iFrame * p->nFrameVars + Vec_IntEntry(p->vSlots, Gia_ObjId(pGia, pObj))) )
+                Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(pGia) + iFrame * Gia_ManPiNum(pGia) + k );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records that the block is checked.]
+
+  Description [Reports the frames checked in a row.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmct_ManBlockDone( Bmct_Man_t * p, int b, int iThread )
+{
+    int f, i;
+    BMCT_LOCK( p );
+    Vec_StrSetEntry( p->vBlocks, b, (char)(1 + iThread) );
+    while ( Vec_StrGetEntry(p->vBlocks, p->nBlocksDone) )
+    {
+        int iThreadDone = Vec_StrEntry(p->vBlocks, p->nBlocksDone) - 1;
+        for ( f = Bmct_ManBlockBeg(p, p->nBlocksDone); f < Bmct_ManBlockEnd(p, p->nBlocksDone); f++ )
+        {
+            if ( p->pPars->pFuncOnFrameDone )
+                for ( i = 0; i < Gia_ManPoNum(p->pGia); i++ )
+                    p->pPars->pFuncOnFrameDone( f, i, 0 );
+            if ( p->pPars->fVerbose )
+            {
+                Abc_Print( 1, "%4d + : ",       f );
+                Abc_Print( 1, "Var =%8.0f.  ",  (double)(f + 1) * p->nFrameVars );
+                Abc_Print( 1, "Units =%8d.  ",  p->nUnits );
+                if ( p->pPars->nProcs > 1 )
+                    Abc_Print( 1, "S = %3d. ",  iThreadDone );
+                Abc_Print( 1, "%9.2f sec\n",    (float)(Abc_Clock() - p->clkStart)/(float)(CLOCKS_PER_SEC) );
+                fflush( stdout );
+            }
+        }
+        p->nFramesDone = Bmct_ManBlockEnd( p, p->nBlocksDone++ );
+    }
+    BMCT_UNLOCK( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the blocks of frames claimed by one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmct_ManWorker( void * pArg )
+{
+    Bmct_Thr_t * pThr = (Bmct_Thr_t *)pArg;
+    Bmct_Man_t * p = pThr->p;
+    Bmc_AndPar_t * pPars = p->pPars;
+    int b, f, i, fBeg, fEnd, status, Lit;
+    while ( 1 )
+    {
+        BMCT_LOCK( p );
+        b = p->nBlocksNext++;
+        BMCT_UNLOCK( p );
+        fBeg = Bmct_ManBlockBeg( p, b );
+        fEnd = Bmct_ManBlockEnd( p, b );
+        if ( fBeg >= fEnd || p->fStop || fBeg > p->iFrameFail )
+            return 1;
+        while ( pThr->nFrames < fEnd )
+            Bmct_ThrAddFrame( pThr );
+        Bmct_ThrExchange( pThr );
+        for ( f = fBeg; f < fEnd; f++ )
+        for ( i = 0; i < Gia_ManPoNum(p->pGia); i++ )
+        {
+            if ( p->fStop || f > p->iFrameFail )
+                return 1;
+            if ( pPars->pFuncProgress && pPars->pFuncProgress( pPars->pProgress, 0, 0 ) )
+            {
+                p->fStop = 1;
+                return 1;
+            }
+            status = Bmct_ThrSolve( pThr, f, i );
+            if ( status == l_False )
+            {
+                Lit = Abc_LitNot( Bmct_ManOutLit(p, f, i) );
+                if ( !sat_solver_addclause( pThr->pSat, &Lit, &Lit + 1 ) )
+                    assert( 0 );
+                continue;
+            }
+            if ( status == l_True )
+            {
+                BMCT_LOCK( p );
+                if ( f < p->iFrameFail || (f == p->iFrameFail && i < p->iOutFail) )
+                {
+                    if ( p->pCex )
+                        Abc_CexFree( p->pCex );
+                    p->pCex = Bmct_ThrDeriveCex( pThr, f, i );
+                    p->iFrameFail = f;
+                    p->iOutFail = i;
+                }
+                BMCT_UNLOCK( p );
+                return 1;
+            }
+            if ( f < p->iFrameFail )
+                p->fStop = 1;
+            return 1;
+        }
+        Bmct_ThrExchange( pThr );
+        Bmct_ManBlockDone( p, b, pThr->iThread );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs BMC using the CNF template of one frame.]
+
+  Description [Uses pPars->nProcs threads, each checking blocks of
+  pPars->nFramesAdd frames. Returns 0 if an output fails, and -1 if it
+  is undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmct_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    Bmct_Man_t * p;
+    Bmct_Thr_t * pThrs;
+    Util_PoolGroup_t * pGroup;
+    int i, nImported = 0, RetValue = -1, nProcs = Abc_MaxInt( pPars->nProcs, 1 );
+    assert( Gia_ManRegNum(pGia) > 0 );
+    Abc_CexFreeP( &pGia->pCexSeq );
+    if ( pPars->pFuncProgress && pPars->pFuncProgress( pPars->pProgress, 0, 0 ) )
+        return -1;
+    p = Bmct_ManStart( pGia, pPars );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "CNF template: Vars = %d. Clauses = %d. Literals = %d. Threads = %d.  ",
+            p->nFrameVars, Vec_IntSize(p->vClaBegs) - 1, Vec_IntSize(p->vClaLits), nProcs );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
+    }
+    pThrs = ABC_CALLOC( Bmct_Thr_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThrs[i].p        = p;
+        pThrs[i].pSat     = sat_solver_new();
+        pThrs[i].iThread  = i;
+        pThrs[i].vCursors = Vec_IntAlloc( 1000 );
+        pThrs[i].vTemp    = Vec_IntAlloc( Vec_IntSize(p->vClaLits) );
+        if ( p->Deadline )
+            sat_solver_set_runtime_limit( pThrs[i].pSat, p->Deadline );
+    }
+    fflush( stdout );
+    pGroup = Util_PoolGroupStart( nProcs, 0 );
+    for ( i = 0; i < nProcs; i++ )
+        Util_PoolGroupAdd( pGroup, Bmct_ManWorker, pThrs + i );
+    Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        nImported += pThrs[i].nImported;
+        sat_solver_delete( pThrs[i].pSat );
+        Vec_IntFree( pThrs[i].vCursors );
+        Vec_IntFree( pThrs[i].vTemp );
+    }
+    ABC_FREE( pThrs );
+    if ( p->pCex )
+    {
+        RetValue = 0;
+        pPars->iFrame = p->iFrameFail;
+        pPars->nFailOuts++;
+        pGia->pCexSeq = p->pCex;  p->pCex = NULL;
+        if ( !pPars->fNotVerbose )
+        {
+            int nOutDigits = Abc_Base10Log( Gia_ManPoNum(pGia) );
+            Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).  ",
+                nOutDigits, p->iOutFail, p->iFrameFail, nOutDigits, pPars->nFailOuts, nOutDigits, Gia_ManPoNum(pGia) );
+        }
+    }
+    else
+    {
+        pPars->iFrame = Abc_MaxInt( p->nFramesDone - 1, 0 );
+        if ( !pPars->fNotVerbose )
+            Abc_Print( 1, "No output failed in %d frames.  ", p->nFramesDone );
+    }
+    if ( !pPars->fNotVerbose )
+        Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Units shared = %d. Units imported = %d.\n", p->nUnits, nImported );
+    Bmct_ManStop( p );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
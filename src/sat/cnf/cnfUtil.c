@@ -27,16 +27,6 @@
 #include <unistd.h>
 #endif
 
-#ifdef ABC_USE_PTHREADS
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#endif
-
-#endif
-
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -129,114 +119,63 @@ Vec_Int_t * Cnf_RunSolverArray(int nProcs, int TimeOut, int fVerbose)
   SeeAlso     []
 
 ***********************************************************************/
-#ifndef ABC_USE_PTHREADS
-
-Vec_Int_t *Cnf_RunSolver(int nProcs, int TimeOut, int fVerbose)
-{
-    return Cnf_RunSolverArray(nProcs, TimeOut, fVerbose);
-}
-
-#else // pthreads are used
-
-#define PAR_THR_MAX 100
 typedef struct Cnf_ThData_t_
 {
     Vec_Int_t *vRes;
     int Index;
     int Rand;
     int nTimeOut;
-    int fWorking;
     int fVerbose;
+    Util_PoolGroup_t *pGroup;
 } Cnf_ThData_t;
 
-void *Cnf_WorkerThread(void *pArg)
+int Cnf_WorkerTask(void *pArg)
 {
     Cnf_ThData_t *pThData = (Cnf_ThData_t *)pArg;
-    volatile int *pPlace = &pThData->fWorking;
-    while (1)
-    {
-        while (*pPlace == 0)
-            ;
-        assert(pThData->fWorking);
-        if (pThData->Index == -1)
-        {
-            pthread_exit(NULL);
-            assert(0);
-            return NULL;
-        }
-        pThData->vRes = Cnf_RunSolverOnce(pThData->Index, pThData->Rand, pThData->nTimeOut, pThData->fVerbose);
-        pThData->fWorking = 0;
-    }
-    assert(0);
-    return NULL;
+    pThData->vRes = Cnf_RunSolverOnce(pThData->Index, pThData->Rand, pThData->nTimeOut, pThData->fVerbose);
+    // the problems not yet started are skipped after the first solution
+    if (pThData->vRes)
+        Util_PoolGroupCancel(pThData->pGroup);
+    return pThData->vRes != NULL;
 }
 
 Vec_Int_t *Cnf_RunSolver(int nProcs, int TimeOut, int fVerbose)
 {
     Vec_Int_t *vRes = NULL;
-    Cnf_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
-    int i, k, status;
+    Cnf_ThData_t *pThData;
+    Util_PoolGroup_t *pGroup;
+    int i;
     if (fVerbose)
         printf("Running concurrent solving with %d processes.\n", nProcs);
     fflush(stdout);
     if (nProcs < 2)
         return Cnf_RunSolverArray(nProcs, TimeOut, fVerbose);
-    // subtract manager thread
-    // nProcs--;
-    assert(nProcs >= 1 && nProcs <= PAR_THR_MAX);
-    // start threads
+    pThData = ABC_CALLOC(Cnf_ThData_t, nProcs);
+    pGroup = Util_PoolGroupStart(nProcs + 1, 0);
     for (i = 0; i < nProcs; i++)
     {
-        ThData[i].vRes     = NULL;
-        ThData[i].Index    = -1;
-        ThData[i].Rand     = Abc_Random(0) % 0x1000000;
-        ThData[i].nTimeOut = TimeOut;
-        ThData[i].fWorking = 0;
-        ThData[i].fVerbose = fVerbose;
-        status = pthread_create(WorkerThread + i, NULL, Cnf_WorkerThread, (void *)(ThData + i));
-        assert(status == 0);
+        pThData[i].Index    = i;
+        pThData[i].Rand     = Abc_Random(0) % 0x1000000;
+        pThData[i].nTimeOut = TimeOut;
+        pThData[i].fVerbose = fVerbose;
+        pThData[i].pGroup   = pGroup;
+        Util_PoolGroupAdd(pGroup, Cnf_WorkerTask, pThData + i);
     }
-    // look at the threads
-    for (k = 0; k < nProcs;)
-    {
-        for (i = 0; i < nProcs; i++)
-        {
-            if (ThData[i].fWorking)
-                continue;
-            if (ThData[i].vRes)
-            {
-                k = nProcs;
-                break;
-            }
-            ThData[i].Index = k++;
-            ThData[i].fWorking = 1;
-            break;
-        }
-    }
-    // wait till threads finish
-    for (i = 0; i < nProcs; i++)
-        if (ThData[i].fWorking)
-            i = -1;
-    // stop threads
+    Util_PoolGroupWait(pGroup);
+    Util_PoolGroupStop(pGroup);
     for (i = 0; i < nProcs; i++)
     {
-        assert(!ThData[i].fWorking);
-        if (ThData[i].vRes && vRes == NULL)
+        if (pThData[i].vRes && vRes == NULL)
         {
-            vRes = ThData[i].vRes;
-            ThData[i].vRes = NULL;
+            vRes = pThData[i].vRes;
+            pThData[i].vRes = NULL;
         }
-        Vec_IntFreeP(&ThData[i].vRes);
-        // stop
-        ThData[i].Index = -1;
-        ThData[i].fWorking = 1;
+        Vec_IntFreeP(&pThData[i].vRes);
     }
+    ABC_FREE(pThData);
     return vRes;
 }
 
-#endif // pthreads are used
-
 
 
 /**Function*************************************************************
@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 
 #include "aig/gia/gia.h"
+#include "map/if/if.h"
+#include "proof/cec/cec.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -79,4 +81,595 @@ TEST(GiaTest, GiaCollectFanoutInfo) {
     Gia_ManStop(giaMan);
 }
 
+/*!
+  \brief Concurrent structural hashing finds the existing gates and rehashing with threads removes duplicated logic.
+*/
+TEST(GiaTest, GiaHashMtAnd) {
+    Gia_Man_t * giaMan = Gia_ManStart(100);
+    int input1 = Gia_ManAppendCi(giaMan);
+    int input2 = Gia_ManAppendCi(giaMan);
+    int input3 = Gia_ManAppendCi(giaMan);
+    // two copies of the same logic
+    int aOut0 = Gia_ManAppendAnd(giaMan, input1, input2);
+    int aOut1 = Gia_ManAppendAnd(giaMan, aOut0, input3);
+    int aOut2 = Gia_ManAppendAnd(giaMan, input2, input1);
+    int aOut3 = Gia_ManAppendAnd(giaMan, input3, aOut2);
+    Gia_ManAppendCo(giaMan, aOut1);
+    Gia_ManAppendCo(giaMan, aOut3);
+    EXPECT_EQ(Gia_ManAndNum(giaMan), 4);
+
+    Gia_Man_t * giaNew = Gia_ManRehashMt(giaMan, 4);
+    EXPECT_EQ(Gia_ManAndNum(giaNew), 2);
+    EXPECT_EQ(Gia_ObjFaninLit0p(giaNew, Gia_ManCo(giaNew, 0)), Gia_ObjFaninLit0p(giaNew, Gia_ManCo(giaNew, 1)));
+
+    Gia_HashMt_t * pHash = Gia_ManHashMtStart(giaNew, 100);
+    int iLit = Gia_ManHashMtAnd(pHash, Abc_Var2Lit(1, 0), Abc_Var2Lit(2, 0));
+    EXPECT_EQ(iLit, Abc_Var2Lit(4, 0));
+    EXPECT_EQ(Gia_ManAndNum(giaNew), 2);
+    EXPECT_EQ(Gia_ManHashMtAnd(pHash, Abc_Var2Lit(2, 0), Abc_Var2Lit(1, 0)), iLit);
+    EXPECT_EQ(Gia_ManHashMtAnd(pHash, iLit, Abc_LitNot(iLit)), 0);
+    int iLitNew = Gia_ManHashMtAnd(pHash, Abc_Var2Lit(1, 1), Abc_Var2Lit(2, 0));
+    EXPECT_EQ(Abc_Lit2Var(iLitNew), Gia_ManObjNum(giaNew) - 1);
+    Gia_ManHashMtStop(pHash);
+
+    Gia_ManStop(giaNew);
+    Gia_ManStop(giaMan);
+}
+
+/*!
+  \brief A new manager reuses the cleaned object array and hash tables freed by the previous manager of a similar size.
+*/
+TEST(GiaTest, GiaRecycleObjs) {
+    Gia_ManRecycleStop();
+    int nReused = Gia_ManRecycleReuseNum();
+    Gia_Man_t * giaMan = Gia_ManStart(100000);
+    Gia_ManHashAlloc(giaMan);
+    Gia_ManHashAnd(giaMan, Gia_ManAppendCi(giaMan), Gia_ManAppendCi(giaMan));
+    Gia_ManObj(giaMan, 1)->Value = 1;
+    Gia_ManStop(giaMan);
+    // the next manager of a similar size takes the arrays freed by the previous one
+    giaMan = Gia_ManStart(90000);
+    EXPECT_EQ(Gia_ManRecycleReuseNum(), nReused + 1);
+    EXPECT_EQ(Gia_ManObj(giaMan, 0)->Value, 0);
+    EXPECT_EQ(giaMan->pObjs[1].Value, 0);
+    Gia_ManHashAlloc(giaMan);
+    EXPECT_EQ(Gia_ManRecycleReuseNum(), nReused + 3);
+    int iLit0 = Gia_ManAppendCi(giaMan);
+    int iLit1 = Gia_ManAppendCi(giaMan);
+    int iAnd = Gia_ManHashAnd(giaMan, iLit0, iLit1);
+    EXPECT_EQ(iAnd, Abc_Var2Lit(3, 0));
+    EXPECT_EQ(Gia_ManHashAnd(giaMan, iLit1, iLit0), iAnd);
+    Gia_ManStop(giaMan);
+    Gia_ManRecycleStop();
+}
+
+/*!
+  \brief The arrays freed beyond the size limit of the recycled memory are returned to the system.
+*/
+TEST(GiaTest, GiaRecycleLimit) {
+    size_t nBytes = (size_t)1 << 26;
+    Gia_ManRecycleStop();
+    EXPECT_EQ(Gia_ManRecycleByteNum(), (size_t)0);
+    for ( int i = 0; i < 8; i++ ) {
+        Gia_ManRecycleFree(ABC_ALLOC(char, nBytes), nBytes);
+        EXPECT_LE(Gia_ManRecycleByteNum(), (size_t)(i + 1) * nBytes);
+    }
+    EXPECT_LT(Gia_ManRecycleByteNum(), 8 * nBytes);
+    // the arrays that were kept can still be reused
+    int nReused = Gia_ManRecycleReuseNum();
+    size_t nBytesAll = Gia_ManRecycleByteNum();
+    void * pArray = Gia_ManRecycleAlloc(nBytes, 0);
+    EXPECT_EQ(Gia_ManRecycleReuseNum(), nReused + 1);
+    EXPECT_EQ(Gia_ManRecycleByteNum(), nBytesAll - nBytes);
+    Gia_ManRecycleFree(pArray, nBytes);
+    EXPECT_EQ(Gia_ManRecycleByteNum(), nBytesAll);
+    Gia_ManRecycleStop();
+    EXPECT_EQ(Gia_ManRecycleByteNum(), (size_t)0);
+}
+
+/*!
+  \brief The structure-of-arrays view has the same fanins as the AIG, and its marks can be synchronized with the AIG.
+*/
+TEST(GiaTest, GiaSoaView) {
+    char fileName[200];
+    strcpy(fileName, ASSETS_DIR);
+    strcat(fileName, "data/i10Samples/i10_SpId_0.aig");
+    Gia_Man_t * giaMan = Gia_AigerRead( fileName, 0, 0, 0 );
+    ASSERT_TRUE(giaMan != nullptr);
+    Gia_Soa_t * pSoa = Gia_SoaStart(giaMan);
+    EXPECT_EQ(pSoa->nAnds, Gia_ManAndNum(giaMan));
+
+    Gia_Obj_t * pObj;
+    int i, k = 0;
+    Gia_ManForEachAnd( giaMan, pObj, i ) {
+        EXPECT_EQ(pSoa->pAnds[k++], i);
+        EXPECT_TRUE(Gia_SoaIsAnd(pSoa, i));
+        EXPECT_EQ(pSoa->pFan0[i], Gia_ObjFaninLit0(pObj, i));
+        EXPECT_EQ(pSoa->pFan1[i], Gia_ObjFaninLit1(pObj, i));
+    }
+    Gia_ManForEachCo( giaMan, pObj, i ) {
+        EXPECT_TRUE(Gia_SoaIsCo(pSoa, Gia_ObjId(giaMan, pObj)));
+        EXPECT_EQ(pSoa->pFan0[Gia_ObjId(giaMan, pObj)], Gia_ObjFaninLit0p(giaMan, pObj));
+    }
+
+    Gia_SoaSetMark0(pSoa, 1);
+    Gia_SoaSaveMarks(pSoa);
+    EXPECT_EQ(Gia_ManObj(giaMan, 1)->fMark0, 1);
+    Gia_ManCleanMark0(giaMan);
+    Gia_SoaLoadMarks(pSoa);
+    EXPECT_EQ(Gia_SoaMark0(pSoa, 1), 0);
+
+    Gia_SoaStop(pSoa);
+    Gia_ManStop(giaMan);
+}
+
+/*!
+  \brief The levels, the reference counters and the simulation computed on the structure-of-arrays view are the same as those computed on the AIG.
+*/
+TEST(GiaTest, GiaSoaKernels) {
+    // an AIG with XOR nodes and dangling nodes
+    Gia_Man_t * giaMan = Gia_ManStart(1000);
+    Vec_Int_t * vLits = Vec_IntAlloc(100);
+    for ( int i = 0; i < 16; i++ )
+        Vec_IntPush(vLits, Gia_ManAppendCi(giaMan));
+    for ( int i = 0; i < 200; i++ ) {
+        int iLit0 = Abc_LitNotCond(Vec_IntEntry(vLits, Vec_IntSize(vLits) - 1 - (i * 7) % 16), i & 1);
+        int iLit1 = Abc_LitNotCond(Vec_IntEntry(vLits, Vec_IntSize(vLits) - 2 - (i * 5) % 15), (i >> 1) & 1);
+        if ( Abc_Lit2Var(iLit0) == Abc_Lit2Var(iLit1) )
+            continue;
+        Vec_IntPush(vLits, i % 3 ? Gia_ManAppendAnd(giaMan, iLit0, iLit1) : Gia_ManAppendXorReal(giaMan, iLit0, iLit1));
+    }
+    for ( int i = 0; i < 8; i++ )
+        Gia_ManAppendCo(giaMan, Vec_IntEntry(vLits, 16 + 20 * i));
+    Vec_IntFree(vLits);
+    ASSERT_GT(Gia_ManXorNum(giaMan), 0);
+
+    Gia_Soa_t * pSoa = Gia_SoaStart(giaMan);
+    int nLevels = Gia_ManLevelNum(giaMan);
+    Vec_Int_t * vLevels = Vec_IntDup(giaMan->vLevels);
+    EXPECT_EQ(Gia_SoaLevelNum(pSoa), nLevels);
+    EXPECT_TRUE(Vec_IntEqual(giaMan->vLevels, vLevels));
+    Vec_IntFree(vLevels);
+
+    Gia_ManCreateRefs(giaMan);
+    int * pRefs = giaMan->pRefs;
+    giaMan->pRefs = NULL;
+    Gia_SoaCreateRefs(pSoa);
+    EXPECT_EQ(memcmp(giaMan->pRefs, pRefs, sizeof(int) * Gia_ManObjNum(giaMan)), 0);
+    ABC_FREE(pRefs);
+
+    // two words are simulated by the loop over Gia_Obj_t
+    Vec_Wrd_t * vSimsPi = Vec_WrdStartRandom(Gia_ManCiNum(giaMan) * 2);
+    Vec_Wrd_t * vSims = Gia_ManSimPatSimOut(giaMan, vSimsPi, 0);
+    Vec_Wrd_t * vSimsSoa = Gia_SoaSimPatSim(pSoa, vSimsPi, 1);
+    EXPECT_TRUE(Vec_WrdEqual(vSims, vSimsSoa));
+    Vec_WrdFree(vSims);
+    Vec_WrdFree(vSimsSoa);
+    Vec_WrdFree(vSimsPi);
+    Gia_SoaStop(pSoa);
+    Gia_ManStop(giaMan);
+}
+
+/*!
+  \brief Simulation with the pattern words split among threads gives the same values as the scalar simulation.
+*/
+TEST(GiaTest, GiaSimPatSimMt) {
+    char fileName[200];
+    strcpy(fileName, ASSETS_DIR);
+    strcat(fileName, "data/i10Samples/i10_SpId_0.aig");
+    Gia_Man_t * giaMan = Gia_AigerRead( fileName, 0, 0, 0 );
+    ASSERT_TRUE(giaMan != nullptr);
+    // the number of words is not divisible by the vector width to check the remainders
+    int nWords = 37;
+    Vec_Wrd_t * vSimsPi = Vec_WrdStartRandom(Gia_ManCiNum(giaMan) * nWords);
+    Vec_Wrd_t * vSims = Vec_WrdStart(Gia_ManObjNum(giaMan) * nWords);
+    Gia_Obj_t * pObj;
+    int i, w;
+    Gia_ManForEachCi( giaMan, pObj, i )
+        memcpy(Vec_WrdEntryP(vSims, Gia_ObjId(giaMan, pObj) * nWords), Vec_WrdEntryP(vSimsPi, i * nWords), sizeof(word) * nWords);
+    Gia_ManForEachAnd( giaMan, pObj, i )
+        for ( w = 0; w < nWords; w++ )
+            Vec_WrdWriteEntry(vSims, i * nWords + w,
+                (Vec_WrdEntry(vSims, Gia_ObjFaninId0(pObj, i) * nWords + w) ^ ((word)0 - Gia_ObjFaninC0(pObj))) &
+                (Vec_WrdEntry(vSims, Gia_ObjFaninId1(pObj, i) * nWords + w) ^ ((word)0 - Gia_ObjFaninC1(pObj))));
+    Gia_ManForEachCo( giaMan, pObj, i )
+        for ( w = 0; w < nWords; w++ )
+            Vec_WrdWriteEntry(vSims, Gia_ObjId(giaMan, pObj) * nWords + w,
+                Vec_WrdEntry(vSims, Gia_ObjFaninId0p(giaMan, pObj) * nWords + w) ^ ((word)0 - Gia_ObjFaninC0(pObj)));
+    Vec_Wrd_t * vSims1 = Gia_ManSimPatSimMt(giaMan, vSimsPi, 1);
+    Vec_Wrd_t * vSims4 = Gia_ManSimPatSimMt(giaMan, vSimsPi, 4);
+    EXPECT_TRUE(Vec_WrdEqual(vSims, vSims1));
+    EXPECT_TRUE(Vec_WrdEqual(vSims, vSims4));
+    Vec_WrdFree(vSims);
+    Vec_WrdFree(vSims1);
+    Vec_WrdFree(vSims4);
+    Vec_WrdFree(vSimsPi);
+    Gia_ManStop(giaMan);
+}
+
+/*!
+  \brief Simulation of an AIG with XOR nodes through the pattern slices gives the same outputs as the simulation of the AIG where XORs are expanded into ANDs.
+*/
+TEST(GiaTest, GiaSimPatSimXor) {
+    Gia_Man_t * giaMan = Gia_ManStart(1000);
+    Vec_Int_t * vLits = Vec_IntAlloc(100);
+    for ( int i = 0; i < 16; i++ )
+        Vec_IntPush(vLits, Gia_ManAppendCi(giaMan));
+    for ( int i = 0; i < 200; i++ ) {
+        int iLit0 = Abc_LitNotCond(Vec_IntEntry(vLits, Vec_IntSize(vLits) - 1 - (i * 7) % 16), i & 1);
+        int iLit1 = Abc_LitNotCond(Vec_IntEntry(vLits, Vec_IntSize(vLits) - 2 - (i * 5) % 15), (i >> 1) & 1);
+        if ( Abc_Lit2Var(iLit0) == Abc_Lit2Var(iLit1) )
+            continue;
+        Vec_IntPush(vLits, i % 3 ? Gia_ManAppendXorReal(giaMan, iLit0, iLit1) : Gia_ManAppendAnd(giaMan, iLit0, iLit1));
+    }
+    for ( int i = 0; i < 8; i++ )
+        Gia_ManAppendCo(giaMan, Vec_IntEntry(vLits, Vec_IntSize(vLits) - 1 - i));
+    Vec_IntFree(vLits);
+    ASSERT_GT(Gia_ManXorNum(giaMan), 0);
+    Gia_Man_t * giaAnd = Gia_ManDupNoMuxes(giaMan, 0);
+    EXPECT_EQ(Gia_ManXorNum(giaAnd), 0);
+
+    Vec_Wrd_t * vSimsPi = Vec_WrdStartRandom(Gia_ManCiNum(giaMan) * 9);
+    Vec_Wrd_t * vSims = Gia_ManSimPatSimOut(giaMan, vSimsPi, 1);
+    Vec_Wrd_t * vSimsAnd = Gia_ManSimPatSimOut(giaAnd, vSimsPi, 1);
+    EXPECT_TRUE(Vec_WrdEqual(vSims, vSimsAnd));
+    Vec_Wrd_t * vSims4 = Gia_ManSimPatSimMt(giaMan, vSimsPi, 4);
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManForEachCo( giaMan, pObj, i )
+        EXPECT_EQ(memcmp(Vec_WrdEntryP(vSims4, Gia_ObjId(giaMan, pObj) * 9), Vec_WrdEntryP(vSimsAnd, i * 9), sizeof(word) * 9), 0);
+    Vec_WrdFree(vSims);
+    Vec_WrdFree(vSims4);
+    Vec_WrdFree(vSimsAnd);
+    Vec_WrdFree(vSimsPi);
+    Gia_ManStop(giaAnd);
+    Gia_ManStop(giaMan);
+}
+
+TEST(GiaTest, GiaSimIncPropagate) {
+    char fileName[200];
+    strcpy(fileName, ASSETS_DIR);
+    strcat(fileName, "data/i10Samples/i10_SpId_0.aig");
+    Gia_Man_t * giaMan = Gia_AigerRead( fileName, 0, 0, 0 );
+    ASSERT_TRUE(giaMan != nullptr);
+    int nCis = Gia_ManCiNum(giaMan), nWords = 8;
+    Vec_Wrd_t * vSimsPi = Vec_WrdStartRandom(nCis * nWords);
+    Gia_SimInc_t * pSim = Gia_SimIncStart(giaMan, vSimsPi);
+    // flip a few bits in the patterns and propagate the changes
+    for ( int i = 0; i < 5; i++ )
+    {
+        int iCi = (7 * i) % nCis, iPat = 100 * i + 3;
+        Gia_SimIncFlipCiBit(pSim, iCi, iPat);
+        *Vec_WrdEntryP(vSimsPi, iCi * nWords + (iPat >> 6)) ^= (word)1 << (iPat & 63);
+    }
+    EXPECT_GT(Gia_SimIncPropagate(pSim, NULL), 0);
+    EXPECT_LT(Gia_SimIncUpdateNum(pSim), Gia_ManObjNum(giaMan));
+    Vec_Wrd_t * vSims = Gia_ManSimPatSimOut(giaMan, vSimsPi, 0);
+    EXPECT_TRUE(Vec_WrdEqual(vSims, Gia_SimIncSims(pSim)));
+    Vec_WrdFree(vSims);
+    // append new words and compare with the simulation of all words
+    Vec_Wrd_t * vSimsPiNew = Vec_WrdStartRandom(nCis * 4);
+    Vec_Wrd_t * vSimsPiAll = Vec_WrdAlloc(nCis * (nWords + 4));
+    for ( int i = 0; i < nCis; i++ )
+    {
+        Vec_WrdPushArray(vSimsPiAll, Vec_WrdEntryP(vSimsPi, i * nWords), nWords);
+        Vec_WrdPushArray(vSimsPiAll, Vec_WrdEntryP(vSimsPiNew, i * 4), 4);
+    }
+    Gia_SimIncAppend(pSim, vSimsPiNew, NULL);
+    EXPECT_EQ(Gia_SimIncWordNum(pSim), nWords + 4);
+    vSims = Gia_ManSimPatSimOut(giaMan, vSimsPiAll, 0);
+    EXPECT_TRUE(Vec_WrdEqual(vSims, Gia_SimIncSims(pSim)));
+    Vec_WrdFree(vSims);
+    Vec_WrdFree(vSimsPiAll);
+    Vec_WrdFree(vSimsPiNew);
+    Vec_WrdFree(vSimsPi);
+    Gia_SimIncStop(pSim);
+    Gia_ManStop(giaMan);
+}
+
+TEST(GiaTest, GiaSimIncSplit) {
+    Gia_Man_t * giaMan = Gia_ManStart(10);
+    int iA = Gia_ManAppendCi(giaMan);
+    int iB = Gia_ManAppendCi(giaMan);
+    int iC = Gia_ManAppendCi(giaMan);
+    int iAnd1 = Gia_ManAppendAnd(giaMan, iA, iB);
+    int iAnd2 = Gia_ManAppendAnd(giaMan, iA, iC);
+    Gia_ManAppendCo(giaMan, iAnd1);
+    Gia_ManAppendCo(giaMan, iAnd2);
+    // the two AND gates are candidate equivalences under the patterns where B == C
+    giaMan->pReprs = ABC_CALLOC(Gia_Rpr_t, Gia_ManObjNum(giaMan));
+    giaMan->pNexts = ABC_CALLOC(int, Gia_ManObjNum(giaMan));
+    for ( int i = 0; i < Gia_ManObjNum(giaMan); i++ )
+        Gia_ObjSetRepr(giaMan, i, GIA_VOID);
+    Gia_ObjSetRepr(giaMan, Abc_Lit2Var(iAnd2), Abc_Lit2Var(iAnd1));
+    Gia_ObjSetNext(giaMan, Abc_Lit2Var(iAnd1), Abc_Lit2Var(iAnd2));
+    Vec_Wrd_t * vSimsPi = Vec_WrdStart(3);
+    Vec_WrdWriteEntry(vSimsPi, 0, ~(word)0);
+    Vec_WrdWriteEntry(vSimsPi, 1, ABC_CONST(0xF0F0F0F0F0F0F0F0));
+    Vec_WrdWriteEntry(vSimsPi, 2, ABC_CONST(0xF0F0F0F0F0F0F0F0));
+    Gia_SimInc_t * pSim = Gia_SimIncStart(giaMan, vSimsPi);
+    Vec_Int_t * vSplit = Vec_IntAlloc(10);
+    // the bit of input B changes where input A is 1, so the class splits
+    Gia_SimIncFlipCiBit(pSim, 1, 0);
+    EXPECT_EQ(Gia_SimIncPropagate(pSim, vSplit), 3);
+    EXPECT_EQ(Vec_IntSize(vSplit), 1);
+    EXPECT_EQ(Vec_IntEntry(vSplit, 0), Abc_Lit2Var(iAnd1));
+    Vec_IntFree(vSplit);
+    Vec_WrdFree(vSimsPi);
+    Gia_SimIncStop(pSim);
+    Gia_ManStop(giaMan);
+}
+
+/*!
+  \brief Mapping the nodes of each level on several threads gives the same LUT mapping as the sequential mapper.
+*/
+TEST(GiaTest, GiaIfMappingMt) {
+    char fileName[200];
+    strcpy(fileName, ASSETS_DIR);
+    strcat(fileName, "data/i10Samples/i10_SpId_0.aig");
+    Vec_Int_t * vMappings[2];
+    int nLuts[2], nLevels[2];
+    for ( int i = 0; i < 2; i++ )
+    {
+        Gia_Man_t * giaMan = Gia_AigerRead( fileName, 0, 0, 0 );
+        ASSERT_TRUE(giaMan != nullptr);
+        If_Par_t Pars, * pPars = &Pars;
+        Gia_ManSetIfParsDefault( pPars );
+        pPars->nLutSize = 6;
+        pPars->nProcs   = i ? 4 : 1;
+        Gia_Man_t * giaMapped = Gia_ManPerformMapping( giaMan, pPars );
+        ASSERT_TRUE(Gia_ManHasMapping(giaMapped));
+        nLuts[i]     = Gia_ManLutNum(giaMapped);
+        nLevels[i]   = Gia_ManLutLevel(giaMapped, NULL);
+        vMappings[i] = Vec_IntDup(giaMapped->vMapping);
+        if ( giaMapped != giaMan )
+            Gia_ManStop(giaMapped);
+        Gia_ManStop(giaMan);
+    }
+    EXPECT_EQ(nLuts[0], nLuts[1]);
+    EXPECT_EQ(nLevels[0], nLevels[1]);
+    EXPECT_TRUE(Vec_IntEqual(vMappings[0], vMappings[1]));
+    Vec_IntFree(vMappings[0]);
+    Vec_IntFree(vMappings[1]);
+}
+
+/*!
+  \brief The vector versions of cut merging and dominance filtering give the same cuts and the same LUT mapping as the scalar versions.
+*/
+TEST(GiaTest, GiaIfCutSimd) {
+    int nBytes = sizeof(If_Cut_t) + sizeof(int) * IF_MAX_LUTSIZE;
+    If_Cut_t * pCut0 = (If_Cut_t *)calloc(1, nBytes);
+    If_Cut_t * pCut1 = (If_Cut_t *)calloc(1, nBytes);
+    If_Cut_t * pCuts[2] = { (If_Cut_t *)calloc(1, nBytes), (If_Cut_t *)calloc(1, nBytes) };
+    int fOld = If_CutSimdEnable(1);
+    srand(1);
+    for ( int r = 0; r < 10000; r++ )
+    {
+        // random ordered cuts with leaves from a small range, so that they often overlap
+        If_Cut_t * pCutsIn[2] = { pCut0, pCut1 };
+        for ( int c = 0; c < 2; c++ )
+        {
+            int nLeaves = 0;
+            for ( int v = 0; v < 16 && nLeaves < 8; v++ )
+                if ( rand() % 3 == 0 )
+                    pCutsIn[c]->pLeaves[nLeaves++] = v;
+            pCutsIn[c]->nLeaves = nLeaves;
+            pCutsIn[c]->nLimit  = 6 + rand() % 3;
+            pCutsIn[c]->uSign   = If_ObjCutSignCompute(pCutsIn[c]);
+        }
+        pCut1->nLimit = pCut0->nLimit;
+        int Res[2];
+        for ( int i = 0; i < 2; i++ )
+        {
+            If_CutSimdEnable(i);
+            Res[i] = If_CutMergeOrdered(NULL, pCut0, pCut1, pCuts[i]);
+        }
+        ASSERT_EQ(Res[0], Res[1]);
+        if ( Res[0] == 0 )
+            continue;
+        ASSERT_EQ(pCuts[0]->nLeaves, pCuts[1]->nLeaves);
+        for ( int v = 0; v < (int)pCuts[0]->nLeaves; v++ )
+            ASSERT_EQ(pCuts[0]->pLeaves[v], pCuts[1]->pLeaves[v]);
+        EXPECT_EQ(pCuts[0]->uSign, If_ObjCutSignCompute(pCuts[0]));
+    }
+    free(pCut0); free(pCut1); free(pCuts[0]); free(pCuts[1]);
+
+    char fileName[200];
+    strcpy(fileName, ASSETS_DIR);
+    strcat(fileName, "data/i10Samples/i10_SpId_0.aig");
+    Vec_Int_t * vMappings[2];
+    for ( int i = 0; i < 2; i++ )
+    {
+        If_CutSimdEnable(i);
+        Gia_Man_t * giaMan = Gia_AigerRead( fileName, 0, 0, 0 );
+        ASSERT_TRUE(giaMan != nullptr);
+        If_Par_t Pars, * pPars = &Pars;
+        Gia_ManSetIfParsDefault( pPars );
+        pPars->nLutSize = 6;
+        pPars->nCutsMax = 16;
+        Gia_Man_t * giaMapped = Gia_ManPerformMapping( giaMan, pPars );
+        vMappings[i] = Vec_IntDup(giaMapped->vMapping);
+        if ( giaMapped != giaMan )
+            Gia_ManStop(giaMapped);
+        Gia_ManStop(giaMan);
+    }
+    EXPECT_TRUE(Vec_IntEqual(vMappings[0], vMappings[1]));
+    Vec_IntFree(vMappings[0]);
+    Vec_IntFree(vMappings[1]);
+    If_CutSimdEnable(fOld);
+}
+
+/*!
+  \brief The DSD manager saved as a cache is loaded back with all its objects, the second save merges the objects of both managers.
+*/
+TEST(GiaTest, GiaIfDsdCache) {
+    char fileName[] = "_gia_dsd_cache_test.dsd";
+    unsigned char pPerm[16];
+    If_DsdMan_t * pDsd[2];
+    int nObjs[2];
+    remove(fileName);
+    srand(2);
+    for ( int i = 0; i < 2; i++ )
+    {
+        pDsd[i] = If_DsdManAlloc(6, 4);
+        for ( int k = 0; k < 200; k++ )
+        {
+            word Truth = ((word)rand() << 32) ^ ((word)rand() << 16) ^ (word)rand();
+            if ( Abc_TtSupportSize(&Truth, 6) == 6 )
+                If_DsdManCompute(pDsd[i], &Truth, 6, pPerm, NULL);
+        }
+        nObjs[i] = If_DsdManObjNum(pDsd[i]);
+    }
+    EXPECT_TRUE(If_DsdManCacheLoad(fileName, 6, 4, 0) == nullptr);
+    EXPECT_EQ(If_DsdManCacheSave(pDsd[0], fileName, 0), 1);
+    EXPECT_EQ(If_DsdManCacheSave(pDsd[0], fileName, 0), 0);
+    EXPECT_TRUE(If_DsdManCacheLoad(fileName, 6, 5, 0) == nullptr);
+    If_DsdMan_t * pLoaded = If_DsdManCacheLoad(fileName, 6, 4, 0);
+    ASSERT_TRUE(pLoaded != nullptr);
+    EXPECT_EQ(If_DsdManObjNum(pLoaded), nObjs[0]);
+    If_DsdManFree(pLoaded, 0);
+    // the second manager picks up the objects saved by the first one
+    EXPECT_EQ(If_DsdManCacheSave(pDsd[1], fileName, 0), 1);
+    EXPECT_GT(If_DsdManObjNum(pDsd[1]), nObjs[1]);
+    EXPECT_LE(If_DsdManObjNum(pDsd[1]), nObjs[0] + nObjs[1] - 2);
+    pLoaded = If_DsdManCacheLoad(fileName, 5, 4, 0);
+    ASSERT_TRUE(pLoaded != nullptr);
+    EXPECT_EQ(If_DsdManObjNum(pLoaded), If_DsdManObjNum(pDsd[1]));
+    If_DsdManFree(pLoaded, 0);
+    If_DsdManFree(pDsd[0], 0);
+    If_DsdManFree(pDsd[1], 0);
+    remove(fileName);
+}
+
+/*!
+  \brief Remapping an unchanged design reuses all LUTs of the previous mapping, remapping after a small change gives an equivalent design with most LUTs reused.
+*/
+TEST(GiaTest, GiaMfEco) {
+    char fileName[200];
+    strcpy(fileName, ASSETS_DIR);
+    strcat(fileName, "data/i10Samples/i10_SpId_0.aig");
+    Jf_Par_t Pars, * pPars = &Pars;
+    Mf_ManSetDefaultPars( pPars );
+    pPars->fCoarsen = 0;
+    Gia_Man_t * giaMan = Gia_AigerRead( fileName, 0, 0, 0 );
+    ASSERT_TRUE(giaMan != nullptr);
+    Gia_Man_t * giaOld = Mf_ManPerformMapping( giaMan, pPars );
+    ASSERT_TRUE(giaOld == giaMan && Gia_ManHasMapping(giaOld));
+    // the same design
+    Gia_Man_t * giaSame = Gia_AigerRead( fileName, 0, 0, 0 );
+    Gia_Man_t * giaEco = Mf_ManPerformMappingEco( giaOld, giaSame, pPars );
+    ASSERT_TRUE(Gia_ManHasMapping(giaEco));
+    EXPECT_EQ(Gia_ManLutNum(giaEco), Gia_ManLutNum(giaOld));
+    EXPECT_EQ(Gia_ManAndNum(giaEco), Gia_ManAndNum(giaOld));
+    EXPECT_EQ(Gia_ManLutLevel(giaEco, NULL), Gia_ManLutLevel(giaOld, NULL));
+    Gia_ManStop(giaEco);
+    // the same design with the first output ANDed with the first input
+    Gia_Man_t * giaChanged = Gia_ManStart( Gia_ManObjNum(giaSame) + 1 );
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManConst0(giaSame)->Value = 0;
+    Gia_ManForEachCi( giaSame, pObj, i )
+        pObj->Value = Gia_ManAppendCi( giaChanged );
+    Gia_ManForEachAnd( giaSame, pObj, i )
+        pObj->Value = Gia_ManAppendAnd( giaChanged, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachCo( giaSame, pObj, i )
+        Gia_ManAppendCo( giaChanged, i ? Gia_ObjFanin0Copy(pObj) : Gia_ManAppendAnd(giaChanged, Gia_ObjFanin0Copy(pObj), Gia_ManCi(giaSame, 0)->Value) );
+    giaEco = Mf_ManPerformMappingEco( giaOld, giaChanged, pPars );
+    ASSERT_TRUE(Gia_ManHasMapping(giaEco));
+    EXPECT_LE(Gia_ManLutNum(giaEco), Gia_ManLutNum(giaOld) + 2);
+    EXPECT_GE(Gia_ManLutNum(giaEco), Gia_ManLutNum(giaOld) - 2);
+    Gia_Man_t * pMiter = Gia_ManMiter( giaChanged, giaEco, 0, 1, 0, 0, 0 );
+    Cec_ParCec_t ParsCec, * pParsCec = &ParsCec;
+    Cec_ManCecSetDefaultParams( pParsCec );
+    EXPECT_TRUE(Cec_ManVerify( pMiter, pParsCec ) == 1);
+    Gia_ManStop(pMiter);
+    Gia_ManStop(giaEco);
+    Gia_ManStop(giaChanged);
+    Gia_ManStop(giaSame);
+    Gia_ManStop(giaOld);
+}
+
+/*!
+  \brief SAT sweeping of the miter of two equivalent snapshots with 4 threads proves the equivalence and gives the same result as the sweeping with 1 thread.
+*/
+TEST(GiaTest, GiaCec4SweepMt) {
+    char fileNames[2][200];
+    for ( int i = 0; i < 2; i++ )
+    {
+        strcpy(fileNames[i], ASSETS_DIR);
+        strcat(fileNames[i], i ? "data/i10Samples/i10_SpId_1.aig" : "data/i10Samples/i10_SpId_0.aig");
+    }
+    Gia_Man_t * giaSpecs[2], * giaSwept[2];
+    for ( int i = 0; i < 2; i++ )
+    {
+        giaSpecs[i] = Gia_AigerRead( fileNames[i], 0, 0, 0 );
+        ASSERT_TRUE(giaSpecs[i] != nullptr);
+    }
+    for ( int i = 0; i < 2; i++ )
+    {
+        Gia_Man_t * pMiter = Gia_ManMiter( giaSpecs[0], giaSpecs[1], 0, 0, 0, 0, 0 );
+        Cec_ParFra_t Pars, * pPars = &Pars;
+        Cec4_ManSetParams( pPars );
+        pPars->nProcs = i ? 4 : 1;
+        giaSwept[i] = Cec4_ManSimulateTest( pMiter, pPars );
+        ASSERT_TRUE(giaSwept[i] != nullptr);
+        Gia_ManStop(pMiter);
+    }
+    EXPECT_EQ(Gia_ManAndNum(giaSwept[0]), 0);
+    EXPECT_EQ(Gia_ManAndNum(giaSwept[1]), 0);
+    for ( int i = 0; i < 2; i++ )
+    {
+        Gia_ManStop(giaSwept[i]);
+        Gia_ManStop(giaSpecs[i]);
+    }
+}
+
+/*!
+  \brief Signal correspondence with 4 threads merges the flops of two copies of a shift register and gives the same result as with 1 thread.
+*/
+TEST(GiaTest, GiaScorrMt) {
+    const int nPis = 4, nFlops = 64;
+    Gia_Man_t * giaRes[2];
+    for ( int k = 0; k < 2; k++ )
+    {
+        // two copies of a shift register with nonlinear feedback driven by the same PIs
+        Gia_Man_t * pGia = Gia_ManStart( 1000 ), * pTemp;
+        int pPis[nPis], pFlops[2][nFlops], pNext[2][nFlops];
+        for ( int i = 0; i < nPis; i++ )
+            pPis[i] = Gia_ManAppendCi( pGia );
+        for ( int c = 0; c < 2; c++ )
+            for ( int i = 0; i < nFlops; i++ )
+                pFlops[c][i] = Gia_ManAppendCi( pGia );
+        Gia_ManHashAlloc( pGia );
+        for ( int c = 0; c < 2; c++ )
+            for ( int i = 0; i < nFlops; i++ )
+            {
+                int iAnd = Gia_ManHashAnd( pGia, pFlops[c][(5 * i + 3) % nFlops], Abc_LitNot(pFlops[c][(11 * i + 1) % nFlops]) );
+                int iXor = Gia_ManHashXor( pGia, pFlops[c][(i + nFlops - 1) % nFlops], iAnd );
+                pNext[c][i] = Gia_ManHashXor( pGia, iXor, pPis[i % nPis] );
+            }
+        for ( int c = 0; c < 2; c++ )
+            for ( int i = 0; i < nFlops; i++ )
+                Gia_ManAppendCo( pGia, pFlops[c][i] );
+        for ( int c = 0; c < 2; c++ )
+            for ( int i = 0; i < nFlops; i++ )
+                Gia_ManAppendCo( pGia, pNext[c][i] );
+        Gia_ManHashStop( pGia );
+        Gia_ManSetRegNum( pGia, 2 * nFlops );
+        pGia = Gia_ManCleanup( pTemp = pGia );
+        Gia_ManStop( pTemp );
+        Cec_ParCor_t Pars, * pPars = &Pars;
+        Cec_ManCorSetDefaultParams( pPars );
+        pPars->nProcs = k ? 4 : 1;
+        giaRes[k] = Cec_ManLSCorrespondence( pGia, pPars );
+        ASSERT_TRUE(giaRes[k] != nullptr);
+        Gia_ManStop( pGia );
+    }
+    EXPECT_LE(Gia_ManRegNum(giaRes[0]), nFlops);
+    EXPECT_EQ(Gia_ManRegNum(giaRes[0]), Gia_ManRegNum(giaRes[1]));
+    EXPECT_EQ(Gia_ManAndNum(giaRes[0]), Gia_ManAndNum(giaRes[1]));
+    for ( int k = 0; k < 2; k++ )
+        Gia_ManStop( giaRes[k] );
+}
+
 ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+/*!
+  \brief Decoding the AND section with several threads gives the same AIG as the serial reader.
+*/
+TEST(GiaAiger, ReadWithThreads) {
+    Gia_Obj_t * pObj, * pObj2;
+    int i;
+    char fileName[200];
+    strcpy(fileName, ASSETS_DIR);
+    strcat(fileName, "data/i10Samples/i10_SpId_0.aig");
+    Gia_Man_t * pGia  = Gia_AigerRead( fileName, 0, 0, 0 );
+    Gia_Man_t * pGia2 = Gia_AigerReadMt( fileName, 0, 0, 0, 4 );
+    ASSERT_TRUE(pGia != nullptr);
+    ASSERT_TRUE(pGia2 != nullptr);
+    EXPECT_EQ(Gia_ManObjNum(pGia), Gia_ManObjNum(pGia2));
+    EXPECT_EQ(Gia_ManCiNum(pGia), Gia_ManCiNum(pGia2));
+    EXPECT_EQ(Gia_ManCoNum(pGia), Gia_ManCoNum(pGia2));
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        pObj2 = Gia_ManObj( pGia2, i );
+        EXPECT_EQ(Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit0(pObj2, i));
+        EXPECT_EQ(Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit1(pObj2, i));
+    }
+    Gia_ManStop( pGia );
+    Gia_ManStop( pGia2 );
+}
+
+/*!
+  \brief Reading an AIG from the file mapped into memory gives the same AIG as reading it from a heap buffer.
+*/
+TEST(GiaAiger, ReadMapped) {
+    char fileName[200];
+    strcpy(fileName, ASSETS_DIR);
+    strcat(fileName, "data/i10Samples/i10_SpId_0.aig");
+    ABC_INT64_T nFileSize = 0;
+    char * pMapped = Abc_FileMap( fileName, &nFileSize );
+#ifdef _WIN32
+    if ( pMapped == nullptr )
+        return;
+#endif
+    ASSERT_TRUE(pMapped != nullptr);
+    FILE * pFile = fopen( fileName, "rb" );
+    ASSERT_TRUE(pFile != nullptr);
+    fseek( pFile, 0, SEEK_END );
+    EXPECT_EQ(nFileSize, (ABC_INT64_T)ftell( pFile ));
+    fseek( pFile, 0, SEEK_SET );
+    char * pBuffer = ABC_ALLOC( char, nFileSize );
+    ASSERT_EQ(fread( pBuffer, 1, (size_t)nFileSize, pFile ), (size_t)nFileSize);
+    fclose( pFile );
+    Gia_Man_t * pGia  = Gia_AigerReadFromMemory( pBuffer, (int)nFileSize, 0, 0, 0 );
+    Gia_Man_t * pGia2 = Gia_AigerReadFromMemoryMt( pMapped, nFileSize, 0, 0, 0, 1 );
+    Abc_FileUnmap( pMapped, nFileSize );
+    ABC_FREE( pBuffer );
+    ASSERT_TRUE(pGia != nullptr);
+    ASSERT_TRUE(pGia2 != nullptr);
+    EXPECT_EQ(Gia_ManObjNum(pGia), Gia_ManObjNum(pGia2));
+    EXPECT_EQ(Gia_ManCiNum(pGia), Gia_ManCiNum(pGia2));
+    EXPECT_EQ(Gia_ManCoNum(pGia), Gia_ManCoNum(pGia2));
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManForEachObj( pGia, pObj, i ) {
+        if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) ) {
+            EXPECT_EQ(Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit0(Gia_ManObj(pGia2, i), i));
+        }
+    }
+    Gia_ManStop( pGia );
+    Gia_ManStop( pGia2 );
+}
+
+/*!
+  \brief Writing an AIG larger than the output buffer, uncompressed and through zlib, and reading it back gives the same AIG.
+*/
+TEST(GiaAiger, WriteStreamed) {
+    char fileName[200], fileNameGz[210];
+    // the temporary files are written into the build directory
+    sprintf( fileName, "%s_gia_aiger_stream_test.aig", ASSETS_DIR );
+    sprintf( fileNameGz, "%s.gz", fileName );
+    Gia_Man_t * pGia = Gia_ManStart( 500000 );
+    Gia_Obj_t * pObj;
+    int i, nCis = 64;
+    Abc_Random( 1 );
+    for ( i = 0; i < nCis; i++ )
+        Gia_ManAppendCi( pGia );
+    for ( i = 0; i < 400000; i++ ) {
+        int nObjs = Gia_ManObjNum( pGia );
+        int iVar0 = 1 + Abc_Random(0) % (nObjs - 1);
+        int iVar1 = 1 + Abc_Random(0) % (nObjs - 1);
+        if ( iVar0 == iVar1 )
+            continue;
+        Gia_ManAppendAnd( pGia, Abc_Var2Lit(iVar0, Abc_Random(0) & 1), Abc_Var2Lit(iVar1, Abc_Random(0) & 1) );
+    }
+    for ( i = 0; i < 100; i++ )
+        Gia_ManAppendCo( pGia, Abc_Var2Lit(Gia_ManObjNum(pGia) - 1 - i, i & 1) );
+    // the AND section alone does not fit into the 1 MB buffer of the writer
+    Gia_AigerWrite( pGia, fileName, 0, 0, 0 );
+    Gia_AigerWrite( pGia, fileNameGz, 0, 0, 0 );
+    EXPECT_GT(Gia_FileSize( fileName ), 1 << 20);
+    EXPECT_TRUE(Gia_FileIsGz( fileNameGz ));
+    FILE * pFile = fopen( fileNameGz, "rb" );
+    EXPECT_TRUE(pFile != nullptr);
+    if ( pFile ) {
+        EXPECT_EQ(fgetc( pFile ), 0x1f);
+        EXPECT_EQ(fgetc( pFile ), 0x8b);
+        fclose( pFile );
+    }
+    EXPECT_LT(Gia_FileSize( fileNameGz ), Gia_FileSize( fileName ));
+    Gia_Man_t * pGia1 = Gia_AigerRead( fileName, 0, 1, 0 );
+    Gia_Man_t * pGia2 = Gia_AigerRead( fileNameGz, 0, 1, 0 );
+    // remove the files before the checks that may end the test
+    remove( fileName );
+    remove( fileNameGz );
+    ASSERT_TRUE(pGia1 != nullptr);
+    ASSERT_TRUE(pGia2 != nullptr);
+    Gia_Man_t * pGias[2] = { pGia1, pGia2 };
+    for ( int k = 0; k < 2; k++ ) {
+        ASSERT_EQ(Gia_ManObjNum(pGias[k]), Gia_ManObjNum(pGia));
+        EXPECT_EQ(Gia_ManCiNum(pGias[k]), nCis);
+        EXPECT_EQ(Gia_ManCoNum(pGias[k]), Gia_ManCoNum(pGia));
+        Gia_ManForEachAnd( pGia, pObj, i ) {
+            EXPECT_EQ(Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit0(Gia_ManObj(pGias[k], i), i));
+            EXPECT_EQ(Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit1(Gia_ManObj(pGias[k], i), i));
+        }
+        Gia_ManForEachCo( pGia, pObj, i )
+            EXPECT_EQ(Gia_ObjFaninLit0p(pGia, pObj), Gia_ObjFaninLit0p(pGias[k], Gia_ManCo(pGias[k], i)));
+    }
+    Gia_ManStop( pGia );
+    Gia_ManStop( pGia1 );
+    Gia_ManStop( pGia2 );
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -10,6 +10,9 @@
 #include "map/scl/sclLib.h"
 #include "map/scl/sclSize.h"
 #include "proof/cec/cec.h"
+#include "proof/pdr/pdr.h"
+#include "aig/saig/saig.h"
+#include "sat/bmc/bmc.h"
 
 #if defined(ABC_NAMESPACE)
 namespace ABC_NAMESPACE
@@ -264,4 +267,171 @@ TEST(GiaSingleOperation, StimeChecking) {
     Abc_Stop();
 }
 
-ABC_NAMESPACE_IMPL_END
\ No newline at end of file
+static int GiaPdrLemmasDepth = 0;
+static int GiaPdrLemmasCalls = 0;
+static int GiaPdrLemmas( void * pUser, int nSafe, Vec_Int_t * vCubes )
+{
+    int nFlops = *(int *)pUser;
+    GiaPdrLemmasDepth = Abc_MaxInt( GiaPdrLemmasDepth, nSafe );
+    if ( vCubes == NULL || GiaPdrLemmasCalls++ > 0 )
+        return 0;
+    // flop i of the first counter is equal to flop i of the second counter
+    for ( int i = 0; i < nFlops; i++ )
+    {
+        Vec_IntPushThree( vCubes, 2, Abc_Var2Lit(i, 0), Abc_Var2Lit(nFlops + i, 1) );
+        Vec_IntPushThree( vCubes, 2, Abc_Var2Lit(i, 1), Abc_Var2Lit(nFlops + i, 0) );
+    }
+    return 2 * nFlops;
+}
+
+/*!
+  \brief PDR imports the equivalences of the flops of two identical counters from the lemma callback, proves that the counters never differ, and reports the frames where the output cannot fail.
+*/
+TEST(GiaSingleOperation, GiaPdrImportLemmas) {
+    Abc_Start();
+    int nFlops = 6;
+    Gia_Man_t * pGia = Gia_ManStart( 1000 );
+    int iEnable = Gia_ManAppendCi( pGia );
+    int pFlops[2][6], pNext[2][6];
+    for ( int c = 0; c < 2; c++ )
+        for ( int i = 0; i < nFlops; i++ )
+            pFlops[c][i] = Gia_ManAppendCi( pGia );
+    Gia_ManHashAlloc( pGia );
+    for ( int c = 0; c < 2; c++ )
+    {
+        int iCarry = iEnable;
+        for ( int i = 0; i < nFlops; i++ )
+        {
+            pNext[c][i] = Gia_ManHashXor( pGia, pFlops[c][i], iCarry );
+            iCarry = Gia_ManHashAnd( pGia, pFlops[c][i], iCarry );
+        }
+    }
+    int iDiff = 0;
+    for ( int i = 0; i < nFlops; i++ )
+        iDiff = Gia_ManHashOr( pGia, iDiff, Gia_ManHashXor( pGia, pFlops[0][i], pFlops[1][i] ) );
+    Gia_ManAppendCo( pGia, iDiff );
+    for ( int c = 0; c < 2; c++ )
+        for ( int i = 0; i < nFlops; i++ )
+            Gia_ManAppendCo( pGia, pNext[c][i] );
+    Gia_ManHashStop( pGia );
+    Gia_ManSetRegNum( pGia, 2 * nFlops );
+
+    Aig_Man_t * pAig = Gia_ManToAigSimple( pGia );
+    Pdr_Par_t Pars, * pPars = &Pars;
+    Pdr_ManSetDefaultParams( pPars );
+    pPars->fSilent     = 1;
+    pPars->pFuncLemmas = GiaPdrLemmas;
+    pPars->pProgress   = (void *)&nFlops;
+    EXPECT_EQ(Pdr_ManSolve( pAig, pPars ), 1);
+    EXPECT_GE(GiaPdrLemmasCalls, 1);
+    EXPECT_GE(GiaPdrLemmasDepth, 1);
+    Aig_ManStop( pAig );
+    Gia_ManStop( pGia );
+    Abc_Stop();
+}
+
+static Gia_Man_t * GiaPdrTwoCounters( int nFlops, int fSat )
+{
+    // two counters with the same enable; if fSat, the second one ignores the enable
+    Gia_Man_t * pGia = Gia_ManStart( 1000 );
+    int iEnable = Gia_ManAppendCi( pGia );
+    int pFlops[2][8], pNext[2][8];
+    for ( int c = 0; c < 2; c++ )
+        for ( int i = 0; i < nFlops; i++ )
+            pFlops[c][i] = Gia_ManAppendCi( pGia );
+    Gia_ManHashAlloc( pGia );
+    for ( int c = 0; c < 2; c++ )
+    {
+        int iCarry = (c && fSat) ? 1 : iEnable;
+        for ( int i = 0; i < nFlops; i++ )
+        {
+            pNext[c][i] = Gia_ManHashXor( pGia, pFlops[c][i], iCarry );
+            iCarry = Gia_ManHashAnd( pGia, pFlops[c][i], iCarry );
+        }
+    }
+    int iDiff = 0;
+    for ( int i = 0; i < nFlops; i++ )
+        iDiff = Gia_ManHashOr( pGia, iDiff, Gia_ManHashXor( pGia, pFlops[0][i], pFlops[1][i] ) );
+    Gia_ManAppendCo( pGia, iDiff );
+    for ( int c = 0; c < 2; c++ )
+        for ( int i = 0; i < nFlops; i++ )
+            Gia_ManAppendCo( pGia, pNext[c][i] );
+    Gia_ManHashStop( pGia );
+    Gia_ManSetRegNum( pGia, 2 * nFlops );
+    return pGia;
+}
+
+/*!
+  \brief Concurrent PDR with one and four threads proves two counters with the same enable equal, imports lemmas through the user's callback data, and finds a valid counter-example when the counters differ.
+*/
+TEST(GiaSingleOperation, GiaPdrMultiThread) {
+    Abc_Start();
+    int nFlops = 6;
+    for ( int fSat = 0; fSat < 2; fSat++ )
+    {
+        Gia_Man_t * pGia = GiaPdrTwoCounters( nFlops, fSat );
+        for ( int nProcs = 1; nProcs <= 4; nProcs += 3 )
+        {
+            Aig_Man_t * pAig = Gia_ManToAigSimple( pGia );
+            Pdr_Par_t Pars, * pPars = &Pars;
+            Pdr_ManSetDefaultParams( pPars );
+            pPars->fSilent = 1;
+            pPars->nProcs  = nProcs;
+            // the equivalences of the flops are lemmas only when the counters are equal
+            if ( !fSat )
+            {
+                GiaPdrLemmasCalls  = 0;
+                pPars->pFuncLemmas = GiaPdrLemmas;
+                pPars->pProgress   = (void *)&nFlops;
+            }
+            EXPECT_EQ(Pdr_ManSolve( pAig, pPars ), !fSat);
+            if ( fSat )
+            {
+                ASSERT_TRUE(pAig->pSeqModel != NULL);
+                EXPECT_EQ(Saig_ManVerifyCex( pAig, pAig->pSeqModel ), 1);
+            }
+            else
+            {
+                EXPECT_TRUE(pAig->pSeqModel == NULL);
+                EXPECT_GE(GiaPdrLemmasCalls, 1);
+            }
+            Aig_ManStop( pAig );
+        }
+        Gia_ManStop( pGia );
+    }
+    Abc_Stop();
+}
+
+/*!
+  \brief Template BMC with one and four threads finds the shortest counter-example when the counters differ and reaches the frame limit when they are equal.
+*/
+TEST(GiaSingleOperation, GiaBmcTemplate) {
+    for ( int fSat = 0; fSat < 2; fSat++ )
+    {
+        Gia_Man_t * pGia = GiaPdrTwoCounters( 6, fSat );
+        for ( int nProcs = 1; nProcs <= 4; nProcs += 3 )
+        {
+            Bmc_AndPar_t Pars, * pPars = &Pars;
+            memset( pPars, 0, sizeof(Bmc_AndPar_t) );
+            pPars->nFramesMax  = 20;
+            pPars->nFramesAdd  = nProcs == 1 ? 1 : 3;
+            pPars->nProcs      = nProcs;
+            pPars->fNotVerbose = 1;
+            EXPECT_EQ(Bmct_ManPerform( pGia, pPars ), fSat ? 0 : -1);
+            if ( fSat )
+            {
+                ASSERT_TRUE(pGia->pCexSeq != NULL);
+                EXPECT_EQ(pGia->pCexSeq->iFrame, 1);
+                EXPECT_EQ(Gia_ManVerifyCex( pGia, pGia->pCexSeq, 0 ), 1);
+            }
+            else
+            {
+                EXPECT_TRUE(pGia->pCexSeq == NULL);
+                EXPECT_EQ(pPars->iFrame, 19);
+            }
+        }
+        Gia_ManStop( pGia );
+    }
+}
+
+ABC_NAMESPACE_IMPL_END
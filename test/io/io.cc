@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <cstring>
+
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "base/cmd/cmd.h"
+#include "aig/gia/gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+/*!
+  \brief The AIG restored from a session file has the same structure and mapping as the AIG that was saved.
+*/
+TEST(IoTest, IoSessionRoundTrip) {
+    char fileName[200], sessionName[200], command[1000];
+    // the session file is written into the build directory
+    sprintf( sessionName, "%s_io_session_test.abcs", ASSETS_DIR );
+    strcpy( fileName, ASSETS_DIR );
+    strcat( fileName, "data/i10Samples/i10_SpId_0.aig" );
+    Abc_Start();
+    Abc_Frame_t * pAbc = Abc_FrameGetGlobalFrame();
+    sprintf( command, "&r %s; &if -K 6; save_session %s", fileName, sessionName );
+    ASSERT_EQ(Cmd_CommandExecute( pAbc, command ), 0);
+    Gia_Man_t * pSaved = Abc_FrameReadGia( pAbc );
+    ASSERT_TRUE(Gia_ManHasMapping(pSaved));
+    Gia_Man_t * pGia = Gia_ManDup( pSaved );
+    Vec_Int_t * vMapping = Vec_IntDup( pSaved->vMapping );
+    int nLuts = Gia_ManLutNum( pSaved );
+    // replace the current AIG before restoring the session
+    ASSERT_EQ(Cmd_CommandExecute( pAbc, "&st; &syn2" ), 0);
+    sprintf( command, "load_session %s", sessionName );
+    int RetValue = Cmd_CommandExecute( pAbc, command );
+    remove( sessionName );
+    ASSERT_EQ(RetValue, 0);
+    Gia_Man_t * pLoaded = Abc_FrameReadGia( pAbc );
+    ASSERT_TRUE(pLoaded != nullptr);
+    EXPECT_EQ(Gia_ManCiNum(pLoaded), Gia_ManCiNum(pGia));
+    EXPECT_EQ(Gia_ManCoNum(pLoaded), Gia_ManCoNum(pGia));
+    ASSERT_EQ(Gia_ManObjNum(pLoaded), Gia_ManObjNum(pGia));
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManForEachAnd( pGia, pObj, i ) {
+        Gia_Obj_t * pObjLoaded = Gia_ManObj( pLoaded, i );
+        ASSERT_TRUE(Gia_ObjIsAnd(pObjLoaded));
+        EXPECT_EQ(Gia_ObjFaninLit0(pObjLoaded, i), Gia_ObjFaninLit0(pObj, i));
+        EXPECT_EQ(Gia_ObjFaninLit1(pObjLoaded, i), Gia_ObjFaninLit1(pObj, i));
+    }
+    Gia_ManForEachCo( pGia, pObj, i )
+        EXPECT_EQ(Gia_ObjFaninLit0p(pLoaded, Gia_ManCo(pLoaded, i)), Gia_ObjFaninLit0p(pGia, pObj));
+    // the mapping may be stored in a different order, so the LUTs are compared one by one
+    ASSERT_TRUE(Gia_ManHasMapping(pLoaded));
+    EXPECT_EQ(Gia_ManLutNum(pLoaded), nLuts);
+    Gia_ManForEachAnd( pGia, pObj, i ) {
+        int nSize = Vec_IntEntry(vMapping, i) ? Vec_IntEntry(vMapping, Vec_IntEntry(vMapping, i)) : 0;
+        ASSERT_EQ(Gia_ObjIsLut(pLoaded, i), nSize > 0);
+        if ( nSize > 0 ) {
+            ASSERT_EQ(Gia_ObjLutSize(pLoaded, i), nSize);
+            EXPECT_EQ(memcmp(Gia_ObjLutFanins(pLoaded, i), Vec_IntEntryP(vMapping, Vec_IntEntry(vMapping, i) + 1), sizeof(int) * nSize), 0);
+        }
+    }
+    Vec_IntFree( vMapping );
+    Gia_ManStop( pGia );
+    Abc_Stop();
+}
+
+ABC_NAMESPACE_IMPL_END
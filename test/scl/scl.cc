@@ -0,0 +1,289 @@
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <cstring>
+
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "base/cmd/cmd.h"
+#include "map/mio/mio.h"
+#include "map/scl/sclLib.h"
+
+ABC_NAMESPACE_IMPL_START
+
+static const char * s_SclTestLib =
+"library (scltest) {\n"
+"  time_unit : \"1ns\" ;\n"
+"  capacitive_load_unit (1,ff) ;\n"
+"  lu_table_template (tmpl) { variable_1 : input_net_transition ; variable_2 : total_output_net_capacitance ; index_1 (\"0.01, 0.1\"); index_2 (\"0.5, 2.0\"); }\n"
+"  cell (INV_X1) { area : 1.0 ; pin (A) { direction : input ; capacitance : 1.0 ; }\n"
+"    pin (ZN) { direction : output ; function : \"!A\" ; timing () { related_pin : \"A\" ; timing_sense : negative_unate ;\n"
+"      cell_rise (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } cell_fall (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); }\n"
+"      rise_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } fall_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } } } }\n"
+"  cell (BUF_X1) { area : 1.5 ; pin (A) { direction : input ; capacitance : 1.0 ; }\n"
+"    pin (Z) { direction : output ; function : \"A\" ; timing () { related_pin : \"A\" ; timing_sense : positive_unate ;\n"
+"      cell_rise (tmpl) { values ( \"0.02, 0.03\", \"0.03, 0.04\" ); } cell_fall (tmpl) { values ( \"0.02, 0.03\", \"0.03, 0.04\" ); }\n"
+"      rise_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } fall_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } } } }\n"
+"  cell (NAND2_X1) { area : 2.0 ; pin (A1) { direction : input ; capacitance : 1.2 ; } pin (A2) { direction : input ; capacitance : 1.1 ; }\n"
+"    pin (ZN) { direction : output ; function : \"!(A1&A2)\" ;\n"
+"      timing () { related_pin : \"A1\" ; timing_sense : negative_unate ;\n"
+"      cell_rise (tmpl) { values ( \"0.02, 0.04\", \"0.03, 0.05\" ); } cell_fall (tmpl) { values ( \"0.02, 0.04\", \"0.03, 0.05\" ); }\n"
+"      rise_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } fall_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } }\n"
+"      timing () { related_pin : \"A2\" ; timing_sense : negative_unate ;\n"
+"      cell_rise (tmpl) { values ( \"0.02, 0.04\", \"0.03, 0.05\" ); } cell_fall (tmpl) { values ( \"0.02, 0.04\", \"0.03, 0.05\" ); }\n"
+"      rise_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } fall_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } } } }\n"
+"  cell (NOR2_X1) { area : 2.0 ; pin (A1) { direction : input ; capacitance : 1.2 ; } pin (A2) { direction : input ; capacitance : 1.1 ; }\n"
+"    pin (ZN) { direction : output ; function : \"!(A1|A2)\" ;\n"
+"      timing () { related_pin : \"A1\" ; timing_sense : negative_unate ;\n"
+"      cell_rise (tmpl) { values ( \"0.03, 0.05\", \"0.04, 0.06\" ); } cell_fall (tmpl) { values ( \"0.03, 0.05\", \"0.04, 0.06\" ); }\n"
+"      rise_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } fall_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } }\n"
+"      timing () { related_pin : \"A2\" ; timing_sense : negative_unate ;\n"
+"      cell_rise (tmpl) { values ( \"0.03, 0.05\", \"0.04, 0.06\" ); } cell_fall (tmpl) { values ( \"0.03, 0.05\", \"0.04, 0.06\" ); }\n"
+"      rise_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } fall_transition (tmpl) { values ( \"0.01, 0.02\", \"0.02, 0.03\" ); } } } }\n"
+"}\n";
+
+static int Scl_TestLibsEqual( SC_Lib * p1, SC_Lib * p2 )
+{
+    Vec_Str_t * vStr1 = Abc_SclWriteToStr( p1 );
+    Vec_Str_t * vStr2 = Abc_SclWriteToStr( p2 );
+    int RetValue = Vec_StrSize(vStr1) == Vec_StrSize(vStr2) && !memcmp(Vec_StrArray(vStr1), Vec_StrArray(vStr2), Vec_StrSize(vStr1));
+    Vec_StrFree( vStr1 );
+    Vec_StrFree( vStr2 );
+    return RetValue;
+}
+
+static void Scl_TestWriteSizedLib( char * pFileName )
+{
+    const char * pNames[4] = { "INV", "BUF", "NAND2", "NOR2" };
+    const char * pFuncs[4] = { "!A1", "A1", "!(A1&A2)", "!(A1|A2)" };
+    float Areas[4] = { 1.0, 1.2, 1.5, 1.5 }, Delays[4] = { 0.015, 0.025, 0.02, 0.025 };
+    float Slews[3] = { 0.01, 0.1, 0.5 }, Loads[3] = { 0.5, 2.0, 8.0 };
+    const char * pTables[4] = { "cell_rise", "cell_fall", "rise_transition", "fall_transition" };
+    FILE * pFile = fopen( pFileName, "wb" );
+    int c, s, p, t, i, k;
+    fprintf( pFile, "library (sclsized) {\n  time_unit : \"1ns\" ;\n  capacitive_load_unit (1,ff) ;\n" );
+    fprintf( pFile, "  lu_table_template (tmpl) { variable_1 : input_net_transition ; variable_2 : total_output_net_capacitance ; index_1 (\"0.01, 0.1, 0.5\"); index_2 (\"0.5, 2.0, 8.0\"); }\n" );
+    for ( c = 0; c < 4; c++ )
+    for ( s = 1; s <= 4; s *= 2 )
+    {
+        int nPins = c < 2 ? 1 : 2;
+        fprintf( pFile, "  cell (%s_X%d) { area : %.2f ;\n", pNames[c], s, Areas[c] * (0.2 + 0.8 * s) );
+        for ( p = 1; p <= nPins; p++ )
+            fprintf( pFile, "    pin (A%d) { direction : input ; capacitance : %.1f ; }\n", p, 1.0 * s );
+        fprintf( pFile, "    pin (ZN) { direction : output ; function : \"%s\" ;\n", pFuncs[c] );
+        for ( p = 1; p <= nPins; p++ )
+        {
+            fprintf( pFile, "      timing () { related_pin : \"A%d\" ; timing_sense : non_unate ;\n", p );
+            for ( t = 0; t < 4; t++ )
+            {
+                fprintf( pFile, "        %s (tmpl) { values (", pTables[t] );
+                for ( i = 0; i < 3; i++ )
+                {
+                    fprintf( pFile, "%s \"", i ? "," : "" );
+                    for ( k = 0; k < 3; k++ )
+                        fprintf( pFile, "%s%.4f", k ? ", " : "", t < 2 ? Delays[c] + 0.2 * Slews[i] + 0.012 * Loads[k] / s : 0.01 + 0.05 * Slews[i] + 0.01 * Loads[k] / s );
+                    fprintf( pFile, "\"" );
+                }
+                fprintf( pFile, " ); }\n" );
+            }
+            fprintf( pFile, "      }\n" );
+        }
+        fprintf( pFile, "    }\n  }\n" );
+    }
+    fprintf( pFile, "}\n" );
+    fclose( pFile );
+}
+
+static Vec_Ptr_t * Scl_TestMapDesign( char * pLibName, char * pCommands )
+{
+    char fileName[200], command[1000];
+    Abc_Frame_t * pAbc;
+    Abc_Ntk_t * pNtk;
+    Abc_Obj_t * pObj;
+    Vec_Ptr_t * vGates = Vec_PtrAlloc( 1000 );
+    int i;
+    strcpy( fileName, ASSETS_DIR );
+    strcat( fileName, "data/i10Samples/i10_SpId_0.aig" );
+    Abc_Start();
+    pAbc = Abc_FrameGetGlobalFrame();
+    sprintf( command, "read_lib %s; read %s; strash; %s", pLibName, fileName, pCommands );
+    if ( Cmd_CommandExecute( pAbc, command ) == 0 )
+    {
+        pNtk = Abc_FrameReadNtk( pAbc );
+        Abc_NtkForEachNode( pNtk, pObj, i )
+            Vec_PtrPush( vGates, Abc_UtilStrsav(Mio_GateReadName((Mio_Gate_t *)pObj->pData)) );
+    }
+    Abc_Stop();
+    return vGates;
+}
+
+/*!
+  \brief The library read through the cache of compiled libraries is the same as the library parsed from the Liberty file, and the parsing options are part of the cache key.
+*/
+TEST(SclTest, SclLibertyCache) {
+    char fileName[] = "_scl_cache_test.lib";
+    char cacheDir[] = "_scl_cache_test_dir";
+    char * dontUse[1] = { (char *)"NOR2_X1" };
+    SC_DontUse dont_use = {0}, dont_use_nor = { 1, dontUse };
+    FILE * pFile = fopen( fileName, "wb" );
+    ASSERT_TRUE(pFile != nullptr);
+    fputs( s_SclTestLib, pFile );
+    fclose( pFile );
+    SC_Lib * pLib = Abc_SclReadLiberty( fileName, 0, 0, dont_use, 0 );
+    ASSERT_TRUE(pLib != nullptr);
+    EXPECT_EQ(SC_LibCellNum(pLib), 4);
+    // the first read adds the library to the cache, the second one reads it from the cache
+    for ( int i = 0; i < 2; i++ )
+    {
+        SC_Lib * pLibCache = Abc_SclReadLibertyCache( fileName, cacheDir, 0, 0, dont_use, 0 );
+        ASSERT_TRUE(pLibCache != nullptr);
+        EXPECT_TRUE(Scl_TestLibsEqual(pLib, pLibCache));
+        Abc_SclLibFree( pLibCache );
+    }
+    // the library with a different dont_use list is cached separately
+    for ( int i = 0; i < 2; i++ )
+    {
+        SC_Lib * pLibCache = Abc_SclReadLibertyCache( fileName, cacheDir, 0, 0, dont_use_nor, 0 );
+        ASSERT_TRUE(pLibCache != nullptr);
+        EXPECT_EQ(SC_LibCellNum(pLibCache), 3);
+        Abc_SclLibFree( pLibCache );
+    }
+    Abc_SclLibFree( pLib );
+    remove( fileName );
+    char command[100];
+    sprintf( command, "rm -rf %s", cacheDir );
+    EXPECT_EQ(system( command ), 0);
+}
+
+/*!
+  \brief Gate sizing evaluates the candidate gates on several threads and gets the same gates as the single-threaded run.
+*/
+TEST(SclTest, SclSizeParallel) {
+    char libName[] = "_scl_size_test.lib";
+    Scl_TestWriteSizedLib( libName );
+    Vec_Ptr_t * vGates1 = Scl_TestMapDesign( libName, (char *)"map; topo; upsize -P 1; dnsize -P 1" );
+    Vec_Ptr_t * vGates4 = Scl_TestMapDesign( libName, (char *)"map; topo; upsize -P 4; dnsize -P 4" );
+    char * pName;
+    int i, nSized = 0;
+    ASSERT_GT(Vec_PtrSize(vGates1), 0);
+    ASSERT_EQ(Vec_PtrSize(vGates1), Vec_PtrSize(vGates4));
+    Vec_PtrForEachEntry( char *, vGates1, pName, i )
+    {
+        EXPECT_STREQ(pName, (char *)Vec_PtrEntry(vGates4, i));
+        nSized += strstr(pName, "_X1") == NULL;
+    }
+    // some gates are upsized
+    EXPECT_GT(nSized, 0);
+    Vec_PtrFreeFree( vGates1 );
+    Vec_PtrFreeFree( vGates4 );
+    remove( libName );
+}
+
+/*!
+  \brief Standard-cell mapping with amap maps the partitions of the design on several threads and gets the same gates for any number of threads.
+*/
+TEST(SclTest, SclAmapParallel) {
+    char libName[] = "_scl_amap_test.lib";
+    Scl_TestWriteSizedLib( libName );
+    Vec_Ptr_t * vGates1 = Scl_TestMapDesign( libName, (char *)"amap" );
+    Vec_Ptr_t * vGates2 = Scl_TestMapDesign( libName, (char *)"amap -P 2 -N 500" );
+    Vec_Ptr_t * vGates4 = Scl_TestMapDesign( libName, (char *)"amap -P 4 -N 500" );
+    char * pName;
+    int i;
+    ASSERT_GT(Vec_PtrSize(vGates1), 0);
+    ASSERT_GT(Vec_PtrSize(vGates2), 0);
+    ASSERT_EQ(Vec_PtrSize(vGates2), Vec_PtrSize(vGates4));
+    Vec_PtrForEachEntry( char *, vGates2, pName, i )
+        EXPECT_STREQ(pName, (char *)Vec_PtrEntry(vGates4, i));
+    Vec_PtrFreeFree( vGates1 );
+    Vec_PtrFreeFree( vGates2 );
+    Vec_PtrFreeFree( vGates4 );
+    remove( libName );
+}
+
+/*!
+  \brief Mapping with the supergate library read from the cache of binary images gets the same gates as mapping with the supergates derived from the genlib library.
+*/
+TEST(SclTest, SclSuperCache) {
+    char libName[] = "_scl_super_test.lib";
+    char cacheDir[] = "_scl_super_test_dir";
+    char command[100];
+    Scl_TestWriteSizedLib( libName );
+    Vec_Ptr_t * vGates0 = Scl_TestMapDesign( libName, (char *)"map" );
+    // the first run adds the supergates to the cache, the second one reads them from the cache
+    sprintf( command, "set libcache %s; map", cacheDir );
+    Vec_Ptr_t * vGates1 = Scl_TestMapDesign( libName, command );
+    sprintf( command, "ls %s/*.sgl > /dev/null", cacheDir );
+    EXPECT_EQ(system( command ), 0);
+    sprintf( command, "set libcache %s; map", cacheDir );
+    Vec_Ptr_t * vGates2 = Scl_TestMapDesign( libName, command );
+    char * pName;
+    int i;
+    ASSERT_GT(Vec_PtrSize(vGates0), 0);
+    ASSERT_EQ(Vec_PtrSize(vGates0), Vec_PtrSize(vGates1));
+    ASSERT_EQ(Vec_PtrSize(vGates0), Vec_PtrSize(vGates2));
+    Vec_PtrForEachEntry( char *, vGates0, pName, i )
+    {
+        EXPECT_STREQ(pName, (char *)Vec_PtrEntry(vGates1, i));
+        EXPECT_STREQ(pName, (char *)Vec_PtrEntry(vGates2, i));
+    }
+    Vec_PtrFreeFree( vGates0 );
+    Vec_PtrFreeFree( vGates1 );
+    Vec_PtrFreeFree( vGates2 );
+    remove( libName );
+    sprintf( command, "rm -rf %s", cacheDir );
+    EXPECT_EQ(system( command ), 0);
+}
+
+/*!
+  \brief The timing arcs of a library with 2D tables are flattened when the library is read, and the lookup in the flat tables gives the same arrival times and slews as the lookup in the original tables.
+*/
+TEST(SclTest, SclLibLookupFlat) {
+    char libName[] = "_scl_flat_test.lib";
+    SC_DontUse dont_use = {0};
+    Scl_TestWriteSizedLib( libName );
+    SC_Lib * pLib = Abc_SclReadLiberty( libName, 0, 0, dont_use, 0 );
+    ASSERT_TRUE(pLib != nullptr);
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pRTime;
+    SC_Timing * pTime;
+    int i, k, m, n, t, r, nFlat = 0;
+    srand( 1 );
+    SC_LibForEachCell( pLib, pCell, i )
+    SC_CellForEachPinOut( pCell, pPin, k )
+    SC_PinForEachRTiming( pPin, pRTime, m )
+    Vec_PtrForEachEntry( SC_Timing *, &pRTime->vTimings, pTime, n )
+    {
+        float * pFlat = pTime->pFlat;
+        ASSERT_TRUE(pFlat != nullptr);
+        nFlat++;
+        for ( t = sc_ts_Pos; t <= sc_ts_Non; t++ )
+        for ( r = 0; r < 100; r++ )
+        {
+            // the points are both inside and outside of the table
+            SC_Pair ArrIn  = { (float)(rand() % 1000), (float)(rand() % 1000) };
+            SC_Pair SlewIn = { (float)(rand() % 1000), (float)(rand() % 1000) };
+            SC_Pair Load   = { (float)(rand() % 2000) / 100, (float)(rand() % 2000) / 100 };
+            SC_Pair ArrOut1 = {0}, SlewOut1 = {0}, ArrOut2 = {0}, SlewOut2 = {0}, Dep1 = {0}, Dep2 = {0};
+            pTime->tsense = (SC_TSense)t;
+            Scl_LibPinArrival( pTime, &ArrIn, &SlewIn, &Load, &ArrOut1, &SlewOut1 );
+            Scl_LibPinDeparture( pTime, &Dep1, &SlewIn, &Load, &ArrIn );
+            pTime->pFlat = NULL;
+            Scl_LibPinArrival( pTime, &ArrIn, &SlewIn, &Load, &ArrOut2, &SlewOut2 );
+            Scl_LibPinDeparture( pTime, &Dep2, &SlewIn, &Load, &ArrIn );
+            pTime->pFlat = pFlat;
+            EXPECT_EQ(ArrOut1.rise, ArrOut2.rise);
+            EXPECT_EQ(ArrOut1.fall, ArrOut2.fall);
+            EXPECT_EQ(SlewOut1.rise, SlewOut2.rise);
+            EXPECT_EQ(SlewOut1.fall, SlewOut2.fall);
+            EXPECT_EQ(Dep1.rise, Dep2.rise);
+            EXPECT_EQ(Dep1.fall, Dep2.fall);
+        }
+        pTime->tsense = sc_ts_Non;
+    }
+    EXPECT_EQ(nFlat, 18);
+    Abc_SclLibFree( pLib );
+    remove( libName );
+}
+
+ABC_NAMESPACE_IMPL_END
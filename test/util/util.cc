@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <cstring>
 #include "misc/extra/extra.h"
+#include "misc/vec/vecMemMt.h"
 
 
 #if defined(ABC_NAMESPACE)
@@ -74,4 +75,126 @@ TEST(UtilTest, UtilAddClauses) {
 }
 
 
+static int Util_TestPoolLeaf( void * pArg )
+{
+    __atomic_fetch_add( (int *)pArg, 1, __ATOMIC_SEQ_CST );
+    return 1;
+}
+static int Util_TestPoolNode( void * pArg )
+{
+    // each task waits for a nested group, so the waiting threads have to run the tasks
+    Util_PoolGroup_t * pGroup = Util_PoolGroupStart( 4, 0 );
+    for ( int i = 0; i < 10; i++ )
+        Util_PoolGroupAdd( pGroup, Util_TestPoolLeaf, pArg );
+    Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
+    return 1;
+}
+static int Util_TestPoolPeer( void * pArg )
+{
+    // each task waits for the other one, so both have to run at the same time
+    __atomic_fetch_add( (int *)pArg, 1, __ATOMIC_SEQ_CST );
+    while ( __atomic_load_n( (int *)pArg, __ATOMIC_SEQ_CST ) < 2 )
+        ;
+    return 1;
+}
+
+/*!
+  \brief Thread pool interface, the tasks of a group may start nested groups, the canceled group skips the tasks that are not started, the tasks waiting for each other run on their own threads.
+*/
+TEST(UtilTest, UtilPoolGroups) {
+    int nCount = 0;
+    Util_PoolGroup_t * pGroup = Util_PoolGroupStart( 4, 0 );
+    for ( int i = 0; i < 20; i++ )
+        Util_PoolGroupAdd( pGroup, Util_TestPoolNode, &nCount );
+    EXPECT_EQ(Util_PoolGroupWait( pGroup ), 0);
+    Util_PoolGroupStop( pGroup );
+    EXPECT_EQ(nCount, 200);
+
+    nCount = 0;
+    pGroup = Util_PoolGroupStart( 4, 0 );
+    Util_PoolGroupCancel( pGroup );
+    EXPECT_TRUE(Util_PoolGroupIsCanceled( pGroup ));
+    for ( int i = 0; i < 20; i++ )
+        Util_PoolGroupAdd( pGroup, Util_TestPoolLeaf, &nCount );
+    EXPECT_EQ(Util_PoolGroupWait( pGroup ), 20);
+    Util_PoolGroupStop( pGroup );
+    EXPECT_EQ(nCount, 0);
+
+    nCount = 0;
+    Util_PoolSetThreadMax( 1 );
+    pGroup = Util_PoolGroupStartThreads( 0 );
+    for ( int i = 0; i < 2; i++ )
+        Util_PoolGroupAdd( pGroup, Util_TestPoolPeer, &nCount );
+    EXPECT_EQ(Util_PoolGroupWait( pGroup ), 0);
+    Util_PoolGroupStop( pGroup );
+    EXPECT_EQ(nCount, 2);
+    Util_PoolSetThreadMax( 0 );
+    Util_PoolStop();
+}
+
+typedef struct Util_TestMemMt_t_ { Vec_MemMt_t * p; int iStart; int * pIds; } Util_TestMemMt_t;
+static void Util_TestMemMtEntry( word * pEntry, int i )
+{
+    pEntry[0] = (word)i * 0x9E3779B97F4A7C15;
+    pEntry[1] = (word)i;
+}
+static int Util_TestMemMtInsert( void * pArg )
+{
+    Util_TestMemMt_t * pData = (Util_TestMemMt_t *)pArg;
+    word pEntry[2];
+    // each task inserts all entries starting from its own offset
+    for ( int k = 0; k < 5000; k++ )
+    {
+        int i = (pData->iStart + k) % 5000;
+        Util_TestMemMtEntry( pEntry, i );
+        pData->pIds[i] = Vec_MemMtInsert( pData->p, pEntry );
+    }
+    return 1;
+}
+
+/*!
+  \brief Concurrent store of fixed-size entries, the threads inserting the same entries get the same IDs.
+*/
+TEST(UtilTest, UtilVecMemMt) {
+    Vec_MemMt_t * p = Vec_MemMtAlloc( 2, 8, 2 );
+    Util_TestMemMt_t pData[4];
+    Util_PoolGroup_t * pGroup = Util_PoolGroupStart( 4, 0 );
+    for ( int t = 0; t < 4; t++ )
+    {
+        pData[t].p = p;
+        pData[t].iStart = 1250 * t;
+        pData[t].pIds = ABC_ALLOC( int, 5000 );
+        Util_PoolGroupAdd( pGroup, Util_TestMemMtInsert, pData + t );
+    }
+    EXPECT_EQ(Util_PoolGroupWait( pGroup ), 0);
+    Util_PoolGroupStop( pGroup );
+    EXPECT_EQ(Vec_MemMtEntryNum( p ), 5000);
+    for ( int i = 0; i < 5000; i++ )
+    {
+        word pEntry[2];
+        Util_TestMemMtEntry( pEntry, i );
+        for ( int t = 1; t < 4; t++ )
+            EXPECT_EQ(pData[t].pIds[i], pData[0].pIds[i]);
+        EXPECT_EQ(memcmp(Vec_MemReadEntry(Vec_MemMtMem(p), pData[0].pIds[i]), pEntry, sizeof(word) * 2), 0);
+        EXPECT_EQ(Vec_MemMtLookup( p, pEntry ), pData[0].pIds[i]);
+    }
+    // the batch of known and new entries
+    word pEntries[2 * 100];
+    int pIds[100];
+    for ( int i = 0; i < 100; i++ )
+        Util_TestMemMtEntry( pEntries + 2 * i, 4950 + i );
+    Vec_MemMtInsertBatch( p, pEntries, 100, pIds );
+    for ( int i = 0; i < 50; i++ )
+        EXPECT_EQ(pIds[i], pData[0].pIds[4950 + i]);
+    for ( int i = 50; i < 100; i++ )
+        EXPECT_GE(pIds[i], 5000);
+    EXPECT_EQ(Vec_MemMtEntryNum( p ), 5050);
+    for ( int t = 0; t < 4; t++ )
+        ABC_FREE( pData[t].pIds );
+    Vec_MemMtFree( p );
+    Util_PoolStop();
+}
+
+
 ABC_NAMESPACE_IMPL_END
\ No newline at end of file